@@ -68,8 +68,10 @@ const StringHash XML_TYPE_TEXTURE_3D("texture3d");
 const StringHash XML_TYPE_CUBEMAP("cubemap");
 
 const StringHash BINARY_TYPE_SCENE("USCN");
+const StringHash BINARY_TYPE_SCHEMA_SCENE("USCS");
 const StringHash BINARY_TYPE_PACKAGE("UPAK");
 const StringHash BINARY_TYPE_COMPRESSED_PACKAGE("ULZ4");
+const StringHash BINARY_TYPE_BLOCK_COMPRESSED_PACKAGE("ULZB");
 const StringHash BINARY_TYPE_ANGLESCRIPT("ASBC");
 const StringHash BINARY_TYPE_MODEL("UMDL");
 const StringHash BINARY_TYPE_SHADER("USHD");
@@ -1163,11 +1165,11 @@ bool GetBinaryType(String path, StringHash &out fileType, bool useCache = false)
         type = StringHash(file.ReadFileID());
     }
 
-    if (type == BINARY_TYPE_SCENE)
+    if (type == BINARY_TYPE_SCENE || type == BINARY_TYPE_SCHEMA_SCENE)
         fileType = BINARY_TYPE_SCENE;
     else if (type == BINARY_TYPE_PACKAGE)
         fileType = BINARY_TYPE_PACKAGE;
-    else if (type == BINARY_TYPE_COMPRESSED_PACKAGE)
+    else if (type == BINARY_TYPE_COMPRESSED_PACKAGE || type == BINARY_TYPE_BLOCK_COMPRESSED_PACKAGE)
         fileType = BINARY_TYPE_COMPRESSED_PACKAGE;
     else if (type == BINARY_TYPE_ANGLESCRIPT)
         fileType = BINARY_TYPE_ANGLESCRIPT;
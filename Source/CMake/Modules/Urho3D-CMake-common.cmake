@@ -58,6 +58,7 @@ if (CMAKE_PROJECT_NAME STREQUAL Urho3D)
 endif ()
 option (URHO3D_PROFILING "Enable profiling support" TRUE)
 option (URHO3D_LOGGING "Enable logging support" TRUE)
+set (URHO3D_LOG_MIN_LEVEL 0 CACHE STRING "Lowest log message level compiled in (0 = debug, 1 = info, 2 = warning, 3 = error)")
 option (URHO3D_TESTING "Enable testing support")
 if (URHO3D_TESTING)
     set (URHO3D_TEST_TIME_OUT 5 CACHE STRING "Number of seconds to test run the executables")
@@ -138,6 +139,9 @@ endif ()
 # Enable logging by default. If disabled, LOGXXXX macros become no-ops and the Log subsystem is not instantiated.
 if (URHO3D_LOGGING)
     add_definitions (-DURHO3D_LOGGING)
+    if (URHO3D_LOG_MIN_LEVEL)
+        add_definitions (-DURHO3D_LOG_MIN_LEVEL=${URHO3D_LOG_MIN_LEVEL})
+    endif ()
 endif ()
 
 # If not on MSVC, enable use of OpenGL instead of Direct3D9 (either not compiling on Windows or
@@ -0,0 +1,152 @@
+//
+// Copyright (c) 2008-2014 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#pragma once
+
+#include "Hash.h"
+#include "Swap.h"
+
+#include <cstring>
+
+namespace Urho3D
+{
+
+/// Open-addressing hash set/map base class. Stores the per-slot hash values; the derived template owns the slot storage.
+class FlatHashBase
+{
+public:
+    /// Slot hash value for a never used slot.
+    static const unsigned EMPTY_SLOT = 0;
+    /// Slot hash value for an erased slot.
+    static const unsigned DELETED_SLOT = 1;
+    /// Minimum number of slots.
+    static const unsigned MIN_CAPACITY = 8;
+    
+    /// Construct.
+    FlatHashBase() :
+        hashes_(0),
+        buffer_(0),
+        capacity_(0),
+        size_(0),
+        numDeleted_(0)
+    {
+    }
+    
+    /// Swap with another hash set or map.
+    void Swap(FlatHashBase& rhs)
+    {
+        Urho3D::Swap(hashes_, rhs.hashes_);
+        Urho3D::Swap(buffer_, rhs.buffer_);
+        Urho3D::Swap(capacity_, rhs.capacity_);
+        Urho3D::Swap(size_, rhs.size_);
+        Urho3D::Swap(numDeleted_, rhs.numDeleted_);
+    }
+    
+    /// Return number of elements.
+    unsigned Size() const { return size_; }
+    /// Return number of slots.
+    unsigned Capacity() const { return capacity_; }
+    /// Return whether has no elements.
+    bool Empty() const { return size_ == 0; }
+    
+    /// Return whether a slot hash value denotes a live element.
+    static bool IsUsed(unsigned slotHash) { return slotHash > DELETED_SLOT; }
+    
+protected:
+    /// Convert a key hash into a slot hash value, avoiding the reserved empty and deleted values.
+    static unsigned SlotHash(unsigned hash) { return hash > DELETED_SLOT ? hash : hash + 2; }
+    
+    /// Return the first slot to probe for a slot hash value. Mixes the bits so that hashes that only differ in the high bits (pointers, StringHash) spread across the table.
+    unsigned StartIndex(unsigned slotHash) const
+    {
+        slotHash ^= slotHash >> 16;
+        slotHash *= 0x45d9f3b;
+        slotHash ^= slotHash >> 16;
+        return slotHash & (capacity_ - 1);
+    }
+    
+    /// Return whether one more element would exceed the maximum load factor of 3/4. Erased slots count towards the load, as they lengthen probe sequences.
+    bool NeedRehash() const { return (size_ + numDeleted_ + 1) * 4 > capacity_ * 3; }
+    
+    /// Return the slot count needed to hold a number of elements below the maximum load factor.
+    static unsigned CalculateCapacity(unsigned numElements)
+    {
+        unsigned capacity = MIN_CAPACITY;
+        while ((numElements + 1) * 4 > capacity * 3)
+            capacity <<= 1;
+        return capacity;
+    }
+    
+    /// Return index of the first live slot at or after an index, or capacity if none.
+    unsigned FirstUsed(unsigned index) const
+    {
+        while (index < capacity_ && !IsUsed(hashes_[index]))
+            ++index;
+        return index;
+    }
+    
+    /// Mark a slot free after its element has been destroyed. The slot can become empty again if it does not break a probe sequence.
+    void FreeSlot(unsigned index)
+    {
+        if (hashes_[(index + 1) & (capacity_ - 1)] == EMPTY_SLOT)
+            hashes_[index] = EMPTY_SLOT;
+        else
+        {
+            hashes_[index] = DELETED_SLOT;
+            ++numDeleted_;
+        }
+        --size_;
+    }
+    
+    /// Allocate new hash and slot arrays. Return the old ones to the caller for moving the elements.
+    void AllocateSlots(unsigned newCapacity, unsigned slotSize)
+    {
+        hashes_ = new unsigned[newCapacity];
+        memset(hashes_, 0, newCapacity * sizeof(unsigned));
+        buffer_ = new unsigned char[newCapacity * slotSize];
+        capacity_ = newCapacity;
+        numDeleted_ = 0;
+    }
+    
+    /// Find a free slot for a slot hash value that is known not to be present. Used when moving elements during rehash.
+    unsigned FindFreeSlot(unsigned slotHash) const
+    {
+        unsigned mask = capacity_ - 1;
+        unsigned index = StartIndex(slotHash);
+        while (hashes_[index] != EMPTY_SLOT)
+            index = (index + 1) & mask;
+        return index;
+    }
+    
+    /// Slot hash values.
+    unsigned* hashes_;
+    /// Slot storage.
+    unsigned char* buffer_;
+    /// Number of slots, zero or a power of two.
+    unsigned capacity_;
+    /// Number of live elements.
+    unsigned size_;
+    /// Number of erased slots.
+    unsigned numDeleted_;
+};
+
+}
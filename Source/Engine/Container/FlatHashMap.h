@@ -0,0 +1,440 @@
+//
+// Copyright (c) 2008-2014 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#pragma once
+
+#include "FlatHashBase.h"
+#include "Pair.h"
+#include "Vector.h"
+
+#include <new>
+
+namespace Urho3D
+{
+
+/// Open-addressing hash map template class. Stores the key-value pairs inline in a single array with linear probing, so lookups touch contiguous memory instead of chasing nodes. Iteration order is unspecified, and inserting may move the pairs, invalidating pointers, references and iterators to them. Erasing does not move other pairs.
+template <class T, class U> class FlatHashMap : public FlatHashBase
+{
+public:
+    /// Hash map key-value pair with const key.
+    class KeyValue
+    {
+    public:
+        /// Construct with default key.
+        KeyValue() :
+            first_(T())
+        {
+        }
+        
+        /// Construct with key and value.
+        KeyValue(const T& first, const U& second) :
+            first_(first),
+            second_(second)
+        {
+        }
+        
+        /// Copy-construct.
+        KeyValue(const KeyValue& value) :
+            first_(value.first_),
+            second_(value.second_)
+        {
+        }
+        
+        /// Test for equality with another pair.
+        bool operator == (const KeyValue& rhs) const { return first_ == rhs.first_ && second_ == rhs.second_; }
+        /// Test for inequality with another pair.
+        bool operator != (const KeyValue& rhs) const { return first_ != rhs.first_ || second_ != rhs.second_; }
+        
+        /// Key.
+        const T first_;
+        /// Value.
+        U second_;
+        
+    private:
+        /// Prevent assignment.
+        KeyValue& operator = (const KeyValue& rhs);
+    };
+    
+    /// Flat hash map iterator.
+    struct Iterator
+    {
+        /// Construct.
+        Iterator() :
+            ptr_(0),
+            hash_(0),
+            end_(0)
+        {
+        }
+        
+        /// Construct with slot and slot hash pointers.
+        Iterator(KeyValue* ptr, const unsigned* hash, const unsigned* end) :
+            ptr_(ptr),
+            hash_(hash),
+            end_(end)
+        {
+        }
+        
+        /// Test for equality with another iterator.
+        bool operator == (const Iterator& rhs) const { return ptr_ == rhs.ptr_; }
+        /// Test for inequality with another iterator.
+        bool operator != (const Iterator& rhs) const { return ptr_ != rhs.ptr_; }
+        /// Preincrement the pointer.
+        Iterator& operator ++ () { GotoNext(); return *this; }
+        /// Postincrement the pointer.
+        Iterator operator ++ (int) { Iterator it = *this; GotoNext(); return it; }
+        
+        /// Point to the pair.
+        KeyValue* operator -> () const { return ptr_; }
+        /// Dereference the pair.
+        KeyValue& operator * () const { return *ptr_; }
+        
+        /// Go to the next live slot.
+        void GotoNext()
+        {
+            do
+            {
+                ++ptr_;
+                ++hash_;
+            }
+            while (hash_ != end_ && !IsUsed(*hash_));
+        }
+        
+        /// Slot pointer.
+        KeyValue* ptr_;
+        /// Slot hash pointer.
+        const unsigned* hash_;
+        /// End of slot hashes.
+        const unsigned* end_;
+    };
+    
+    /// Flat hash map const iterator.
+    struct ConstIterator
+    {
+        /// Construct.
+        ConstIterator() :
+            ptr_(0),
+            hash_(0),
+            end_(0)
+        {
+        }
+        
+        /// Construct with slot and slot hash pointers.
+        ConstIterator(const KeyValue* ptr, const unsigned* hash, const unsigned* end) :
+            ptr_(ptr),
+            hash_(hash),
+            end_(end)
+        {
+        }
+        
+        /// Construct from a non-const iterator.
+        ConstIterator(const Iterator& rhs) :
+            ptr_(rhs.ptr_),
+            hash_(rhs.hash_),
+            end_(rhs.end_)
+        {
+        }
+        
+        /// Test for equality with another iterator.
+        bool operator == (const ConstIterator& rhs) const { return ptr_ == rhs.ptr_; }
+        /// Test for inequality with another iterator.
+        bool operator != (const ConstIterator& rhs) const { return ptr_ != rhs.ptr_; }
+        /// Preincrement the pointer.
+        ConstIterator& operator ++ () { GotoNext(); return *this; }
+        /// Postincrement the pointer.
+        ConstIterator operator ++ (int) { ConstIterator it = *this; GotoNext(); return it; }
+        
+        /// Point to the pair.
+        const KeyValue* operator -> () const { return ptr_; }
+        /// Dereference the pair.
+        const KeyValue& operator * () const { return *ptr_; }
+        
+        /// Go to the next live slot.
+        void GotoNext()
+        {
+            do
+            {
+                ++ptr_;
+                ++hash_;
+            }
+            while (hash_ != end_ && !IsUsed(*hash_));
+        }
+        
+        /// Slot pointer.
+        const KeyValue* ptr_;
+        /// Slot hash pointer.
+        const unsigned* hash_;
+        /// End of slot hashes.
+        const unsigned* end_;
+    };
+    
+    /// Construct empty.
+    FlatHashMap()
+    {
+    }
+    
+    /// Construct from another hash map.
+    FlatHashMap(const FlatHashMap<T, U>& map)
+    {
+        Reserve(map.Size());
+        Insert(map);
+    }
+    
+    /// Destruct.
+    ~FlatHashMap()
+    {
+        Clear();
+        delete[] hashes_;
+        delete[] buffer_;
+    }
+    
+    /// Assign a hash map.
+    FlatHashMap& operator = (const FlatHashMap<T, U>& rhs)
+    {
+        if (&rhs != this)
+        {
+            Clear();
+            Insert(rhs);
+        }
+        return *this;
+    }
+    
+    /// Add-assign a pair.
+    FlatHashMap& operator += (const Pair<T, U>& rhs)
+    {
+        Insert(rhs);
+        return *this;
+    }
+    
+    /// Add-assign a hash map.
+    FlatHashMap& operator += (const FlatHashMap<T, U>& rhs)
+    {
+        Insert(rhs);
+        return *this;
+    }
+    
+    /// Index the map. Create a new pair if key not found.
+    U& operator [] (const T& key)
+    {
+        bool existed;
+        unsigned index = InsertIndex(key, existed);
+        if (!existed)
+            new(Slots() + index) KeyValue(key, U());
+        return Slots()[index].second_;
+    }
+    
+    /// Insert a pair. Return an iterator to it.
+    Iterator Insert(const Pair<T, U>& pair)
+    {
+        bool existed;
+        unsigned index = InsertIndex(pair.first_, existed);
+        if (existed)
+            Slots()[index].second_ = pair.second_;
+        else
+            new(Slots() + index) KeyValue(pair.first_, pair.second_);
+        return MakeIterator(index);
+    }
+    
+    /// Insert a map.
+    void Insert(const FlatHashMap<T, U>& map)
+    {
+        for (ConstIterator i = map.Begin(); i != map.End(); ++i)
+            Insert(MakePair(i->first_, i->second_));
+    }
+    
+    /// Erase a pair by key. Return true if was found.
+    bool Erase(const T& key)
+    {
+        unsigned index = FindIndex(key);
+        if (index == capacity_)
+            return false;
+        
+        EraseIndex(index);
+        return true;
+    }
+    
+    /// Erase a pair by iterator. Return iterator to the next pair.
+    Iterator Erase(const Iterator& it)
+    {
+        unsigned index = (unsigned)(it.ptr_ - Slots());
+        EraseIndex(index);
+        Iterator next = MakeIterator(index);
+        next.GotoNext();
+        return next;
+    }
+    
+    /// Clear the map. Keeps the slots allocated.
+    void Clear()
+    {
+        if (!size_)
+            return;
+        
+        KeyValue* slots = Slots();
+        for (unsigned i = 0; i < capacity_; ++i)
+        {
+            if (IsUsed(hashes_[i]))
+                (slots + i)->~KeyValue();
+        }
+        memset(hashes_, 0, capacity_ * sizeof(unsigned));
+        size_ = 0;
+        numDeleted_ = 0;
+    }
+    
+    /// Reserve slots for a number of elements so that inserting them does not rehash.
+    void Reserve(unsigned numElements)
+    {
+        unsigned newCapacity = CalculateCapacity(numElements);
+        if (newCapacity > capacity_)
+            Rehash(newCapacity);
+    }
+    
+    /// Swap with another hash map.
+    void Swap(FlatHashMap<T, U>& map) { FlatHashBase::Swap(map); }
+    
+    /// Return iterator to the pair with key, or end iterator if not found.
+    Iterator Find(const T& key) { return MakeIterator(FindIndex(key)); }
+    /// Return const iterator to the pair with key, or end iterator if not found.
+    ConstIterator Find(const T& key) const { return MakeConstIterator(FindIndex(key)); }
+    /// Return whether contains a pair with key.
+    bool Contains(const T& key) const { return FindIndex(key) != capacity_; }
+    
+    /// Return all the keys.
+    Vector<T> Keys() const
+    {
+        Vector<T> result;
+        result.Reserve(size_);
+        for (ConstIterator i = Begin(); i != End(); ++i)
+            result.Push(i->first_);
+        return result;
+    }
+    
+    /// Return iterator to the beginning.
+    Iterator Begin() { return MakeIterator(FirstUsed(0)); }
+    /// Return iterator to the beginning.
+    ConstIterator Begin() const { return MakeConstIterator(FirstUsed(0)); }
+    /// Return iterator to the end.
+    Iterator End() { return MakeIterator(capacity_); }
+    /// Return iterator to the end.
+    ConstIterator End() const { return MakeConstIterator(capacity_); }
+    
+private:
+    /// Return the slot array.
+    KeyValue* Slots() const { return reinterpret_cast<KeyValue*>(buffer_); }
+    /// Return an iterator to a slot index.
+    Iterator MakeIterator(unsigned index) { return Iterator(Slots() + index, hashes_ + index, hashes_ + capacity_); }
+    /// Return a const iterator to a slot index.
+    ConstIterator MakeConstIterator(unsigned index) const { return ConstIterator(Slots() + index, hashes_ + index, hashes_ + capacity_); }
+    
+    /// Return the slot index of a key, or capacity if not found.
+    unsigned FindIndex(const T& key) const
+    {
+        if (!size_)
+            return capacity_;
+        
+        unsigned slotHash = SlotHash(MakeHash(key));
+        unsigned mask = capacity_ - 1;
+        unsigned index = StartIndex(slotHash);
+        KeyValue* slots = Slots();
+        for (;;)
+        {
+            unsigned current = hashes_[index];
+            if (current == EMPTY_SLOT)
+                return capacity_;
+            if (current == slotHash && slots[index].first_ == key)
+                return index;
+            index = (index + 1) & mask;
+        }
+    }
+    
+    /// Return the slot index of a key, reserving an unconstructed slot if it did not exist.
+    unsigned InsertIndex(const T& key, bool& existed)
+    {
+        if (NeedRehash())
+            Rehash(CalculateCapacity(size_ + 1));
+        
+        unsigned slotHash = SlotHash(MakeHash(key));
+        unsigned mask = capacity_ - 1;
+        unsigned index = StartIndex(slotHash);
+        unsigned freeIndex = capacity_;
+        KeyValue* slots = Slots();
+        for (;;)
+        {
+            unsigned current = hashes_[index];
+            if (current == EMPTY_SLOT)
+                break;
+            if (current == DELETED_SLOT)
+            {
+                if (freeIndex == capacity_)
+                    freeIndex = index;
+            }
+            else if (current == slotHash && slots[index].first_ == key)
+            {
+                existed = true;
+                return index;
+            }
+            index = (index + 1) & mask;
+        }
+        
+        if (freeIndex != capacity_)
+        {
+            index = freeIndex;
+            --numDeleted_;
+        }
+        hashes_[index] = slotHash;
+        ++size_;
+        existed = false;
+        return index;
+    }
+    
+    /// Destroy the pair in a slot and free the slot.
+    void EraseIndex(unsigned index)
+    {
+        (Slots() + index)->~KeyValue();
+        FreeSlot(index);
+    }
+    
+    /// Move the pairs into a new slot array.
+    void Rehash(unsigned newCapacity)
+    {
+        unsigned* oldHashes = hashes_;
+        unsigned char* oldBuffer = buffer_;
+        KeyValue* oldSlots = Slots();
+        unsigned oldCapacity = capacity_;
+        
+        AllocateSlots(newCapacity, sizeof(KeyValue));
+        KeyValue* slots = Slots();
+        for (unsigned i = 0; i < oldCapacity; ++i)
+        {
+            if (IsUsed(oldHashes[i]))
+            {
+                unsigned index = FindFreeSlot(oldHashes[i]);
+                hashes_[index] = oldHashes[i];
+                new(slots + index) KeyValue(oldSlots[i]);
+                (oldSlots + i)->~KeyValue();
+            }
+        }
+        
+        delete[] oldHashes;
+        delete[] oldBuffer;
+    }
+};
+
+}
@@ -0,0 +1,313 @@
+//
+// Copyright (c) 2008-2014 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#pragma once
+
+#include "FlatHashBase.h"
+#include "Vector.h"
+
+#include <new>
+
+namespace Urho3D
+{
+
+/// Open-addressing hash set template class. Stores the keys inline in a single array with linear probing. Iteration order is unspecified, and inserting may move the keys, invalidating pointers, references and iterators to them. Erasing does not move other keys.
+template <class T> class FlatHashSet : public FlatHashBase
+{
+public:
+    /// Flat hash set iterator. Keys can not be modified through it.
+    struct Iterator
+    {
+        /// Construct.
+        Iterator() :
+            ptr_(0),
+            hash_(0),
+            end_(0)
+        {
+        }
+        
+        /// Construct with slot and slot hash pointers.
+        Iterator(const T* ptr, const unsigned* hash, const unsigned* end) :
+            ptr_(ptr),
+            hash_(hash),
+            end_(end)
+        {
+        }
+        
+        /// Test for equality with another iterator.
+        bool operator == (const Iterator& rhs) const { return ptr_ == rhs.ptr_; }
+        /// Test for inequality with another iterator.
+        bool operator != (const Iterator& rhs) const { return ptr_ != rhs.ptr_; }
+        /// Preincrement the pointer.
+        Iterator& operator ++ () { GotoNext(); return *this; }
+        /// Postincrement the pointer.
+        Iterator operator ++ (int) { Iterator it = *this; GotoNext(); return it; }
+        
+        /// Point to the key.
+        const T* operator -> () const { return ptr_; }
+        /// Dereference the key.
+        const T& operator * () const { return *ptr_; }
+        
+        /// Go to the next live slot.
+        void GotoNext()
+        {
+            do
+            {
+                ++ptr_;
+                ++hash_;
+            }
+            while (hash_ != end_ && !IsUsed(*hash_));
+        }
+        
+        /// Slot pointer.
+        const T* ptr_;
+        /// Slot hash pointer.
+        const unsigned* hash_;
+        /// End of slot hashes.
+        const unsigned* end_;
+    };
+    
+    /// Flat hash set const iterator.
+    typedef Iterator ConstIterator;
+    
+    /// Construct empty.
+    FlatHashSet()
+    {
+    }
+    
+    /// Construct from another hash set.
+    FlatHashSet(const FlatHashSet<T>& set)
+    {
+        Reserve(set.Size());
+        Insert(set);
+    }
+    
+    /// Destruct.
+    ~FlatHashSet()
+    {
+        Clear();
+        delete[] hashes_;
+        delete[] buffer_;
+    }
+    
+    /// Assign a hash set.
+    FlatHashSet& operator = (const FlatHashSet<T>& rhs)
+    {
+        if (&rhs != this)
+        {
+            Clear();
+            Insert(rhs);
+        }
+        return *this;
+    }
+    
+    /// Add-assign a value.
+    FlatHashSet& operator += (const T& rhs)
+    {
+        Insert(rhs);
+        return *this;
+    }
+    
+    /// Add-assign a hash set.
+    FlatHashSet& operator += (const FlatHashSet<T>& rhs)
+    {
+        Insert(rhs);
+        return *this;
+    }
+    
+    /// Insert a key. Return an iterator to it.
+    Iterator Insert(const T& key)
+    {
+        bool existed;
+        unsigned index = InsertIndex(key, existed);
+        if (!existed)
+            new(Slots() + index) T(key);
+        return MakeIterator(index);
+    }
+    
+    /// Insert a set.
+    void Insert(const FlatHashSet<T>& set)
+    {
+        for (Iterator i = set.Begin(); i != set.End(); ++i)
+            Insert(*i);
+    }
+    
+    /// Erase a key. Return true if was found.
+    bool Erase(const T& key)
+    {
+        unsigned index = FindIndex(key);
+        if (index == capacity_)
+            return false;
+        
+        EraseIndex(index);
+        return true;
+    }
+    
+    /// Erase a key by iterator. Return iterator to the next key.
+    Iterator Erase(const Iterator& it)
+    {
+        unsigned index = (unsigned)(it.ptr_ - Slots());
+        EraseIndex(index);
+        Iterator next = MakeIterator(index);
+        next.GotoNext();
+        return next;
+    }
+    
+    /// Clear the set. Keeps the slots allocated.
+    void Clear()
+    {
+        if (!size_)
+            return;
+        
+        T* slots = Slots();
+        for (unsigned i = 0; i < capacity_; ++i)
+        {
+            if (IsUsed(hashes_[i]))
+                (slots + i)->~T();
+        }
+        memset(hashes_, 0, capacity_ * sizeof(unsigned));
+        size_ = 0;
+        numDeleted_ = 0;
+    }
+    
+    /// Reserve slots for a number of keys so that inserting them does not rehash.
+    void Reserve(unsigned numElements)
+    {
+        unsigned newCapacity = CalculateCapacity(numElements);
+        if (newCapacity > capacity_)
+            Rehash(newCapacity);
+    }
+    
+    /// Swap with another hash set.
+    void Swap(FlatHashSet<T>& set) { FlatHashBase::Swap(set); }
+    
+    /// Return iterator to the key, or end iterator if not found.
+    Iterator Find(const T& key) const { return MakeIterator(FindIndex(key)); }
+    /// Return whether contains a key.
+    bool Contains(const T& key) const { return FindIndex(key) != capacity_; }
+    
+    /// Return iterator to the beginning.
+    Iterator Begin() const { return MakeIterator(FirstUsed(0)); }
+    /// Return iterator to the end.
+    Iterator End() const { return MakeIterator(capacity_); }
+    
+private:
+    /// Return the slot array.
+    T* Slots() const { return reinterpret_cast<T*>(buffer_); }
+    /// Return an iterator to a slot index.
+    Iterator MakeIterator(unsigned index) const { return Iterator(Slots() + index, hashes_ + index, hashes_ + capacity_); }
+    
+    /// Return the slot index of a key, or capacity if not found.
+    unsigned FindIndex(const T& key) const
+    {
+        if (!size_)
+            return capacity_;
+        
+        unsigned slotHash = SlotHash(MakeHash(key));
+        unsigned mask = capacity_ - 1;
+        unsigned index = StartIndex(slotHash);
+        T* slots = Slots();
+        for (;;)
+        {
+            unsigned current = hashes_[index];
+            if (current == EMPTY_SLOT)
+                return capacity_;
+            if (current == slotHash && slots[index] == key)
+                return index;
+            index = (index + 1) & mask;
+        }
+    }
+    
+    /// Return the slot index of a key, reserving an unconstructed slot if it did not exist.
+    unsigned InsertIndex(const T& key, bool& existed)
+    {
+        if (NeedRehash())
+            Rehash(CalculateCapacity(size_ + 1));
+        
+        unsigned slotHash = SlotHash(MakeHash(key));
+        unsigned mask = capacity_ - 1;
+        unsigned index = StartIndex(slotHash);
+        unsigned freeIndex = capacity_;
+        T* slots = Slots();
+        for (;;)
+        {
+            unsigned current = hashes_[index];
+            if (current == EMPTY_SLOT)
+                break;
+            if (current == DELETED_SLOT)
+            {
+                if (freeIndex == capacity_)
+                    freeIndex = index;
+            }
+            else if (current == slotHash && slots[index] == key)
+            {
+                existed = true;
+                return index;
+            }
+            index = (index + 1) & mask;
+        }
+        
+        if (freeIndex != capacity_)
+        {
+            index = freeIndex;
+            --numDeleted_;
+        }
+        hashes_[index] = slotHash;
+        ++size_;
+        existed = false;
+        return index;
+    }
+    
+    /// Destroy the key in a slot and free the slot.
+    void EraseIndex(unsigned index)
+    {
+        (Slots() + index)->~T();
+        FreeSlot(index);
+    }
+    
+    /// Move the keys into a new slot array.
+    void Rehash(unsigned newCapacity)
+    {
+        unsigned* oldHashes = hashes_;
+        unsigned char* oldBuffer = buffer_;
+        T* oldSlots = Slots();
+        unsigned oldCapacity = capacity_;
+        
+        AllocateSlots(newCapacity, sizeof(T));
+        T* slots = Slots();
+        for (unsigned i = 0; i < oldCapacity; ++i)
+        {
+            if (IsUsed(oldHashes[i]))
+            {
+                unsigned index = FindFreeSlot(oldHashes[i]);
+                hashes_[index] = oldHashes[i];
+                new(slots + index) T(oldSlots[i]);
+                (oldSlots + i)->~T();
+            }
+        }
+        
+        delete[] oldHashes;
+        delete[] oldBuffer;
+    }
+};
+
+}
@@ -0,0 +1,170 @@
+//
+// Copyright (c) 2008-2014 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "Precompiled.h"
+#include "FrameAllocator.h"
+
+#include "DebugNew.h"
+
+namespace Urho3D
+{
+
+/// Size of the block header, rounded up so that the data area is aligned for any type.
+static const unsigned BLOCK_HEADER_SIZE = (sizeof(FrameAllocatorBlock) + 15) & ~15;
+
+static unsigned RoundUpBlockSize(unsigned size)
+{
+    unsigned ret = 1024;
+    while (ret < size)
+        ret <<= 1;
+    return ret;
+}
+
+FrameAllocator::FrameAllocator(unsigned initialSize) :
+    first_(0),
+    current_(0),
+    initialSize_(RoundUpBlockSize(initialSize)),
+    used_(0),
+    peakUse_(0),
+    underusedFrames_(0)
+{
+    AddBlock(initialSize_);
+}
+
+FrameAllocator::~FrameAllocator()
+{
+    FreeBlocks();
+}
+
+void* FrameAllocator::Allocate(unsigned size, unsigned alignment)
+{
+    for (;;)
+    {
+        unsigned char* data = reinterpret_cast<unsigned char*>(current_) + BLOCK_HEADER_SIZE;
+        size_t address = (size_t)(data + current_->used_);
+        unsigned padding = (unsigned)((alignment - (address & (alignment - 1))) & (alignment - 1));
+        
+        if (current_->used_ + padding + size <= current_->size_)
+        {
+            void* ptr = data + current_->used_ + padding;
+            current_->used_ += padding + size;
+            used_ += padding + size;
+            return ptr;
+        }
+        
+        // Overflow into a new block at least as large as the first one
+        AddBlock(RoundUpBlockSize(size + alignment > first_->size_ ? size + alignment : first_->size_));
+    }
+}
+
+bool FrameAllocator::Extend(void* ptr, unsigned oldSize, unsigned newSize)
+{
+    unsigned char* data = reinterpret_cast<unsigned char*>(current_) + BLOCK_HEADER_SIZE;
+    if ((unsigned char*)ptr + oldSize != data + current_->used_ || newSize < oldSize)
+        return false;
+    
+    unsigned grow = newSize - oldSize;
+    if (current_->used_ + grow > current_->size_)
+        return false;
+    
+    current_->used_ += grow;
+    used_ += grow;
+    return true;
+}
+
+void FrameAllocator::Reset()
+{
+    if (used_ > peakUse_)
+        peakUse_ = used_;
+    
+    if (first_->next_)
+    {
+        // The frame did not fit: make the single block large enough for it, so that the next similar frame does not
+        // overflow
+        FreeBlocks();
+        AddBlock(RoundUpBlockSize(peakUse_));
+        underusedFrames_ = 0;
+    }
+    else
+    {
+        // After a spike, return the memory once usage has stayed low for long enough
+        if (first_->size_ > initialSize_ && peakUse_ < first_->size_ / 4)
+        {
+            if (++underusedFrames_ >= SHRINK_FRAMES)
+            {
+                unsigned newSize = RoundUpBlockSize(peakUse_ * 2);
+                FreeBlocks();
+                AddBlock(newSize > initialSize_ ? newSize : initialSize_);
+                underusedFrames_ = 0;
+                peakUse_ = 0;
+            }
+        }
+        else
+        {
+            underusedFrames_ = 0;
+            // Let the peak follow recent frames, so that a past spike does not prevent shrinking forever
+            if (first_->size_ > initialSize_)
+                peakUse_ = used_;
+        }
+        
+        first_->used_ = 0;
+    }
+    
+    used_ = 0;
+}
+
+unsigned FrameAllocator::GetCapacity() const
+{
+    unsigned capacity = 0;
+    for (FrameAllocatorBlock* block = first_; block; block = block->next_)
+        capacity += block->size_;
+    return capacity;
+}
+
+void FrameAllocator::AddBlock(unsigned size)
+{
+    FrameAllocatorBlock* block = reinterpret_cast<FrameAllocatorBlock*>(new unsigned char[BLOCK_HEADER_SIZE + size]);
+    block->next_ = 0;
+    block->size_ = size;
+    block->used_ = 0;
+    
+    if (current_)
+        current_->next_ = block;
+    else
+        first_ = block;
+    current_ = block;
+}
+
+void FrameAllocator::FreeBlocks()
+{
+    FrameAllocatorBlock* block = first_;
+    while (block)
+    {
+        FrameAllocatorBlock* next = block->next_;
+        delete[] reinterpret_cast<unsigned char*>(block);
+        block = next;
+    }
+    
+    first_ = current_ = 0;
+}
+
+}
@@ -0,0 +1,95 @@
+//
+// Copyright (c) 2008-2014 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#pragma once
+
+#include "Urho3D.h"
+
+namespace Urho3D
+{
+
+/// %Frame allocator memory block.
+struct FrameAllocatorBlock
+{
+    /// Next block.
+    FrameAllocatorBlock* next_;
+    /// Size of the data area.
+    unsigned size_;
+    /// Bytes used from the data area.
+    unsigned used_;
+    /// Data follows.
+};
+
+/// Linear allocator for scratch data that lives at most until the end of the frame. Allocation bumps a pointer, individual frees are not possible, and Reset() releases everything at once. Not thread-safe: use one allocator per thread.
+class URHO3D_API FrameAllocator
+{
+public:
+    /// Construct with initial block size.
+    FrameAllocator(unsigned initialSize = DEFAULT_SIZE);
+    /// Destruct. Free all blocks.
+    ~FrameAllocator();
+    
+    /// Allocate memory. Never returns null. Alignment must be a power of two.
+    void* Allocate(unsigned size, unsigned alignment = sizeof(void*));
+    /// Try to grow an allocation in place. Succeeds only for the most recent allocation when the block has room.
+    bool Extend(void* ptr, unsigned oldSize, unsigned newSize);
+    /// Release all allocations. If the frame overflowed into extra blocks, replace them with a single block large enough for the frame. If the usage has stayed well below the block size for a while, shrink the block back.
+    void Reset();
+    
+    /// Return bytes allocated since the last reset, including alignment padding.
+    unsigned GetUsed() const { return used_; }
+    /// Return total size of the blocks.
+    unsigned GetCapacity() const;
+    /// Return the recent peak per-frame usage.
+    unsigned GetPeakUse() const { return peakUse_; }
+    
+    /// Default initial block size.
+    static const unsigned DEFAULT_SIZE = 64 * 1024;
+    /// Number of consecutive underused frames before the block is shrunk.
+    static const unsigned SHRINK_FRAMES = 256;
+    
+private:
+    /// Prevent copy construction.
+    FrameAllocator(const FrameAllocator& rhs);
+    /// Prevent assignment.
+    FrameAllocator& operator = (const FrameAllocator& rhs);
+    
+    /// Allocate a new block and make it current.
+    void AddBlock(unsigned size);
+    /// Free all blocks.
+    void FreeBlocks();
+    
+    /// First block.
+    FrameAllocatorBlock* first_;
+    /// Block being allocated from.
+    FrameAllocatorBlock* current_;
+    /// Initial block size. The block is never shrunk below it.
+    unsigned initialSize_;
+    /// Bytes allocated since the last reset.
+    unsigned used_;
+    /// Recent peak per-frame usage.
+    unsigned peakUse_;
+    /// Number of consecutive frames which used less than a quarter of the block.
+    unsigned underusedFrames_;
+};
+
+}
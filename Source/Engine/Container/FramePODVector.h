@@ -0,0 +1,198 @@
+//
+// Copyright (c) 2008-2014 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#pragma once
+
+#include "FrameAllocator.h"
+#include "VectorBase.h"
+
+#include <cassert>
+#include <cstring>
+
+namespace Urho3D
+{
+
+/// %Vector template class for POD types that allocates its buffer from a FrameAllocator. The contents become invalid when the allocator is reset, after which SetAllocator() must be called before use. Growing extends the buffer in place when it is the allocator's latest allocation, otherwise the old buffer is abandoned until the reset.
+template <class T> class FramePODVector
+{
+public:
+    typedef RandomAccessIterator<T> Iterator;
+    typedef RandomAccessConstIterator<T> ConstIterator;
+    
+    /// Construct empty without an allocator.
+    FramePODVector() :
+        allocator_(0),
+        buffer_(0),
+        size_(0),
+        capacity_(0)
+    {
+    }
+    
+    /// Construct empty with an allocator.
+    explicit FramePODVector(FrameAllocator* allocator) :
+        allocator_(allocator),
+        buffer_(0),
+        size_(0),
+        capacity_(0)
+    {
+    }
+    
+    /// Copy-construct. The copy allocates from the same allocator.
+    FramePODVector(const FramePODVector<T>& vector) :
+        allocator_(vector.allocator_),
+        buffer_(0),
+        size_(0),
+        capacity_(0)
+    {
+        *this = vector;
+    }
+    
+    /// Assign from another vector. Keeps the current allocator if one is set.
+    FramePODVector<T>& operator = (const FramePODVector<T>& rhs)
+    {
+        if (&rhs != this)
+        {
+            if (!allocator_)
+                allocator_ = rhs.allocator_;
+            size_ = 0;
+            Push(rhs.buffer_, rhs.size_);
+        }
+        return *this;
+    }
+    
+    /// Set the allocator and forget the current contents without touching their memory. Call after the allocator has been reset.
+    void SetAllocator(FrameAllocator* allocator)
+    {
+        allocator_ = allocator;
+        buffer_ = 0;
+        size_ = 0;
+        capacity_ = 0;
+    }
+    
+    /// Add an element at the end.
+    void Push(const T& value)
+    {
+        if (size_ == capacity_)
+            Grow(size_ + 1);
+        buffer_[size_++] = value;
+    }
+    
+    /// Add elements at the end.
+    void Push(const T* values, unsigned count)
+    {
+        if (size_ + count > capacity_)
+            Grow(size_ + count);
+        if (count)
+            memcpy(buffer_ + size_, values, count * sizeof(T));
+        size_ += count;
+    }
+    
+    /// Remove the last element.
+    void Pop()
+    {
+        if (size_)
+            --size_;
+    }
+    
+    /// Resize the vector. New elements are uninitialized.
+    void Resize(unsigned newSize)
+    {
+        if (newSize > capacity_)
+            Grow(newSize);
+        size_ = newSize;
+    }
+    
+    /// Set new capacity.
+    void Reserve(unsigned newCapacity)
+    {
+        if (newCapacity > capacity_)
+            Reallocate(newCapacity);
+    }
+    
+    /// Clear the vector. Keeps the buffer for reuse until the allocator is reset.
+    void Clear() { size_ = 0; }
+    
+    /// Return element at index.
+    T& operator [] (unsigned index) { assert(index < size_); return buffer_[index]; }
+    /// Return const element at index.
+    const T& operator [] (unsigned index) const { assert(index < size_); return buffer_[index]; }
+    /// Return iterator to the beginning.
+    Iterator Begin() { return Iterator(buffer_); }
+    /// Return const iterator to the beginning.
+    ConstIterator Begin() const { return ConstIterator(buffer_); }
+    /// Return iterator to the end.
+    Iterator End() { return Iterator(buffer_ + size_); }
+    /// Return const iterator to the end.
+    ConstIterator End() const { return ConstIterator(buffer_ + size_); }
+    /// Return last element.
+    T& Back() { assert(size_); return buffer_[size_ - 1]; }
+    /// Return const last element.
+    const T& Back() const { assert(size_); return buffer_[size_ - 1]; }
+    /// Return the buffer.
+    T* Buffer() const { return buffer_; }
+    /// Return number of elements.
+    unsigned Size() const { return size_; }
+    /// Return capacity.
+    unsigned Capacity() const { return capacity_; }
+    /// Return whether vector is empty.
+    bool Empty() const { return size_ == 0; }
+    /// Return the allocator.
+    FrameAllocator* GetAllocator() const { return allocator_; }
+    
+private:
+    /// Grow the capacity to hold at least the requested amount of elements.
+    void Grow(unsigned minCapacity)
+    {
+        unsigned newCapacity = capacity_ ? capacity_ : 16;
+        while (newCapacity < minCapacity)
+            newCapacity += (newCapacity + 1) >> 1;
+        Reallocate(newCapacity);
+    }
+    
+    /// Change the capacity, in place if possible.
+    void Reallocate(unsigned newCapacity)
+    {
+        assert(allocator_);
+        if (buffer_ && allocator_->Extend(buffer_, capacity_ * sizeof(T), newCapacity * sizeof(T)))
+        {
+            capacity_ = newCapacity;
+            return;
+        }
+        
+        T* newBuffer = reinterpret_cast<T*>(allocator_->Allocate(newCapacity * sizeof(T), sizeof(T) < 16 ? sizeof(void*) : 16));
+        if (size_)
+            memcpy(newBuffer, buffer_, size_ * sizeof(T));
+        buffer_ = newBuffer;
+        capacity_ = newCapacity;
+    }
+    
+    /// Allocator.
+    FrameAllocator* allocator_;
+    /// Buffer.
+    T* buffer_;
+    /// Number of elements.
+    unsigned size_;
+    /// Buffer capacity.
+    unsigned capacity_;
+};
+
+}
@@ -0,0 +1,109 @@
+//
+// Copyright (c) 2008-2014 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#pragma once
+
+#include "Urho3D.h"
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace Urho3D
+{
+
+/// Atomically add to an integer and return the new value. Acts as a full memory barrier.
+inline int AtomicAdd(volatile int* dest, int value)
+{
+#ifdef _MSC_VER
+    return _InterlockedExchangeAdd((volatile long*)dest, value) + value;
+#else
+    return __sync_add_and_fetch(dest, value);
+#endif
+}
+
+/// Atomically increment an integer and return the new value.
+inline int AtomicIncrement(volatile int* dest) { return AtomicAdd(dest, 1); }
+/// Atomically decrement an integer and return the new value.
+inline int AtomicDecrement(volatile int* dest) { return AtomicAdd(dest, -1); }
+
+/// Store an integer with release semantics: memory writes before the store become visible to other threads before it.
+inline void AtomicStoreRelease(volatile int* dest, int value)
+{
+#ifdef _MSC_VER
+    // Volatile stores have release semantics on the supported compilers, so only compiler reordering must be prevented
+    _ReadWriteBarrier();
+    *dest = value;
+#else
+    __sync_synchronize();
+    *dest = value;
+#endif
+}
+
+/// Full memory barrier. Neither the compiler nor the CPU moves memory accesses across it.
+inline void AtomicMemoryBarrier()
+{
+#ifdef _MSC_VER
+    long barrier = 0;
+    _InterlockedExchange(&barrier, 0);
+#else
+    __sync_synchronize();
+#endif
+}
+
+/// Atomically replace an integer with a new value if it equals the expected value. Return true if replaced.
+inline bool AtomicCompareExchange(volatile int* dest, int expected, int value)
+{
+#ifdef _MSC_VER
+    return _InterlockedCompareExchange((volatile long*)dest, value, expected) == expected;
+#else
+    return __sync_bool_compare_and_swap(dest, expected, value);
+#endif
+}
+
+/// Atomically replace a pointer with a new value if it equals the expected value. Return true if replaced.
+inline bool AtomicCompareExchangePointer(void* volatile* dest, void* expected, void* value)
+{
+#ifdef _MSC_VER
+    return _InterlockedCompareExchangePointer(dest, value, expected) == expected;
+#else
+    return __sync_bool_compare_and_swap(dest, expected, value);
+#endif
+}
+
+/// Atomically replace a pointer with a new value and return the old value.
+inline void* AtomicExchangePointer(void* volatile* dest, void* value)
+{
+#ifdef _MSC_VER
+    return _InterlockedExchangePointer(dest, value);
+#else
+    void* old;
+    do
+    {
+        old = *dest;
+    }
+    while (!__sync_bool_compare_and_swap(dest, old, value));
+    return old;
+#endif
+}
+
+}
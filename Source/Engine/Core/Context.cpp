@@ -1,258 +1,476 @@
-//
-// Copyright (c) 2008-2014 the Urho3D project.
-//
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-//
-// The above copyright notice and this permission notice shall be included in
-// all copies or substantial portions of the Software.
-//
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
-// THE SOFTWARE.
-//
-
-#include "Precompiled.h"
-#include "Context.h"
-#include "Thread.h"
-
-#include "DebugNew.h"
-
-namespace Urho3D
-{
-
-void RemoveNamedAttribute(HashMap<StringHash, Vector<AttributeInfo> >& attributes, StringHash objectType, const char* name)
-{
-    HashMap<StringHash, Vector<AttributeInfo> >::Iterator i = attributes.Find(objectType);
-    if (i == attributes.End())
-        return;
-
-    Vector<AttributeInfo>& infos = i->second_;
-
-    for (Vector<AttributeInfo>::Iterator j = infos.Begin(); j != infos.End(); ++j)
-    {
-        if (!j->name_.Compare(name, true))
-        {
-            infos.Erase(j);
-            break;
-        }
-    }
-
-    // If the vector became empty, erase the object type from the map
-    if (infos.Empty())
-        attributes.Erase(i);
-}
-
-Context::Context() :
-    eventHandler_(0)
-{
-    #ifdef ANDROID
-    // Always reset the random seed on Android, as the Urho3D library might not be unloaded between runs
-    SetRandomSeed(1);
-    #endif
-    
-    // Set the main thread ID (assuming the Context is created in it)
-    Thread::SetMainThread();
-}
-
-Context::~Context()
-{
-    // Remove subsystems that use SDL in reverse order of construction, so that Graphics can shut down SDL last
-    /// \todo Context should not need to know about subsystems
-    RemoveSubsystem("Audio");
-    RemoveSubsystem("UI");
-    RemoveSubsystem("Input");
-    RemoveSubsystem("Renderer");
-    RemoveSubsystem("Graphics");
-    
-    subsystems_.Clear();
-    factories_.Clear();
-    
-    // Delete allocated event data maps
-    for (PODVector<VariantMap*>::Iterator i = eventDataMaps_.Begin(); i != eventDataMaps_.End(); ++i)
-        delete *i;
-    eventDataMaps_.Clear();
-}
-
-SharedPtr<Object> Context::CreateObject(StringHash objectType)
-{
-    HashMap<StringHash, SharedPtr<ObjectFactory> >::ConstIterator i = factories_.Find(objectType);
-    if (i != factories_.End())
-        return i->second_->CreateObject();
-    else
-        return SharedPtr<Object>();
-}
-
-void Context::RegisterFactory(ObjectFactory* factory)
-{
-    if (!factory)
-        return;
-
-    factories_[factory->GetType()] = factory;
-}
-
-void Context::RegisterFactory(ObjectFactory* factory, const char* category)
-{
-    if (!factory)
-        return;
-
-    RegisterFactory(factory);
-    if (String::CStringLength(category))
-        objectCategories_[category].Push(factory->GetType());
-}
-
-void Context::RegisterSubsystem(Object* object)
-{
-    if (!object)
-        return;
-
-    subsystems_[object->GetType()] = object;
-}
-
-void Context::RemoveSubsystem(StringHash objectType)
-{
-    HashMap<StringHash, SharedPtr<Object> >::Iterator i = subsystems_.Find(objectType);
-    if (i != subsystems_.End())
-        subsystems_.Erase(i);
-}
-
-void Context::RegisterAttribute(StringHash objectType, const AttributeInfo& attr)
-{
-    // None or pointer types can not be supported
-    if (attr.type_ == VAR_NONE || attr.type_ == VAR_VOIDPTR || attr.type_ == VAR_PTR)
-        return;
-
-    attributes_[objectType].Push(attr);
-
-    if (attr.mode_ & AM_NET)
-        networkAttributes_[objectType].Push(attr);
-}
-
-void Context::RemoveAttribute(StringHash objectType, const char* name)
-{
-    RemoveNamedAttribute(attributes_, objectType, name);
-    RemoveNamedAttribute(networkAttributes_, objectType, name);
-}
-
-void Context::UpdateAttributeDefaultValue(StringHash objectType, const char* name, const Variant& defaultValue)
-{
-    AttributeInfo* info = GetAttribute(objectType, name);
-    if (info)
-        info->defaultValue_ = defaultValue;
-}
-
-VariantMap& Context::GetEventDataMap()
-{
-    unsigned nestingLevel = eventSenders_.Size();
-    while (eventDataMaps_.Size() < nestingLevel + 1)
-        eventDataMaps_.Push(new VariantMap());
-    
-    VariantMap& ret = *eventDataMaps_[nestingLevel];
-    ret.Clear();
-    return ret;
-}
-
-
-void Context::CopyBaseAttributes(StringHash baseType, StringHash derivedType)
-{
-    const Vector<AttributeInfo>* baseAttributes = GetAttributes(baseType);
-    if (baseAttributes)
-    {
-        for (unsigned i = 0; i < baseAttributes->Size(); ++i)
-        {
-            const AttributeInfo& attr = baseAttributes->At(i);
-            attributes_[derivedType].Push(attr);
-            if (attr.mode_ & AM_NET)
-                networkAttributes_[derivedType].Push(attr);
-        }
-    }
-}
-
-Object* Context::GetSubsystem(StringHash type) const
-{
-    HashMap<StringHash, SharedPtr<Object> >::ConstIterator i = subsystems_.Find(type);
-    if (i != subsystems_.End())
-        return i->second_;
-    else
-        return 0;
-}
-
-Object* Context::GetEventSender() const
-{
-    if (!eventSenders_.Empty())
-        return eventSenders_.Back();
-    else
-        return 0;
-}
-
-const String& Context::GetTypeName(StringHash objectType) const
-{
-    // Search factories to find the hash-to-name mapping
-    HashMap<StringHash, SharedPtr<ObjectFactory> >::ConstIterator i = factories_.Find(objectType);
-    return i != factories_.End() ? i->second_->GetTypeName() : String::EMPTY;
-}
-
-AttributeInfo* Context::GetAttribute(StringHash objectType, const char* name)
-{
-    HashMap<StringHash, Vector<AttributeInfo> >::Iterator i = attributes_.Find(objectType);
-    if (i == attributes_.End())
-        return 0;
-
-    Vector<AttributeInfo>& infos = i->second_;
-
-    for (Vector<AttributeInfo>::Iterator j = infos.Begin(); j != infos.End(); ++j)
-    {
-        if (!j->name_.Compare(name, true))
-            return &(*j);
-    }
-
-    return 0;
-}
-
-void Context::AddEventReceiver(Object* receiver, StringHash eventType)
-{
-    eventReceivers_[eventType].Insert(receiver);
-}
-
-void Context::AddEventReceiver(Object* receiver, Object* sender, StringHash eventType)
-{
-    specificEventReceivers_[sender][eventType].Insert(receiver);
-}
-
-void Context::RemoveEventSender(Object* sender)
-{
-    HashMap<Object*, HashMap<StringHash, HashSet<Object*> > >::Iterator i = specificEventReceivers_.Find(sender);
-    if (i != specificEventReceivers_.End())
-    {
-        for (HashMap<StringHash, HashSet<Object*> >::Iterator j = i->second_.Begin(); j != i->second_.End(); ++j)
-        {
-            for (HashSet<Object*>::Iterator k = j->second_.Begin(); k != j->second_.End(); ++k)
-                (*k)->RemoveEventSender(sender);
-        }
-        specificEventReceivers_.Erase(i);
-    }
-}
-
-void Context::RemoveEventReceiver(Object* receiver, StringHash eventType)
-{
-    HashSet<Object*>* group = GetEventReceivers(eventType);
-    if (group)
-        group->Erase(receiver);
-}
-
-void Context::RemoveEventReceiver(Object* receiver, Object* sender, StringHash eventType)
-{
-    HashSet<Object*>* group = GetEventReceivers(sender, eventType);
-    if (group)
-        group->Erase(receiver);
-}
-
-}
+//
+// Copyright (c) 2008-2014 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "Precompiled.h"
+#include "Atomic.h"
+#include "Context.h"
+#include "Log.h"
+#include "Thread.h"
+
+#include "DebugNew.h"
+
+namespace Urho3D
+{
+
+/// Event posted from any thread, waiting to be sent on the main thread.
+struct PostedEvent
+{
+    /// Next event. Points to the previously posted event until the events are collected, to the next pending event after.
+    PostedEvent* next_;
+    /// Sender. Null if the sender has been destroyed.
+    Object* sender_;
+    /// Event type.
+    StringHash eventType_;
+    /// Copied event data.
+    VariantMap eventData_;
+};
+
+void RemoveNamedAttribute(HashMap<StringHash, Vector<AttributeInfo> >& attributes, StringHash objectType, const char* name)
+{
+    HashMap<StringHash, Vector<AttributeInfo> >::Iterator i = attributes.Find(objectType);
+    if (i == attributes.End())
+        return;
+
+    Vector<AttributeInfo>& infos = i->second_;
+
+    for (Vector<AttributeInfo>::Iterator j = infos.Begin(); j != infos.End(); ++j)
+    {
+        if (!j->name_.Compare(name, true))
+        {
+            infos.Erase(j);
+            break;
+        }
+    }
+
+    // If the vector became empty, erase the object type from the map
+    if (infos.Empty())
+        attributes.Erase(i);
+}
+
+void EventReceiverGroup::EndSendEvent()
+{
+    assert(inSend_ > 0);
+    --inSend_;
+    
+    if (!inSend_ && dirty_)
+    {
+        // Compact in place, preserving the order of the remaining receivers
+        unsigned dest = 0;
+        for (unsigned i = 0; i < receivers_.Size(); ++i)
+        {
+            if (receivers_[i].receiver_)
+            {
+                if (dest != i)
+                {
+                    receivers_[dest] = receivers_[i];
+                    indices_[receivers_[dest].receiver_] = dest;
+                }
+                ++dest;
+            }
+        }
+        receivers_.Resize(dest);
+        dirty_ = false;
+    }
+}
+
+void EventReceiverGroup::Add(Object* receiver, EventHandler* handler)
+{
+    FlatHashMap<Object*, unsigned>::Iterator i = indices_.Find(receiver);
+    if (i != indices_.End())
+    {
+        receivers_[i->second_].handler_ = handler;
+        return;
+    }
+    
+    EventReceiver entry;
+    entry.receiver_ = receiver;
+    entry.handler_ = handler;
+    indices_[receiver] = receivers_.Size();
+    receivers_.Push(entry);
+}
+
+void EventReceiverGroup::Remove(Object* receiver)
+{
+    FlatHashMap<Object*, unsigned>::Iterator i = indices_.Find(receiver);
+    if (i == indices_.End())
+        return;
+    
+    unsigned index = i->second_;
+    indices_.Erase(i);
+    
+    // Senders iterate by index, so do not move entries while sending
+    if (inSend_)
+    {
+        receivers_[index].receiver_ = 0;
+        receivers_[index].handler_ = 0;
+        dirty_ = true;
+    }
+    else
+    {
+        unsigned last = receivers_.Size() - 1;
+        if (index != last)
+        {
+            receivers_[index] = receivers_[last];
+            indices_[receivers_[index].receiver_] = index;
+        }
+        receivers_.Pop();
+    }
+}
+
+Context::Context() :
+    postedEvents_(0),
+    pendingPostedEvents_(0),
+    lastPendingPostedEvent_(0),
+    eventHandler_(0)
+{
+    #ifdef ANDROID
+    // Always reset the random seed on Android, as the Urho3D library might not be unloaded between runs
+    SetRandomSeed(1);
+    #endif
+    
+    // Set the main thread ID (assuming the Context is created in it)
+    Thread::SetMainThread();
+}
+
+Context::~Context()
+{
+    // Send the events posted before destruction while the subsystems still exist, so that none are lost when the Engine
+    // main loop is not run or has already exited
+    if (Thread::IsMainThread())
+        SendPostedEvents();
+    
+    // Remove subsystems that use SDL in reverse order of construction, so that Graphics can shut down SDL last
+    /// \todo Context should not need to know about subsystems
+    RemoveSubsystem("Audio");
+    RemoveSubsystem("UI");
+    RemoveSubsystem("Input");
+    RemoveSubsystem("Renderer");
+    RemoveSubsystem("Graphics");
+    
+    subsystems_.Clear();
+    factories_.Clear();
+    
+    // Delete allocated event data maps
+    for (PODVector<VariantMap*>::Iterator i = eventDataMaps_.Begin(); i != eventDataMaps_.End(); ++i)
+        delete *i;
+    eventDataMaps_.Clear();
+    for (PODVector<VariantMap*>::Iterator i = convertedEventDataMaps_.Begin(); i != convertedEventDataMaps_.End(); ++i)
+        delete *i;
+    convertedEventDataMaps_.Clear();
+    
+    // Delete the events posted during subsystem removal, as their receivers may no longer exist
+    CollectPostedEvents();
+    while (pendingPostedEvents_)
+    {
+        PostedEvent* next = pendingPostedEvents_->next_;
+        delete pendingPostedEvents_;
+        pendingPostedEvents_ = next;
+    }
+}
+
+SharedPtr<Object> Context::CreateObject(StringHash objectType)
+{
+    HashMap<StringHash, SharedPtr<ObjectFactory> >::ConstIterator i = factories_.Find(objectType);
+    if (i != factories_.End())
+        return i->second_->CreateObject();
+    else
+        return SharedPtr<Object>();
+}
+
+void Context::RegisterFactory(ObjectFactory* factory)
+{
+    if (!factory)
+        return;
+
+    factories_[factory->GetType()] = factory;
+}
+
+void Context::RegisterFactory(ObjectFactory* factory, const char* category)
+{
+    if (!factory)
+        return;
+
+    RegisterFactory(factory);
+    if (String::CStringLength(category))
+        objectCategories_[category].Push(factory->GetType());
+}
+
+void Context::RegisterSubsystem(Object* object)
+{
+    if (!object)
+        return;
+
+    subsystems_[object->GetType()] = object;
+}
+
+void Context::RemoveSubsystem(StringHash objectType)
+{
+    HashMap<StringHash, SharedPtr<Object> >::Iterator i = subsystems_.Find(objectType);
+    if (i != subsystems_.End())
+        subsystems_.Erase(i);
+}
+
+void Context::RegisterAttribute(StringHash objectType, const AttributeInfo& attr)
+{
+    // None or pointer types can not be supported
+    if (attr.type_ == VAR_NONE || attr.type_ == VAR_VOIDPTR || attr.type_ == VAR_PTR)
+        return;
+
+    attributes_[objectType].Push(attr);
+
+    if (attr.mode_ & AM_NET)
+        networkAttributes_[objectType].Push(attr);
+}
+
+void Context::RemoveAttribute(StringHash objectType, const char* name)
+{
+    RemoveNamedAttribute(attributes_, objectType, name);
+    RemoveNamedAttribute(networkAttributes_, objectType, name);
+}
+
+void Context::UpdateAttributeDefaultValue(StringHash objectType, const char* name, const Variant& defaultValue)
+{
+    AttributeInfo* info = GetAttribute(objectType, name);
+    if (info)
+        info->defaultValue_ = defaultValue;
+}
+
+VariantMap& Context::GetEventDataMap()
+{
+    unsigned nestingLevel = eventSenders_.Size();
+    while (eventDataMaps_.Size() < nestingLevel + 1)
+        eventDataMaps_.Push(new VariantMap());
+    
+    VariantMap& ret = *eventDataMaps_[nestingLevel];
+    ret.Clear();
+    return ret;
+}
+
+void Context::SendPostedEvents()
+{
+    if (!Thread::IsMainThread())
+    {
+        LOGERROR("Sending posted events is only supported from the main thread");
+        return;
+    }
+    
+    if (!postedEvents_ && !pendingPostedEvents_)
+        return;
+    
+    // Send only the events posted so far. Events posted during sending wait for the next call
+    PostedEvent* last;
+    {
+        MutexLock lock(postedEventsMutex_);
+        CollectPostedEvents();
+        last = lastPendingPostedEvent_;
+    }
+    
+    for (;;)
+    {
+        PostedEvent* event;
+        {
+            // Take one event at a time, as event handlers may destroy senders and cancel their pending events
+            MutexLock lock(postedEventsMutex_);
+            event = pendingPostedEvents_;
+            if (!event)
+                break;
+            pendingPostedEvents_ = event->next_;
+            if (!pendingPostedEvents_)
+                lastPendingPostedEvent_ = 0;
+        }
+        
+        bool isLast = event == last;
+        if (event->sender_)
+            event->sender_->SendEvent(event->eventType_, event->eventData_);
+        delete event;
+        
+        if (isLast)
+            break;
+    }
+}
+
+void Context::PostEvent(Object* sender, StringHash eventType, const VariantMap& eventData)
+{
+    PostedEvent* event = new PostedEvent();
+    event->sender_ = sender;
+    event->eventType_ = eventType;
+    event->eventData_ = eventData;
+    
+    // Push to the front of the posted events. Only whole lists are taken by the consumer, so there is no ABA problem
+    void* volatile* head = reinterpret_cast<void* volatile*>(&postedEvents_);
+    do
+    {
+        event->next_ = postedEvents_;
+    }
+    while (!AtomicCompareExchangePointer(head, event->next_, event));
+}
+
+void Context::RemovePostedEvents(Object* sender)
+{
+    if (!postedEvents_ && !pendingPostedEvents_)
+        return;
+    
+    MutexLock lock(postedEventsMutex_);
+    CollectPostedEvents();
+    for (PostedEvent* event = pendingPostedEvents_; event; event = event->next_)
+    {
+        if (event->sender_ == sender)
+            event->sender_ = 0;
+    }
+}
+
+void Context::CollectPostedEvents()
+{
+    PostedEvent* event = static_cast<PostedEvent*>(AtomicExchangePointer(reinterpret_cast<void* volatile*>(&postedEvents_), 0));
+    if (!event)
+        return;
+    
+    // The taken list is newest first: reverse it and append to the pending events
+    PostedEvent* first = 0;
+    PostedEvent* last = event;
+    while (event)
+    {
+        PostedEvent* next = event->next_;
+        event->next_ = first;
+        first = event;
+        event = next;
+    }
+    
+    if (lastPendingPostedEvent_)
+        lastPendingPostedEvent_->next_ = first;
+    else
+        pendingPostedEvents_ = first;
+    lastPendingPostedEvent_ = last;
+}
+
+VariantMap& Context::GetConvertedEventDataMap()
+{
+    // The sender of the event being converted is already on the sender stack
+    unsigned nestingLevel = eventSenders_.Size() ? eventSenders_.Size() - 1 : 0;
+    while (convertedEventDataMaps_.Size() < nestingLevel + 1)
+        convertedEventDataMaps_.Push(new VariantMap());
+    
+    VariantMap& ret = *convertedEventDataMaps_[nestingLevel];
+    ret.Clear();
+    return ret;
+}
+
+
+void Context::CopyBaseAttributes(StringHash baseType, StringHash derivedType)
+{
+    const Vector<AttributeInfo>* baseAttributes = GetAttributes(baseType);
+    if (baseAttributes)
+    {
+        for (unsigned i = 0; i < baseAttributes->Size(); ++i)
+        {
+            const AttributeInfo& attr = baseAttributes->At(i);
+            attributes_[derivedType].Push(attr);
+            if (attr.mode_ & AM_NET)
+                networkAttributes_[derivedType].Push(attr);
+        }
+    }
+}
+
+Object* Context::GetSubsystem(StringHash type) const
+{
+    HashMap<StringHash, SharedPtr<Object> >::ConstIterator i = subsystems_.Find(type);
+    if (i != subsystems_.End())
+        return i->second_;
+    else
+        return 0;
+}
+
+Object* Context::GetEventSender() const
+{
+    if (!eventSenders_.Empty())
+        return eventSenders_.Back();
+    else
+        return 0;
+}
+
+const String& Context::GetTypeName(StringHash objectType) const
+{
+    // Search factories to find the hash-to-name mapping
+    HashMap<StringHash, SharedPtr<ObjectFactory> >::ConstIterator i = factories_.Find(objectType);
+    return i != factories_.End() ? i->second_->GetTypeName() : String::EMPTY;
+}
+
+AttributeInfo* Context::GetAttribute(StringHash objectType, const char* name)
+{
+    HashMap<StringHash, Vector<AttributeInfo> >::Iterator i = attributes_.Find(objectType);
+    if (i == attributes_.End())
+        return 0;
+
+    Vector<AttributeInfo>& infos = i->second_;
+
+    for (Vector<AttributeInfo>::Iterator j = infos.Begin(); j != infos.End(); ++j)
+    {
+        if (!j->name_.Compare(name, true))
+            return &(*j);
+    }
+
+    return 0;
+}
+
+void Context::AddEventReceiver(Object* receiver, StringHash eventType, EventHandler* handler)
+{
+    eventReceivers_[eventType].Add(receiver, handler);
+}
+
+void Context::AddEventReceiver(Object* receiver, Object* sender, StringHash eventType, EventHandler* handler)
+{
+    specificEventReceivers_[sender][eventType].Add(receiver, handler);
+}
+
+void Context::RemoveEventSender(Object* sender)
+{
+    HashMap<Object*, HashMap<StringHash, EventReceiverGroup> >::Iterator i = specificEventReceivers_.Find(sender);
+    if (i != specificEventReceivers_.End())
+    {
+        for (HashMap<StringHash, EventReceiverGroup>::Iterator j = i->second_.Begin(); j != i->second_.End(); ++j)
+        {
+            const PODVector<EventReceiver>& receivers = j->second_.receivers_;
+            for (PODVector<EventReceiver>::ConstIterator k = receivers.Begin(); k != receivers.End(); ++k)
+            {
+                if (k->receiver_)
+                    k->receiver_->RemoveEventSender(sender);
+            }
+        }
+        specificEventReceivers_.Erase(i);
+    }
+}
+
+void Context::RemoveEventReceiver(Object* receiver, StringHash eventType)
+{
+    EventReceiverGroup* group = GetEventReceivers(eventType);
+    if (group)
+        group->Remove(receiver);
+}
+
+void Context::RemoveEventReceiver(Object* receiver, Object* sender, StringHash eventType)
+{
+    EventReceiverGroup* group = GetEventReceivers(sender, eventType);
+    if (group)
+        group->Remove(receiver);
+}
+
+}
@@ -1,359 +1,575 @@
-//
-// Copyright (c) 2008-2014 the Urho3D project.
-//
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-//
-// The above copyright notice and this permission notice shall be included in
-// all copies or substantial portions of the Software.
-//
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
-// THE SOFTWARE.
-//
-
-#include "Precompiled.h"
-#include "CoreEvents.h"
-#include "Log.h"
-#include "ProcessUtils.h"
-#include "Profiler.h"
-#include "Thread.h"
-#include "Timer.h"
-#include "WorkQueue.h"
-
-namespace Urho3D
-{
-
-/// Worker thread managed by the work queue.
-class WorkerThread : public Thread, public RefCounted
-{
-public:
-    /// Construct.
-    WorkerThread(WorkQueue* owner, unsigned index) :
-        owner_(owner),
-        index_(index)
-    {
-    }
-    
-    /// Process work items until stopped.
-    virtual void ThreadFunction()
-    {
-        // Init FPU state first
-        InitFPU();
-        owner_->ProcessItems(index_);
-    }
-    
-    /// Return thread index.
-    unsigned GetIndex() const { return index_; }
-    
-private:
-    /// Work queue.
-    WorkQueue* owner_;
-    /// Thread index.
-    unsigned index_;
-};
-
-WorkQueue::WorkQueue(Context* context) :
-    Object(context),
-    shutDown_(false),
-    pausing_(false),
-    paused_(false),
-    tolerance_(10),
-    lastSize_(0),
-    maxNonThreadedWorkMs_(5)
-{
-    SubscribeToEvent(E_BEGINFRAME, HANDLER(WorkQueue, HandleBeginFrame));
-}
-
-WorkQueue::~WorkQueue()
-{
-    // Stop the worker threads. First make sure they are not waiting for work items
-    shutDown_ = true;
-    Resume();
-    
-    for (unsigned i = 0; i < threads_.Size(); ++i)
-        threads_[i]->Stop();
-}
-
-void WorkQueue::CreateThreads(unsigned numThreads)
-{
-    // Other subsystems may initialize themselves according to the number of threads.
-    // Therefore allow creating the threads only once, after which the amount is fixed
-    if (!threads_.Empty())
-        return;
-    
-    // Start threads in paused mode
-    Pause();
-    
-    for (unsigned i = 0; i < numThreads; ++i)
-    {
-        SharedPtr<WorkerThread> thread(new WorkerThread(this, i + 1));
-        thread->Run();
-        threads_.Push(thread);
-    }
-}
-
-SharedPtr<WorkItem> WorkQueue::GetFreeItem()
-{
-    if (poolItems_.Size() > 0)
-    {
-        SharedPtr<WorkItem> item = poolItems_.Front();
-        poolItems_.PopFront();
-        return item;
-    }
-    else
-    {
-        // No usable items found, create a new one set it as pooled and return it.
-        SharedPtr<WorkItem> item(new WorkItem());
-        item->pooled_ = true;
-        return item;
-    }
-}
-
-void WorkQueue::AddWorkItem(SharedPtr<WorkItem> item)
-{
-    if (!item)
-    {
-        LOGERROR("Null work item submitted to the work queue");
-        return;
-    }
-    
-    // Check for duplicate items.
-    assert(!workItems_.Contains(item));
-    
-    // Push to the main thread list to keep item alive
-    // Clear completed flag in case item is reused
-    workItems_.Push(item);
-    item->completed_ = false;
-
-    // Make sure worker threads' list is safe to modify
-    if (threads_.Size() && !paused_)
-        queueMutex_.Acquire();
-    
-    // Find position for new item
-    if (queue_.Empty())
-        queue_.Push(item);
-    else
-    {
-        for (List<WorkItem*>::Iterator i = queue_.Begin(); i != queue_.End(); ++i)
-        {
-            if ((*i)->priority_ <= item->priority_)
-            {
-                queue_.Insert(i, item);
-                break;
-            }
-        }
-    }
-    
-    if (threads_.Size())
-    {
-        queueMutex_.Release();
-        paused_ = false;
-    }
-}
-
-void WorkQueue::Pause()
-{
-    if (!paused_)
-    {
-        pausing_ = true;
-        
-        queueMutex_.Acquire();
-        paused_ = true;
-        
-        pausing_ = false;
-    }
-}
-
-void WorkQueue::Resume()
-{
-    if (paused_)
-    {
-        queueMutex_.Release();
-        paused_ = false;
-    }
-}
-
-
-void WorkQueue::Complete(unsigned priority)
-{
-    if (threads_.Size())
-    {
-        Resume();
-        
-        // Take work items also in the main thread until queue empty or no high-priority items anymore
-        while (!queue_.Empty())
-        {
-            queueMutex_.Acquire();
-            if (!queue_.Empty() && queue_.Front()->priority_ >= priority)
-            {
-                WorkItem* item = queue_.Front();
-                queue_.PopFront();
-                queueMutex_.Release();
-                item->workFunction_(item, 0);
-                item->completed_ = true;
-            }
-            else
-            {
-                queueMutex_.Release();
-                break;
-            }
-        }
-        
-        // Wait for threaded work to complete
-        while (!IsCompleted(priority))
-        {
-        }
-        
-        // If no work at all remaining, pause worker threads by leaving the mutex locked
-        if (queue_.Empty())
-            Pause();
-    }
-    else
-    {
-        // No worker threads: ensure all high-priority items are completed in the main thread
-        while (!queue_.Empty() && queue_.Front()->priority_ >= priority)
-        {
-            WorkItem* item = queue_.Front();
-            queue_.PopFront();
-            item->workFunction_(item, 0);
-            item->completed_ = true;
-        }
-    }
-    
-    PurgeCompleted(priority);
-}
-
-bool WorkQueue::IsCompleted(unsigned priority) const
-{
-    for (List<SharedPtr<WorkItem> >::ConstIterator i = workItems_.Begin(); i != workItems_.End(); ++i)
-    {
-        if ((*i)->priority_ >= priority && !(*i)->completed_)
-            return false;
-    }
-    
-    return true;
-}
-
-void WorkQueue::ProcessItems(unsigned threadIndex)
-{
-    bool wasActive = false;
-    
-    for (;;)
-    {
-        if (shutDown_)
-            return;
-        
-        if (pausing_ && !wasActive)
-            Time::Sleep(0);
-        else
-        {
-            queueMutex_.Acquire();
-            if (!queue_.Empty())
-            {
-                wasActive = true;
-                
-                WorkItem* item = queue_.Front();
-                queue_.PopFront();
-                queueMutex_.Release();
-                item->workFunction_(item, threadIndex);
-                item->completed_ = true;
-            }
-            else
-            {
-                wasActive = false;
-                
-                queueMutex_.Release();
-                Time::Sleep(0);
-            }
-        }
-    }
-}
-
-void WorkQueue::PurgeCompleted(unsigned priority)
-{
-    // Purge completed work items and send completion events. Do not signal items lower than priority threshold,
-    // as those may be user submitted and lead to eg. scene manipulation that could happen in the middle of the
-    // render update, which is not allowed
-    for (List<SharedPtr<WorkItem> >::Iterator i = workItems_.Begin(); i != workItems_.End();)
-    {
-        if ((*i)->completed_ && (*i)->priority_ >= priority)
-        {
-            if ((*i)->sendEvent_)
-            {
-                using namespace WorkItemCompleted;
-                
-                VariantMap& eventData = GetEventDataMap();
-                eventData[P_ITEM] = i->Get();
-                SendEvent(E_WORKITEMCOMPLETED, eventData);
-            }
-
-            // Check if this was a pooled item and set it to usable
-            if ((*i)->pooled_)
-            {
-                // Reset the values to their defaults. This should 
-                // be safe to do here as the completed event has 
-                // already been handled and this is part of the 
-                // internal pool.
-                (*i)->start_ = NULL;
-                (*i)->end_ = NULL;
-                (*i)->aux_ = NULL;
-                (*i)->workFunction_ = NULL;
-                (*i)->priority_ = M_MAX_UNSIGNED;
-                (*i)->sendEvent_ = false;
-                (*i)->completed_ = false;
-
-                poolItems_.Push(*i);
-            }
-
-            i = workItems_.Erase(i);
-        }
-        else
-            ++i;
-    }
-}
-
-void WorkQueue::PurgePool()
-{
-    unsigned int currentSize = poolItems_.Size();
-    int difference = lastSize_ - currentSize;
-
-    // Difference tolerance, should be fairly significant to reduce the pool size.
-    for (unsigned i = 0; poolItems_.Size() > 0 && difference > tolerance_ && i < (unsigned)difference; i++)
-        poolItems_.PopFront();
-
-    lastSize_ = currentSize;
-}
-
-void WorkQueue::HandleBeginFrame(StringHash eventType, VariantMap& eventData)
-{
-    // If no worker threads, complete low-priority work here
-    if (threads_.Empty() && !queue_.Empty())
-    {
-        PROFILE(CompleteWorkNonthreaded);
-        
-        HiresTimer timer;
-        
-        while (!queue_.Empty() && timer.GetUSec(false) < maxNonThreadedWorkMs_ * 1000)
-        {
-            WorkItem* item = queue_.Front();
-            queue_.PopFront();
-            item->workFunction_(item, 0);
-            item->completed_ = true;
-        }
-    }
-    
-    // Complete and signal items down to the lowest priority
-    PurgeCompleted(0);
-    PurgePool();
-}
-
-}
+//
+// Copyright (c) 2008-2014 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "Precompiled.h"
+#include "Atomic.h"
+#include "CoreEvents.h"
+#include "Log.h"
+#include "ProcessUtils.h"
+#include "Profiler.h"
+#include "Thread.h"
+#include "Timer.h"
+#include "WorkQueue.h"
+
+namespace Urho3D
+{
+
+/// Batches per thread when splitting a parallel for. Using more than one lets idle threads steal work from slower ones.
+static const unsigned BATCHES_PER_THREAD = 4;
+
+/// Worker thread managed by the work queue.
+class WorkerThread : public Thread, public RefCounted
+{
+public:
+    /// Construct.
+    WorkerThread(WorkQueue* owner, unsigned index) :
+        owner_(owner),
+        index_(index)
+    {
+    }
+    
+    /// Process work items until stopped.
+    virtual void ThreadFunction()
+    {
+        // Init FPU state first
+        InitFPU();
+        owner_->ProcessItems(index_);
+    }
+    
+    /// Return thread index.
+    unsigned GetIndex() const { return index_; }
+    
+private:
+    /// Work queue.
+    WorkQueue* owner_;
+    /// Thread index.
+    unsigned index_;
+};
+
+/// Maximum number of empty priority buckets to keep in a work item queue for reuse.
+static const unsigned MAX_EMPTY_BUCKETS = 4;
+
+/// Work item queue owned by one thread. Items are kept in per-priority FIFO buckets, highest priority first. Other threads steal from it when they run out of work.
+class WorkStealingQueue : public RefCounted
+{
+public:
+    /// Construct.
+    WorkStealingQueue() :
+        numItems_(0),
+        topPriority_(0)
+    {
+    }
+    
+    /// Append an item to the bucket of its priority.
+    void Push(WorkItem* item)
+    {
+        MutexLock lock(mutex_);
+        
+        // There are only a few distinct priorities in use, so a linear search over the buckets is enough
+        unsigned i = 0;
+        while (i < buckets_.Size() && buckets_[i].priority_ > item->priority_)
+            ++i;
+        if (i == buckets_.Size() || buckets_[i].priority_ != item->priority_)
+        {
+            buckets_.Insert(i, PriorityBucket());
+            buckets_[i].priority_ = item->priority_;
+        }
+        
+        buckets_[i].items_.Push(item);
+        ++numItems_;
+        UpdateTopPriority();
+    }
+    
+    /// Remove and return the oldest item of the highest priority if it has at least the specified priority, or null if none.
+    WorkItem* Pop(unsigned priority)
+    {
+        // Check without locking first to avoid contending for queues that are empty
+        if (!HasItems(priority))
+            return 0;
+        
+        MutexLock lock(mutex_);
+        
+        for (unsigned i = 0; i < buckets_.Size(); ++i)
+        {
+            PriorityBucket& bucket = buckets_[i];
+            if (bucket.head_ == bucket.items_.Size())
+                continue;
+            if (bucket.priority_ < priority)
+                return 0;
+            
+            WorkItem* item = bucket.items_[bucket.head_++];
+            if (bucket.head_ == bucket.items_.Size())
+            {
+                bucket.items_.Clear();
+                bucket.head_ = 0;
+                if (buckets_.Size() > MAX_EMPTY_BUCKETS)
+                    buckets_.Erase(i);
+            }
+            --numItems_;
+            UpdateTopPriority();
+            return item;
+        }
+        
+        return 0;
+    }
+    
+    /// Return whether has items with at least the specified priority. Does not lock, so the result is only a hint.
+    bool HasItems(unsigned priority) const { return numItems_ && topPriority_ >= priority; }
+    /// Return the highest queued priority. Only meaningful when has items. Does not lock.
+    unsigned GetTopPriority() const { return topPriority_; }
+    
+private:
+    /// Queued items of one priority.
+    struct PriorityBucket
+    {
+        /// Construct.
+        PriorityBucket() :
+            priority_(0),
+            head_(0)
+        {
+        }
+        
+        /// Priority.
+        unsigned priority_;
+        /// Items in submission order.
+        PODVector<WorkItem*> items_;
+        /// Index of the next item to take.
+        unsigned head_;
+    };
+    
+    /// Update the highest queued priority. Called with the mutex held.
+    void UpdateTopPriority()
+    {
+        for (unsigned i = 0; i < buckets_.Size(); ++i)
+        {
+            if (buckets_[i].head_ < buckets_[i].items_.Size())
+            {
+                topPriority_ = buckets_[i].priority_;
+                return;
+            }
+        }
+        topPriority_ = 0;
+    }
+    
+    /// Queue mutex.
+    Mutex mutex_;
+    /// Priority buckets in descending priority order.
+    Vector<PriorityBucket> buckets_;
+    /// Number of queued items, readable without locking.
+    volatile unsigned numItems_;
+    /// Highest queued priority, readable without locking.
+    volatile unsigned topPriority_;
+};
+
+WorkQueue::WorkQueue(Context* context) :
+    Object(context),
+    numQueuedItems_(0),
+    numWaiters_(0),
+    nextQueue_(0),
+    shutDown_(false),
+    paused_(false),
+    tolerance_(10),
+    lastSize_(0),
+    maxNonThreadedWorkMs_(5)
+{
+    // Queue for the main thread
+    queues_.Push(SharedPtr<WorkStealingQueue>(new WorkStealingQueue()));
+    frameAllocators_.Push(new FrameAllocator());
+    
+    SubscribeToEvent(E_BEGINFRAME, HANDLER(WorkQueue, HandleBeginFrame));
+    SubscribeToEvent(E_ENDFRAME, HANDLER(WorkQueue, HandleEndFrame));
+}
+
+WorkQueue::~WorkQueue()
+{
+    // Stop the worker threads. First make sure they are not waiting for work items
+    shutDown_ = true;
+    Resume();
+    
+    for (unsigned i = 0; i < threads_.Size(); ++i)
+        threads_[i]->Stop();
+    
+    for (unsigned i = 0; i < frameAllocators_.Size(); ++i)
+        delete frameAllocators_[i];
+}
+
+void WorkQueue::CreateThreads(unsigned numThreads)
+{
+    // Other subsystems may initialize themselves according to the number of threads.
+    // Therefore allow creating the threads only once, after which the amount is fixed
+    if (!threads_.Empty())
+        return;
+    
+    // Start threads in paused mode
+    Pause();
+    
+    // Create all queues before any thread starts stealing from them
+    for (unsigned i = 0; i < numThreads; ++i)
+    {
+        queues_.Push(SharedPtr<WorkStealingQueue>(new WorkStealingQueue()));
+        frameAllocators_.Push(new FrameAllocator());
+    }
+    
+    for (unsigned i = 0; i < numThreads; ++i)
+    {
+        SharedPtr<WorkerThread> thread(new WorkerThread(this, i + 1));
+        thread->Run();
+        threads_.Push(thread);
+    }
+}
+
+SharedPtr<WorkItem> WorkQueue::GetFreeItem()
+{
+    if (poolItems_.Size() > 0)
+    {
+        SharedPtr<WorkItem> item = poolItems_.Back();
+        poolItems_.Pop();
+        return item;
+    }
+    else
+    {
+        // No usable items found, create a new one set it as pooled and return it.
+        SharedPtr<WorkItem> item(new WorkItem());
+        item->pooled_ = true;
+        return item;
+    }
+}
+
+void WorkQueue::AddWorkItem(SharedPtr<WorkItem> item)
+{
+    if (!item)
+    {
+        LOGERROR("Null work item submitted to the work queue");
+        return;
+    }
+    
+    if (item->parent_ && item->parent_->completed_)
+    {
+        LOGERROR("Work item submitted with an already completed parent");
+        return;
+    }
+    
+    // Check for duplicate items.
+    assert(!workItems_.Contains(item));
+    
+    // Push to the main thread list to keep item alive
+    // Clear completed flag in case item is reused
+    workItems_.Push(item);
+    item->completed_ = false;
+    
+    // The parent now has to wait for this item as well. The parent's own job keeps it pending until it has executed
+    if (item->parent_)
+        AtomicIncrement(&item->parent_->pendingJobs_);
+    
+    // Distribute items evenly to the thread queues. Only this queue's owner and possible thieves contend for its lock
+    AtomicIncrement(&numQueuedItems_);
+    queues_[nextQueue_]->Push(item);
+    if (++nextQueue_ >= queues_.Size())
+        nextQueue_ = 0;
+    
+    Resume();
+}
+
+void WorkQueue::Pause()
+{
+    if (!paused_)
+    {
+        pauseMutex_.Acquire();
+        paused_ = true;
+    }
+}
+
+void WorkQueue::Resume()
+{
+    if (paused_)
+    {
+        paused_ = false;
+        pauseMutex_.Release();
+    }
+}
+
+
+void WorkQueue::Complete(unsigned priority)
+{
+    if (threads_.Size())
+    {
+        Resume();
+        
+        // Take work items also in the main thread until queue empty or no high-priority items anymore
+        while (WorkItem* item = TakeItem(0, priority))
+            ExecuteItem(item, 0);
+        
+        // Wait for threaded work to complete
+        while (!IsCompleted(priority))
+        {
+        }
+        
+        // If no work at all remaining, pause worker threads by leaving the mutex locked
+        if (!numQueuedItems_)
+            Pause();
+    }
+    else
+    {
+        // No worker threads: ensure all high-priority items are completed in the main thread
+        while (WorkItem* item = TakeItem(0, priority))
+            ExecuteItem(item, 0);
+    }
+    
+    PurgeCompleted(priority);
+}
+
+void WorkQueue::Wait(WorkItem* item)
+{
+    if (!item || item->completed_)
+        return;
+    
+    // An item that is neither completed nor in the work item collection was never submitted, and would never complete
+    bool queued = false;
+    for (List<SharedPtr<WorkItem> >::ConstIterator i = workItems_.Begin(); i != workItems_.End(); ++i)
+    {
+        if (i->Get() == item)
+        {
+            queued = true;
+            break;
+        }
+    }
+    if (!queued)
+    {
+        LOGERROR("Waited for a work item that was never submitted");
+        return;
+    }
+    
+    Resume();
+    
+    while (!item->completed_)
+    {
+        // Help with the work. Without worker threads the item's children may have any priority, so take everything
+        WorkItem* work = TakeItem(0, threads_.Size() ? item->priority_ : 0);
+        if (work)
+        {
+            ExecuteItem(work, 0);
+            continue;
+        }
+        
+        if (!threads_.Size())
+        {
+            LOGERROR("Waited for a work item whose children were not submitted");
+            break;
+        }
+        
+        // Nothing left to help with: block until a worker thread completes an item. Registering as a waiter is a full
+        // barrier, so either the completed flag is seen here or the completing thread sees the waiter and sets the event
+        AtomicIncrement(&numWaiters_);
+        if (!item->completed_)
+            completedEvent_.Wait();
+        AtomicDecrement(&numWaiters_);
+    }
+}
+
+unsigned WorkQueue::GetNumBatches(unsigned count, unsigned grainSize) const
+{
+    if (threads_.Empty())
+        return 1;
+    
+    unsigned maxBatches = (threads_.Size() + 1) * BATCHES_PER_THREAD;
+    unsigned numBatches = count / (grainSize ? grainSize : 1);
+    return numBatches < 1 ? 1 : (numBatches > maxBatches ? maxBatches : numBatches);
+}
+
+bool WorkQueue::IsCompleted(unsigned priority) const
+{
+    for (List<SharedPtr<WorkItem> >::ConstIterator i = workItems_.Begin(); i != workItems_.End(); ++i)
+    {
+        if ((*i)->priority_ >= priority && !(*i)->completed_)
+            return false;
+    }
+    
+    return true;
+}
+
+WorkItem* WorkQueue::TakeItem(unsigned threadIndex, unsigned priority)
+{
+    unsigned numQueues = queues_.Size();
+    
+    for (;;)
+    {
+        // Take from the queue holding the highest priority work, preferring the thread's own queue on ties, so that high
+        // priority work queued elsewhere is not left waiting behind lower priority local work
+        WorkStealingQueue* best = 0;
+        unsigned bestPriority = 0;
+        for (unsigned i = 0; i < numQueues; ++i)
+        {
+            WorkStealingQueue* queue = queues_[(threadIndex + i) % numQueues];
+            if (queue->HasItems(priority) && (!best || queue->GetTopPriority() > bestPriority))
+            {
+                best = queue;
+                bestPriority = queue->GetTopPriority();
+            }
+        }
+        
+        if (!best)
+            return 0;
+        
+        // The queue may have been emptied by another thread in the meanwhile, in which case look again
+        WorkItem* item = best->Pop(priority);
+        if (item)
+        {
+            AtomicDecrement(&numQueuedItems_);
+            return item;
+        }
+    }
+}
+
+void WorkQueue::ExecuteItem(WorkItem* item, unsigned threadIndex)
+{
+    item->workFunction_(item, threadIndex);
+    FinishJob(item);
+}
+
+void WorkQueue::FinishJob(WorkItem* item)
+{
+    // The last finished job completes the item, and in turn finishes one job of the parent
+    bool completed = false;
+    while (item && !AtomicDecrement(&item->pendingJobs_))
+    {
+        WorkItem* parent = item->parent_;
+        item->completed_ = true;
+        completed = true;
+        item = parent;
+    }
+    
+    // Wake up the main thread if it is blocked in Wait(). Reading the waiter count atomically orders it after the completed flag
+    if (completed && AtomicAdd(&numWaiters_, 0))
+        completedEvent_.Set();
+}
+
+void WorkQueue::ProcessItems(unsigned threadIndex)
+{
+    for (;;)
+    {
+        if (shutDown_)
+            return;
+        
+        WorkItem* item = TakeItem(threadIndex, 0);
+        if (item)
+            ExecuteItem(item, threadIndex);
+        else if (paused_)
+        {
+            // Block until the main thread resumes the workers
+            pauseMutex_.Acquire();
+            pauseMutex_.Release();
+        }
+        else
+            Time::Sleep(0);
+    }
+}
+
+void WorkQueue::PurgeCompleted(unsigned priority)
+{
+    // Purge completed work items and send completion events. Do not signal items lower than priority threshold,
+    // as those may be user submitted and lead to eg. scene manipulation that could happen in the middle of the
+    // render update, which is not allowed
+    for (List<SharedPtr<WorkItem> >::Iterator i = workItems_.Begin(); i != workItems_.End();)
+    {
+        if ((*i)->completed_ && (*i)->priority_ >= priority)
+        {
+            if ((*i)->sendEvent_)
+            {
+                using namespace WorkItemCompleted;
+                
+                VariantMap& eventData = GetEventDataMap();
+                eventData[P_ITEM] = i->Get();
+                SendEvent(E_WORKITEMCOMPLETED, eventData);
+            }
+
+            // Check if this was a pooled item and set it to usable
+            if ((*i)->pooled_)
+            {
+                // Reset the values to their defaults. This should 
+                // be safe to do here as the completed event has 
+                // already been handled and this is part of the 
+                // internal pool.
+                (*i)->start_ = NULL;
+                (*i)->end_ = NULL;
+                (*i)->aux_ = NULL;
+                (*i)->workFunction_ = NULL;
+                (*i)->priority_ = M_MAX_UNSIGNED;
+                (*i)->sendEvent_ = false;
+                (*i)->completed_ = false;
+                (*i)->parent_ = 0;
+
+                poolItems_.Push(*i);
+            }
+            
+            // Make the item's own job pending again in case it is resubmitted
+            (*i)->pendingJobs_ = 1;
+
+            i = workItems_.Erase(i);
+        }
+        else
+            ++i;
+    }
+}
+
+void WorkQueue::PurgePool()
+{
+    unsigned int currentSize = poolItems_.Size();
+    int difference = lastSize_ - currentSize;
+
+    // Difference tolerance, should be fairly significant to reduce the pool size.
+    for (unsigned i = 0; poolItems_.Size() > 0 && difference > tolerance_ && i < (unsigned)difference; i++)
+        poolItems_.Pop();
+
+    lastSize_ = currentSize;
+}
+
+void WorkQueue::HandleBeginFrame(StringHash eventType, VariantMap& eventData)
+{
+    // If no worker threads, complete low-priority work here
+    if (threads_.Empty() && numQueuedItems_)
+    {
+        PROFILE(CompleteWorkNonthreaded);
+        
+        HiresTimer timer;
+        
+        while (timer.GetUSec(false) < maxNonThreadedWorkMs_ * 1000)
+        {
+            WorkItem* item = TakeItem(0, 0);
+            if (!item)
+                break;
+            ExecuteItem(item, 0);
+        }
+    }
+    
+    // Complete and signal items down to the lowest priority
+    PurgeCompleted(0);
+    PurgePool();
+}
+
+void WorkQueue::HandleEndFrame(StringHash eventType, VariantMap& eventData)
+{
+    // Priority work has been completed by now, so no thread is using its frame allocator
+    for (unsigned i = 0; i < frameAllocators_.Size(); ++i)
+        frameAllocators_[i]->Reset();
+}
+
+}
@@ -1,147 +1,230 @@
-//
-// Copyright (c) 2008-2014 the Urho3D project.
-//
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-//
-// The above copyright notice and this permission notice shall be included in
-// all copies or substantial portions of the Software.
-//
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
-// THE SOFTWARE.
-//
-
-#pragma once
-
-#include "List.h"
-#include "Mutex.h"
-#include "Object.h"
-
-namespace Urho3D
-{
-
-/// Work item completed event.
-EVENT(E_WORKITEMCOMPLETED, WorkItemCompleted)
-{
-    PARAM(P_ITEM, Item);                        // WorkItem ptr
-}
-
-class WorkerThread;
-
-/// Work queue item.
-struct WorkItem : public RefCounted
-{
-    friend class WorkQueue;
-
-public:
-    // Construct
-    WorkItem() :
-        priority_(0),
-        sendEvent_(false),
-        completed_(false),
-        pooled_(false)
-    {
-    }
-    
-    /// Work function. Called with the work item and thread index (0 = main thread) as parameters.
-    void (*workFunction_)(const WorkItem*, unsigned);
-    /// Data start pointer.
-    void* start_;
-    /// Data end pointer.
-    void* end_;
-    /// Auxiliary data pointer.
-    void* aux_;
-    /// Priority. Higher value = will be completed first.
-    unsigned priority_;
-    /// Whether to send event on completion.
-    bool sendEvent_;
-    /// Completed flag.
-    volatile bool completed_;
-
-private:
-    bool pooled_;
-};
-
-/// Work queue subsystem for multithreading.
-class URHO3D_API WorkQueue : public Object
-{
-    OBJECT(WorkQueue);
-    
-    friend class WorkerThread;
-    
-public:
-    /// Construct.
-    WorkQueue(Context* context);
-    /// Destruct.
-    ~WorkQueue();
-    
-    /// Create worker threads. Can only be called once.
-    void CreateThreads(unsigned numThreads);
-    /// Get pointer to an usable WorkItem from the item pool. Allocate one if no more free items.
-    SharedPtr<WorkItem> GetFreeItem();
-    /// Add a work item and resume worker threads.
-    void AddWorkItem(SharedPtr<WorkItem> item);
-    /// Pause worker threads.
-    void Pause();
-    /// Resume worker threads.
-    void Resume();
-    /// Finish all queued work which has at least the specified priority. Main thread will also execute priority work. Pause worker threads if no more work remains.
-    void Complete(unsigned priority);
-    /// Set the pool telerance before it starts deleting pool items.
-    void SetTolerance(int tolerance) { tolerance_ = tolerance; }
-    /// Set how many milliseconds maximum per frame to spend on low-priority work, when there are no worker threads.
-    void SetNonThreadedWorkMs(int ms) { maxNonThreadedWorkMs_ = Max(ms, 1); }
-    
-    /// Return number of worker threads.
-    unsigned GetNumThreads() const { return threads_.Size(); }
-    /// Return whether all work with at least the specified priority is finished.
-    bool IsCompleted(unsigned priority) const;
-    /// Return the pool tolerance.
-    int GetTolerance() const { return tolerance_; }
-    /// Return how many milliseconds maximum to spend on non-threaded low-priority work.
-    int GetNonThreadedWorkMs() const { return maxNonThreadedWorkMs_; }
-    
-private:
-    /// Process work items until shut down. Called by the worker threads.
-    void ProcessItems(unsigned threadIndex);
-    /// Purge completed work items which have at least the specified priority, and send completion events as necessary.
-    void PurgeCompleted(unsigned priority);
-    /// Purge the pool to reduce allocation where its unneeded.
-    void PurgePool();
-    /// Handle frame start event. Purge completed work from the main thread queue, and perform work if no threads at all.
-    void HandleBeginFrame(StringHash eventType, VariantMap& eventData);
-    
-    /// Worker threads.
-    Vector<SharedPtr<WorkerThread> > threads_;
-    /// Work item pool for reuse to cut down on allocation. The bool is a flag for item pooling and whether it is available or not.
-    List<SharedPtr<WorkItem> > poolItems_;
-    /// Work item collection. Accessed only by the main thread.
-    List<SharedPtr<WorkItem> > workItems_;
-    /// Work item prioritized queue for worker threads. Pointers are guaranteed to be valid (point to workItems.)
-    List<WorkItem*> queue_;
-    /// Worker queue mutex.
-    Mutex queueMutex_;
-    /// Shutting down flag.
-    volatile bool shutDown_;
-    /// Pausing flag. Indicates the worker threads should not contend for the queue mutex.
-    volatile bool pausing_;
-    /// Paused flag. Indicates the queue mutex being locked to prevent worker threads using up CPU time.
-    bool paused_;
-    /// Tolerance for the shared pool before it begins to deallocate.
-    int tolerance_;
-    /// Last size of the shared pool.
-    unsigned lastSize_;
-    /// Maximum milliseconds per frame to spend on low-priority work, when there are no worker threads.
-    int maxNonThreadedWorkMs_;
-};
-
-}
+//
+// Copyright (c) 2008-2014 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#pragma once
+
+#include "Condition.h"
+#include "FrameAllocator.h"
+#include "List.h"
+#include "Mutex.h"
+#include "Object.h"
+#include "Vector.h"
+
+namespace Urho3D
+{
+
+/// Work item completed event.
+EVENT(E_WORKITEMCOMPLETED, WorkItemCompleted)
+{
+    PARAM(P_ITEM, Item);                        // WorkItem ptr
+}
+
+class WorkerThread;
+class WorkStealingQueue;
+
+/// Work queue item.
+struct WorkItem : public RefCounted
+{
+    friend class WorkQueue;
+
+public:
+    // Construct
+    WorkItem() :
+        priority_(0),
+        sendEvent_(false),
+        completed_(false),
+        parent_(0),
+        pendingJobs_(1),
+        pooled_(false)
+    {
+    }
+    
+    /// Work function. Called with the work item and thread index (0 = main thread) as parameters.
+    void (*workFunction_)(const WorkItem*, unsigned);
+    /// Data start pointer.
+    void* start_;
+    /// Data end pointer.
+    void* end_;
+    /// Auxiliary data pointer.
+    void* aux_;
+    /// Priority. Higher value = will be completed first.
+    unsigned priority_;
+    /// Whether to send event on completion.
+    bool sendEvent_;
+    /// Completed flag. Set when both the item and all of its children have finished.
+    volatile bool completed_;
+    /// Parent item, which is not considered completed before this item is. Submit children before the parent, as the parent may otherwise complete first.
+    WorkItem* parent_;
+
+private:
+    /// Number of unfinished jobs: the item itself and its children.
+    volatile int pendingJobs_;
+    /// Pooled flag.
+    bool pooled_;
+};
+
+/// Work function for executing a functor over a range of a parallel for.
+template <class T, class F> void ParallelForWork(const WorkItem* item, unsigned threadIndex)
+{
+    const F& functor = *reinterpret_cast<const F*>(item->aux_);
+    functor(reinterpret_cast<T*>(item->start_), reinterpret_cast<T*>(item->end_), threadIndex);
+}
+
+/// Work queue subsystem for multithreading. Each thread owns a work item queue and steals from the others when it runs out of work.
+class URHO3D_API WorkQueue : public Object
+{
+    OBJECT(WorkQueue);
+    
+    friend class WorkerThread;
+    
+public:
+    /// Construct.
+    WorkQueue(Context* context);
+    /// Destruct.
+    ~WorkQueue();
+    
+    /// Create worker threads. Can only be called once.
+    void CreateThreads(unsigned numThreads);
+    /// Get pointer to an usable WorkItem from the item pool. Allocate one if no more free items.
+    SharedPtr<WorkItem> GetFreeItem();
+    /// Add a work item and resume worker threads. If the item has a parent, the parent will not complete before the item does. Must be called from the main thread.
+    void AddWorkItem(SharedPtr<WorkItem> item);
+    /// Pause worker threads.
+    void Pause();
+    /// Resume worker threads.
+    void Resume();
+    /// Finish all queued work which has at least the specified priority. Main thread will also execute priority work. Pause worker threads if no more work remains.
+    void Complete(unsigned priority);
+    /// Process a range in parallel and complete all priority work before returning. The functor is called as functor(start, end, threadIndex) for each batch, and should keep any output per thread index.
+    template <class T, class F> void ParallelFor(T* start, T* end, unsigned grainSize, const F& functor)
+    {
+        AddParallelWork(start, end, grainSize, functor);
+        Complete(M_MAX_UNSIGNED);
+    }
+    /// Process a vector in parallel and complete all priority work before returning.
+    template <class T, class F> void ParallelFor(PODVector<T>& range, unsigned grainSize, const F& functor)
+    {
+        ParallelFor(range.Begin().ptr_, range.End().ptr_, grainSize, functor);
+    }
+    /// Split a range into priority work items of at least grainSize elements without waiting for them. The functor must stay valid until the work is completed. If the range is too small to split, process it immediately in the calling thread.
+    template <class T, class F> void AddParallelWork(T* start, T* end, unsigned grainSize, const F& functor)
+    {
+        unsigned count = end - start;
+        if (!count)
+            return;
+        
+        unsigned numBatches = GetNumBatches(count, grainSize);
+        if (numBatches == 1)
+        {
+            functor(start, end, 0);
+            return;
+        }
+        
+        // Distribute the remainder one element at a time to the first batches
+        unsigned batchSize = count / numBatches;
+        unsigned remainder = count % numBatches;
+        for (unsigned i = 0; i < numBatches; ++i)
+        {
+            T* batchEnd = start + batchSize + (i < remainder ? 1 : 0);
+            
+            SharedPtr<WorkItem> item = GetFreeItem();
+            item->priority_ = M_MAX_UNSIGNED;
+            item->workFunction_ = ParallelForWork<T, F>;
+            item->start_ = (void*)start;
+            item->end_ = (void*)batchEnd;
+            item->aux_ = (void*)&functor;
+            AddWorkItem(item);
+            
+            start = batchEnd;
+        }
+    }
+    /// Wait until a work item and all of its children have finished. Main thread will also execute work of at least the item's priority while waiting, and otherwise blocks until worker threads complete work. Return immediately with an error if the item was never submitted.
+    void Wait(WorkItem* item);
+    /// Set the pool telerance before it starts deleting pool items.
+    void SetTolerance(int tolerance) { tolerance_ = tolerance; }
+    /// Set how many milliseconds maximum per frame to spend on low-priority work, when there are no worker threads.
+    void SetNonThreadedWorkMs(int ms) { maxNonThreadedWorkMs_ = Max(ms, 1); }
+    
+    /// Return number of worker threads.
+    unsigned GetNumThreads() const { return threads_.Size(); }
+    /// Return the frame allocator of a thread (0 = main thread) for scratch data of priority work. Memory is valid until the end of the frame. Must only be used from the thread in question.
+    FrameAllocator* GetFrameAllocator(unsigned threadIndex) const { return threadIndex < frameAllocators_.Size() ? frameAllocators_[threadIndex] : 0; }
+    /// Return how many batches a parallel for should split the given amount of elements into.
+    unsigned GetNumBatches(unsigned count, unsigned grainSize) const;
+    /// Return whether all work with at least the specified priority is finished.
+    bool IsCompleted(unsigned priority) const;
+    /// Return the pool tolerance.
+    int GetTolerance() const { return tolerance_; }
+    /// Return how many milliseconds maximum to spend on non-threaded low-priority work.
+    int GetNonThreadedWorkMs() const { return maxNonThreadedWorkMs_; }
+    
+private:
+    /// Take the highest priority item from the thread's own queue, or steal from another thread's queue. Return null if no work with at least the specified priority.
+    WorkItem* TakeItem(unsigned threadIndex, unsigned priority);
+    /// Execute a work item and mark it finished.
+    void ExecuteItem(WorkItem* item, unsigned threadIndex);
+    /// Mark one job of a work item finished. Complete the item and propagate to its parent when no jobs remain.
+    void FinishJob(WorkItem* item);
+    /// Process work items until shut down. Called by the worker threads.
+    void ProcessItems(unsigned threadIndex);
+    /// Purge completed work items which have at least the specified priority, and send completion events as necessary.
+    void PurgeCompleted(unsigned priority);
+    /// Purge the pool to reduce allocation where its unneeded.
+    void PurgePool();
+    /// Handle frame start event. Purge completed work from the main thread queue, and perform work if no threads at all.
+    void HandleBeginFrame(StringHash eventType, VariantMap& eventData);
+    /// Handle frame end event. Reset the frame allocators.
+    void HandleEndFrame(StringHash eventType, VariantMap& eventData);
+    
+    /// Worker threads.
+    Vector<SharedPtr<WorkerThread> > threads_;
+    /// Per-thread work item queues. Index 0 belongs to the main thread.
+    Vector<SharedPtr<WorkStealingQueue> > queues_;
+    /// Per-thread frame allocators. Index 0 belongs to the main thread.
+    PODVector<FrameAllocator*> frameAllocators_;
+    /// Work item pool for reuse to cut down on allocation.
+    Vector<SharedPtr<WorkItem> > poolItems_;
+    /// Work item collection. Accessed only by the main thread.
+    List<SharedPtr<WorkItem> > workItems_;
+    /// Number of items waiting in the queues.
+    volatile int numQueuedItems_;
+    /// Number of threads blocked in Wait().
+    volatile int numWaiters_;
+    /// Event set when a work item completes while a thread is blocked in Wait().
+    Condition completedEvent_;
+    /// Queue to submit the next work item to.
+    unsigned nextQueue_;
+    /// Pause mutex. Worker threads without work block on it while paused.
+    Mutex pauseMutex_;
+    /// Shutting down flag.
+    volatile bool shutDown_;
+    /// Paused flag. Indicates the pause mutex being locked to prevent worker threads using up CPU time.
+    volatile bool paused_;
+    /// Tolerance for the shared pool before it begins to deallocate.
+    int tolerance_;
+    /// Last size of the shared pool.
+    unsigned lastSize_;
+    /// Maximum milliseconds per frame to spend on low-priority work, when there are no worker threads.
+    int maxNonThreadedWorkMs_;
+};
+
+}
@@ -1,269 +1,269 @@
-//
-// Copyright (c) 2008-2014 the Urho3D project.
-//
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-//
-// The above copyright notice and this permission notice shall be included in
-// all copies or substantial portions of the Software.
-//
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
-// THE SOFTWARE.
-//
-
-#include "Precompiled.h"
-#include "CoreEvents.h"
-#include "DebugHud.h"
-#include "Engine.h"
-#include "Font.h"
-#include "Graphics.h"
-#include "Log.h"
-#include "Profiler.h"
-#include "Renderer.h"
-#include "Text.h"
-#include "UI.h"
-
-#include "DebugNew.h"
-
-namespace Urho3D
-{
-
-static const char* qualityTexts[] =
-{
-    "Low",
-    "Med",
-    "High"
-};
-
-static const char* shadowQualityTexts[] =
-{
-    "16bit Low",
-    "24bit Low",
-    "16bit High",
-    "24bit High"
-};
-
-DebugHud::DebugHud(Context* context) :
-    Object(context),
-    profilerMaxDepth_(M_MAX_UNSIGNED),
-    profilerInterval_(1000),
-    useRendererStats_(false),
-    mode_(DEBUGHUD_SHOW_NONE)
-{
-    UI* ui = GetSubsystem<UI>();
-    UIElement* uiRoot = ui->GetRoot();
-
-    statsText_ = new Text(context_);
-    statsText_->SetAlignment(HA_LEFT, VA_TOP);
-    statsText_->SetPriority(100);
-    statsText_->SetVisible(false);
-    uiRoot->AddChild(statsText_);
-
-    modeText_ = new Text(context_);
-    modeText_->SetAlignment(HA_LEFT, VA_BOTTOM);
-    modeText_->SetPriority(100);
-    modeText_->SetVisible(false);
-    uiRoot->AddChild(modeText_);
-
-    profilerText_ = new Text(context_);
-    profilerText_->SetAlignment(HA_RIGHT, VA_TOP);
-    profilerText_->SetPriority(100);
-    profilerText_->SetVisible(false);
-    uiRoot->AddChild(profilerText_);
-
-    SubscribeToEvent(E_UPDATE, HANDLER(DebugHud, HandleUpdate));
-}
-
-DebugHud::~DebugHud()
-{
-    statsText_->Remove();
-    modeText_->Remove();
-    profilerText_->Remove();
-}
-
-void DebugHud::Update()
-{
-    Graphics* graphics = GetSubsystem<Graphics>();
-    Renderer* renderer = GetSubsystem<Renderer>();
-    if (!renderer || !graphics)
-        return;
-
-    // Ensure UI-elements are not detached
-    if (!statsText_->GetParent())
-    {
-        UI* ui = GetSubsystem<UI>();
-        UIElement* uiRoot = ui->GetRoot();
-        uiRoot->AddChild(statsText_);
-        uiRoot->AddChild(modeText_);
-        uiRoot->AddChild(profilerText_);
-    }
-
-    if (statsText_->IsVisible())
-    {
-        unsigned primitives, batches;
-        if (!useRendererStats_)
-        {
-            primitives = graphics->GetNumPrimitives();
-            batches = graphics->GetNumBatches();
-        }
-        else
-        {
-            primitives = renderer->GetNumPrimitives();
-            batches = renderer->GetNumBatches();
-        }
-
-        String stats;
-        stats.AppendWithFormat("Triangles %u\nBatches %u\nViews %u\nLights %u\nShadowmaps %u\nOccluders %u",
-            primitives,
-            batches,
-            renderer->GetNumViews(),
-            renderer->GetNumLights(true),
-            renderer->GetNumShadowMaps(true),
-            renderer->GetNumOccluders(true));
-
-        if (!appStats_.Empty())
-        {
-            stats.Append("\n");
-            for (HashMap<String, String>::ConstIterator i = appStats_.Begin(); i != appStats_.End(); ++i)
-                stats.AppendWithFormat("\n%s %s", i->first_.CString(), i->second_.CString());
-        }
-
-        statsText_->SetText(stats);
-    }
-
-    if (modeText_->IsVisible())
-    {
-        String mode;
-        mode.AppendWithFormat("Tex:%s Mat:%s Spec:%s Shadows:%s Size:%i Quality:%s Occlusion:%s Instancing:%s Mode:%s",
-            qualityTexts[renderer->GetTextureQuality()],
-            qualityTexts[renderer->GetMaterialQuality()],
-            renderer->GetSpecularLighting() ? "On" : "Off",
-            renderer->GetDrawShadows() ? "On" : "Off",
-            renderer->GetShadowMapSize(),
-            shadowQualityTexts[renderer->GetShadowQuality()],
-            renderer->GetMaxOccluderTriangles() > 0 ? "On" : "Off",
-            renderer->GetDynamicInstancing() ? "On" : "Off",
-            #ifdef URHO3D_OPENGL
-            "OGL");
-            #else
-            graphics->GetSM3Support() ? "SM3" : "SM2");
-            #endif
-
-        modeText_->SetText(mode);
-    }
-
-    Profiler* profiler = GetSubsystem<Profiler>();
-    if (profiler)
-    {
-        if (profilerTimer_.GetMSec(false) >= profilerInterval_)
-        {
-            profilerTimer_.Reset();
-
-            if (profilerText_->IsVisible())
-            {
-                String profilerOutput = profiler->GetData(false, false, profilerMaxDepth_);
-                profilerText_->SetText(profilerOutput);
-            }
-
-            profiler->BeginInterval();
-        }
-    }
-}
-
-void DebugHud::SetDefaultStyle(XMLFile* style)
-{
-    if (!style)
-        return;
-
-    statsText_->SetDefaultStyle(style);
-    statsText_->SetStyle("DebugHudText");
-    modeText_->SetDefaultStyle(style);
-    modeText_->SetStyle("DebugHudText");
-    profilerText_->SetDefaultStyle(style);
-    profilerText_->SetStyle("DebugHudText");
-}
-
-void DebugHud::SetMode(unsigned mode)
-{
-    statsText_->SetVisible((mode & DEBUGHUD_SHOW_STATS) != 0);
-    modeText_->SetVisible((mode & DEBUGHUD_SHOW_MODE) != 0);
-    profilerText_->SetVisible((mode & DEBUGHUD_SHOW_PROFILER) != 0);
-
-    mode_ = mode;
-}
-
-void DebugHud::SetProfilerMaxDepth(unsigned depth)
-{
-    profilerMaxDepth_ = depth;
-}
-
-void DebugHud::SetProfilerInterval(float interval)
-{
-    profilerInterval_ = Max((int)(interval * 1000.0f), 0);
-}
-
-void DebugHud::SetUseRendererStats(bool enable)
-{
-    useRendererStats_ = enable;
-}
-
-void DebugHud::Toggle(unsigned mode)
-{
-    SetMode(GetMode() ^ mode);
-}
-
-void DebugHud::ToggleAll()
-{
-    Toggle(DEBUGHUD_SHOW_ALL);
-}
-
-XMLFile* DebugHud::GetDefaultStyle() const
-{
-    return statsText_->GetDefaultStyle(false);
-}
-
-float DebugHud::GetProfilerInterval() const
-{
-    return (float)profilerInterval_ / 1000.0f;
-}
-
-void DebugHud::SetAppStats(const String& label, const Variant& stats)
-{
-    SetAppStats(label, stats.ToString());
-}
-
-void DebugHud::SetAppStats(const String& label, const String& stats)
-{
-    bool newLabel = !appStats_.Contains(label);
-    appStats_[label] = stats;
-    if (newLabel)
-        appStats_.Sort();
-}
-
-bool DebugHud::ResetAppStats(const String& label)
-{
-    return appStats_.Erase(label);
-}
-
-void DebugHud::ClearAppStats()
-{
-    appStats_.Clear();
-}
-
-void DebugHud::HandleUpdate(StringHash eventType, VariantMap& eventData)
-{
-    using namespace Update;
-
-    Update();
-}
-
-}
+//
+// Copyright (c) 2008-2014 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "Precompiled.h"
+#include "CoreEvents.h"
+#include "DebugHud.h"
+#include "Engine.h"
+#include "Font.h"
+#include "Graphics.h"
+#include "Log.h"
+#include "Profiler.h"
+#include "Renderer.h"
+#include "Text.h"
+#include "UI.h"
+
+#include "DebugNew.h"
+
+namespace Urho3D
+{
+
+static const char* qualityTexts[] =
+{
+    "Low",
+    "Med",
+    "High"
+};
+
+static const char* shadowQualityTexts[] =
+{
+    "16bit Low",
+    "24bit Low",
+    "16bit High",
+    "24bit High"
+};
+
+DebugHud::DebugHud(Context* context) :
+    Object(context),
+    profilerMaxDepth_(M_MAX_UNSIGNED),
+    profilerInterval_(1000),
+    useRendererStats_(false),
+    mode_(DEBUGHUD_SHOW_NONE)
+{
+    UI* ui = GetSubsystem<UI>();
+    UIElement* uiRoot = ui->GetRoot();
+
+    statsText_ = new Text(context_);
+    statsText_->SetAlignment(HA_LEFT, VA_TOP);
+    statsText_->SetPriority(100);
+    statsText_->SetVisible(false);
+    uiRoot->AddChild(statsText_);
+
+    modeText_ = new Text(context_);
+    modeText_->SetAlignment(HA_LEFT, VA_BOTTOM);
+    modeText_->SetPriority(100);
+    modeText_->SetVisible(false);
+    uiRoot->AddChild(modeText_);
+
+    profilerText_ = new Text(context_);
+    profilerText_->SetAlignment(HA_RIGHT, VA_TOP);
+    profilerText_->SetPriority(100);
+    profilerText_->SetVisible(false);
+    uiRoot->AddChild(profilerText_);
+
+    SubscribeToEvent(E_UPDATE, HANDLER(DebugHud, HandleUpdate));
+}
+
+DebugHud::~DebugHud()
+{
+    statsText_->Remove();
+    modeText_->Remove();
+    profilerText_->Remove();
+}
+
+void DebugHud::Update()
+{
+    Graphics* graphics = GetSubsystem<Graphics>();
+    Renderer* renderer = GetSubsystem<Renderer>();
+    if (!renderer || !graphics)
+        return;
+
+    // Ensure UI-elements are not detached
+    if (!statsText_->GetParent())
+    {
+        UI* ui = GetSubsystem<UI>();
+        UIElement* uiRoot = ui->GetRoot();
+        uiRoot->AddChild(statsText_);
+        uiRoot->AddChild(modeText_);
+        uiRoot->AddChild(profilerText_);
+    }
+
+    if (statsText_->IsVisible())
+    {
+        unsigned primitives, batches;
+        if (!useRendererStats_)
+        {
+            primitives = graphics->GetNumPrimitives();
+            batches = graphics->GetNumBatches();
+        }
+        else
+        {
+            primitives = renderer->GetNumPrimitives();
+            batches = renderer->GetNumBatches();
+        }
+
+        String stats;
+        stats.AppendWithFormat("Triangles %u\nBatches %u\nViews %u\nLights %u\nShadowmaps %u\nOccluders %u",
+            primitives,
+            batches,
+            renderer->GetNumViews(),
+            renderer->GetNumLights(true),
+            renderer->GetNumShadowMaps(true),
+            renderer->GetNumOccluders(true));
+
+        if (!appStats_.Empty())
+        {
+            stats.Append("\n");
+            for (HashMap<String, String>::ConstIterator i = appStats_.Begin(); i != appStats_.End(); ++i)
+                stats.AppendWithFormat("\n%s %s", i->first_.CString(), i->second_.CString());
+        }
+
+        statsText_->SetText(stats);
+    }
+
+    if (modeText_->IsVisible())
+    {
+        String mode;
+        mode.AppendWithFormat("Tex:%s Mat:%s Spec:%s Shadows:%s Size:%i Quality:%s Occlusion:%s Instancing:%s Mode:%s",
+            qualityTexts[renderer->GetTextureQuality()],
+            qualityTexts[renderer->GetMaterialQuality()],
+            renderer->GetSpecularLighting() ? "On" : "Off",
+            renderer->GetDrawShadows() ? "On" : "Off",
+            renderer->GetShadowMapSize(),
+            shadowQualityTexts[renderer->GetShadowQuality()],
+            renderer->GetMaxOccluderTriangles() > 0 ? "On" : "Off",
+            renderer->GetDynamicInstancing() ? "On" : "Off",
+            #ifdef URHO3D_OPENGL
+            "OGL");
+            #else
+            graphics->GetSM3Support() ? "SM3" : "SM2");
+            #endif
+
+        modeText_->SetText(mode);
+    }
+
+    Profiler* profiler = GetSubsystem<Profiler>();
+    if (profiler)
+    {
+        if (profilerTimer_.GetMSec(false) >= profilerInterval_)
+        {
+            profilerTimer_.Reset();
+
+            if (profilerText_->IsVisible())
+            {
+                String profilerOutput = profiler->GetData(false, false, profilerMaxDepth_);
+                profilerText_->SetText(profilerOutput);
+            }
+
+            profiler->BeginInterval();
+        }
+    }
+}
+
+void DebugHud::SetDefaultStyle(XMLFile* style)
+{
+    if (!style)
+        return;
+
+    statsText_->SetDefaultStyle(style);
+    statsText_->SetStyle("DebugHudText");
+    modeText_->SetDefaultStyle(style);
+    modeText_->SetStyle("DebugHudText");
+    profilerText_->SetDefaultStyle(style);
+    profilerText_->SetStyle("DebugHudText");
+}
+
+void DebugHud::SetMode(unsigned mode)
+{
+    statsText_->SetVisible((mode & DEBUGHUD_SHOW_STATS) != 0);
+    modeText_->SetVisible((mode & DEBUGHUD_SHOW_MODE) != 0);
+    profilerText_->SetVisible((mode & DEBUGHUD_SHOW_PROFILER) != 0);
+
+    mode_ = mode;
+}
+
+void DebugHud::SetProfilerMaxDepth(unsigned depth)
+{
+    profilerMaxDepth_ = depth;
+}
+
+void DebugHud::SetProfilerInterval(float interval)
+{
+    profilerInterval_ = Max((int)(interval * 1000.0f), 0);
+}
+
+void DebugHud::SetUseRendererStats(bool enable)
+{
+    useRendererStats_ = enable;
+}
+
+void DebugHud::Toggle(unsigned mode)
+{
+    SetMode(GetMode() ^ mode);
+}
+
+void DebugHud::ToggleAll()
+{
+    Toggle(DEBUGHUD_SHOW_ALL);
+}
+
+XMLFile* DebugHud::GetDefaultStyle() const
+{
+    return statsText_->GetDefaultStyle(false);
+}
+
+float DebugHud::GetProfilerInterval() const
+{
+    return (float)profilerInterval_ / 1000.0f;
+}
+
+void DebugHud::SetAppStats(const String& label, const Variant& stats)
+{
+    SetAppStats(label, stats.ToString());
+}
+
+void DebugHud::SetAppStats(const String& label, const String& stats)
+{
+    bool newLabel = !appStats_.Contains(label);
+    appStats_[label] = stats;
+    if (newLabel)
+        appStats_.Sort();
+}
+
+bool DebugHud::ResetAppStats(const String& label)
+{
+    return appStats_.Erase(label);
+}
+
+void DebugHud::ClearAppStats()
+{
+    appStats_.Clear();
+}
+
+void DebugHud::HandleUpdate(StringHash eventType, VariantMap& eventData)
+{
+    using namespace Update;
+
+    Update();
+}
+
+}
@@ -0,0 +1,587 @@
+//
+// Copyright (c) 2008-2014 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "Precompiled.h"
+#include "Drawable.h"
+#include "DrawableBVH.h"
+#include "OctreeQuery.h"
+#include "Sort.h"
+#include "WorkQueue.h"
+
+#include "DebugNew.h"
+
+namespace Urho3D
+{
+
+/// Flag in a drawable position that marks it as individually tested instead of being in the tree.
+static const unsigned LOOSE_POSITION_FLAG = 0x80000000;
+/// Number of bins used for evaluating the surface area heuristic.
+static const unsigned NUM_BVH_BINS = 16;
+/// Drawable count at or below which a node is always a leaf.
+static const unsigned MIN_LEAF_DRAWABLES = 2;
+/// Maximum drawable count of a leaf node when splitting is not beneficial.
+static const unsigned MAX_LEAF_DRAWABLES = 8;
+/// Minimum number of changes since the last rebuild that trigger a new rebuild.
+static const unsigned MIN_REBUILD_CHANGES = 64;
+/// Number of changes relative to the drawable count that trigger a new rebuild, as a right shift.
+static const unsigned REBUILD_CHANGES_SHIFT = 3;
+
+void BuildBVHWork(const WorkItem* item, unsigned threadIndex)
+{
+    DrawableBVH* bvh = reinterpret_cast<DrawableBVH*>(item->aux_);
+    bvh->Build();
+}
+
+/// Return half of the surface area of a bounding box.
+static inline float HalfArea(const BoundingBox& box)
+{
+    Vector3 size = box.Size();
+    return size.x_ * size.y_ + size.y_ * size.z_ + size.z_ * size.x_;
+}
+
+/// Return the bin of a bounding box center along an axis.
+static inline unsigned GetBin(const BVHBuildItem& item, unsigned axis, float minCenter, float binScale)
+{
+    unsigned bin = (unsigned)((item.center_.Data()[axis] - minCenter) * binScale);
+    return bin < NUM_BVH_BINS ? bin : NUM_BVH_BINS - 1;
+}
+
+inline bool CompareNodeIndicesDescending(unsigned lhs, unsigned rhs)
+{
+    return lhs > rhs;
+}
+
+DrawableBVH::DrawableBVH(WorkQueue* workQueue) :
+    workQueue_(workQueue),
+    numChanges_(0),
+    built_(false)
+{
+}
+
+DrawableBVH::~DrawableBVH()
+{
+    if (buildItem_ && workQueue_)
+        workQueue_->Wait(buildItem_);
+}
+
+void DrawableBVH::AddDrawable(Drawable* drawable)
+{
+    if (!drawable || positions_.Contains(drawable))
+        return;
+    
+    AddLooseDrawable(drawable);
+    ++numChanges_;
+    
+    // If the drawable was removed and added back during a rebuild, it should stay in the rebuilt tree
+    if (buildItem_)
+        removedDuringBuild_.Erase(drawable);
+}
+
+void DrawableBVH::RemoveDrawable(Drawable* drawable)
+{
+    HashMap<Drawable*, unsigned>::Iterator i = positions_.Find(drawable);
+    if (i == positions_.End())
+        return;
+    
+    RemoveDrawableAt(i->second_);
+    positions_.Erase(i);
+    ++numChanges_;
+    
+    // The rebuild snapshot may still contain the drawable
+    if (buildItem_)
+        removedDuringBuild_.Insert(drawable);
+}
+
+void DrawableBVH::MarkDrawableMoved(Drawable* drawable)
+{
+    HashMap<Drawable*, unsigned>::Iterator i = positions_.Find(drawable);
+    if (i == positions_.End())
+        return;
+    
+    ++numChanges_;
+    unsigned position = i->second_;
+    if (position & LOOSE_POSITION_FLAG)
+        return;
+    
+    // Drawables that can not be occluded must not be hidden by node occlusion tests, so test them individually instead
+    if (!drawable->IsOccludee())
+    {
+        RemoveDrawableAt(position);
+        positions_.Erase(i);
+        AddLooseDrawable(drawable);
+    }
+    else
+        MarkNodeDirty(drawableLeaves_[position]);
+}
+
+void DrawableBVH::Update()
+{
+    if (buildItem_ && buildItem_->completed_)
+        FinishRebuild();
+    
+    if (!dirtyNodes_.Empty())
+    {
+        // Children have higher indices than their parents, so refit in descending order
+        Sort(dirtyNodes_.Begin(), dirtyNodes_.End(), CompareNodeIndicesDescending);
+        for (PODVector<unsigned>::ConstIterator i = dirtyNodes_.Begin(); i != dirtyNodes_.End(); ++i)
+        {
+            RefitNode(*i);
+            dirtyFlags_[*i] = 0;
+        }
+        dirtyNodes_.Clear();
+    }
+    
+    if (!buildItem_)
+    {
+        unsigned rebuildChanges = positions_.Size() >> REBUILD_CHANGES_SHIFT;
+        if (rebuildChanges < MIN_REBUILD_CHANGES)
+            rebuildChanges = MIN_REBUILD_CHANGES;
+        if (numChanges_ >= rebuildChanges || (!built_ && looseDrawables_.Size() > MAX_LEAF_DRAWABLES))
+            StartRebuild();
+    }
+}
+
+void DrawableBVH::GetDrawables(OctreeQuery& query) const
+{
+    if (!nodes_.Empty())
+        GetDrawablesInternal(query, 0, false);
+    
+    if (!looseDrawables_.Empty())
+    {
+        Drawable** start = const_cast<Drawable**>(&looseDrawables_[0]);
+        query.TestDrawables(start, start + looseDrawables_.Size(), false);
+    }
+}
+
+void DrawableBVH::GetDrawables(RayOctreeQuery& query) const
+{
+    if (!nodes_.Empty())
+        GetDrawablesInternal(query, 0);
+    
+    for (PODVector<Drawable*>::ConstIterator i = looseDrawables_.Begin(); i != looseDrawables_.End(); ++i)
+    {
+        Drawable* drawable = *i;
+        if ((drawable->GetDrawableFlags() & query.drawableFlags_) && (drawable->GetViewMask() & query.viewMask_))
+            drawable->ProcessRayQuery(query, query.result_);
+    }
+}
+
+void DrawableBVH::GetDrawablesOnly(RayOctreeQuery& query, PODVector<Drawable*>& drawables) const
+{
+    if (!nodes_.Empty())
+        GetDrawablesOnlyInternal(query, 0, drawables);
+    
+    // Loose drawables are not known to be hit yet, so check the bounding box here
+    for (PODVector<Drawable*>::ConstIterator i = looseDrawables_.Begin(); i != looseDrawables_.End(); ++i)
+    {
+        Drawable* drawable = *i;
+        if ((drawable->GetDrawableFlags() & query.drawableFlags_) && (drawable->GetViewMask() & query.viewMask_) &&
+            query.ray_.HitDistance(drawable->GetWorldBoundingBox()) < query.maxDistance_)
+            drawables.Push(drawable);
+    }
+}
+
+void DrawableBVH::GetDrawablesInternal(OctreeQuery& query, unsigned index, bool inside) const
+{
+    const BVHNode& node = nodes_[index];
+    if (!node.box_.defined_)
+        return;
+    
+    Intersection res = query.TestOctant(node.box_, inside);
+    if (res == INSIDE)
+        inside = true;
+    else if (res == OUTSIDE)
+        return;
+    
+    if (node.children_)
+    {
+        GetDrawablesInternal(query, node.children_, inside);
+        GetDrawablesInternal(query, node.children_ + 1, inside);
+    }
+    else if (node.count_)
+    {
+        Drawable** start = const_cast<Drawable**>(&drawables_[node.start_]);
+        query.TestDrawables(start, start + node.count_, inside);
+    }
+}
+
+void DrawableBVH::GetDrawablesInternal(RayOctreeQuery& query, unsigned index) const
+{
+    const BVHNode& node = nodes_[index];
+    if (!node.box_.defined_ || query.ray_.HitDistance(node.box_) >= query.maxDistance_)
+        return;
+    
+    if (node.children_)
+    {
+        GetDrawablesInternal(query, node.children_);
+        GetDrawablesInternal(query, node.children_ + 1);
+    }
+    else
+    {
+        for (unsigned i = node.start_; i < node.start_ + node.count_; ++i)
+        {
+            Drawable* drawable = drawables_[i];
+            if ((drawable->GetDrawableFlags() & query.drawableFlags_) && (drawable->GetViewMask() & query.viewMask_))
+                drawable->ProcessRayQuery(query, query.result_);
+        }
+    }
+}
+
+void DrawableBVH::GetDrawablesOnlyInternal(RayOctreeQuery& query, unsigned index, PODVector<Drawable*>& drawables) const
+{
+    const BVHNode& node = nodes_[index];
+    if (!node.box_.defined_ || query.ray_.HitDistance(node.box_) >= query.maxDistance_)
+        return;
+    
+    if (node.children_)
+    {
+        GetDrawablesOnlyInternal(query, node.children_, drawables);
+        GetDrawablesOnlyInternal(query, node.children_ + 1, drawables);
+    }
+    else
+    {
+        for (unsigned i = node.start_; i < node.start_ + node.count_; ++i)
+        {
+            Drawable* drawable = drawables_[i];
+            if ((drawable->GetDrawableFlags() & query.drawableFlags_) && (drawable->GetViewMask() & query.viewMask_))
+                drawables.Push(drawable);
+        }
+    }
+}
+
+void DrawableBVH::AddLooseDrawable(Drawable* drawable)
+{
+    positions_[drawable] = looseDrawables_.Size() | LOOSE_POSITION_FLAG;
+    looseDrawables_.Push(drawable);
+}
+
+void DrawableBVH::RemoveDrawableAt(unsigned position)
+{
+    if (position & LOOSE_POSITION_FLAG)
+    {
+        unsigned index = position & ~LOOSE_POSITION_FLAG;
+        Drawable* last = looseDrawables_.Back();
+        looseDrawables_[index] = last;
+        positions_[last] = position;
+        looseDrawables_.Pop();
+    }
+    else
+    {
+        // Keep the leaf's drawable range contiguous by moving its last drawable into the freed slot
+        unsigned leaf = drawableLeaves_[position];
+        BVHNode& node = nodes_[leaf];
+        unsigned lastPosition = node.start_ + node.count_ - 1;
+        Drawable* last = drawables_[lastPosition];
+        drawables_[position] = last;
+        positions_[last] = position;
+        drawables_[lastPosition] = 0;
+        --node.count_;
+        MarkNodeDirty(leaf);
+    }
+}
+
+void DrawableBVH::MarkNodeDirty(unsigned index)
+{
+    while (index != M_MAX_UNSIGNED && !dirtyFlags_[index])
+    {
+        dirtyFlags_[index] = 1;
+        dirtyNodes_.Push(index);
+        index = nodes_[index].parent_;
+    }
+}
+
+void DrawableBVH::RefitNode(unsigned index)
+{
+    BVHNode& node = nodes_[index];
+    node.box_.Clear();
+    
+    if (node.children_)
+    {
+        const BoundingBox& first = nodes_[node.children_].box_;
+        const BoundingBox& second = nodes_[node.children_ + 1].box_;
+        if (first.defined_)
+            node.box_.Merge(first);
+        if (second.defined_)
+            node.box_.Merge(second);
+    }
+    else
+    {
+        for (unsigned i = node.start_; i < node.start_ + node.count_; ++i)
+            node.box_.Merge(drawables_[i]->GetWorldBoundingBox());
+    }
+}
+
+void DrawableBVH::StartRebuild()
+{
+    // Snapshot the bounding boxes in the main thread, as the drawables may change during the build. Only occludees are
+    // included, so the tree will contain exactly the drawables of the snapshot
+    buildItems_.Clear();
+    for (HashMap<Drawable*, unsigned>::Iterator i = positions_.Begin(); i != positions_.End(); ++i)
+    {
+        Drawable* drawable = i->first_;
+        if (!drawable->IsOccludee())
+        {
+            if (!(i->second_ & LOOSE_POSITION_FLAG))
+            {
+                RemoveDrawableAt(i->second_);
+                AddLooseDrawable(drawable);
+            }
+            continue;
+        }
+        
+        BVHBuildItem item;
+        item.box_ = drawable->GetWorldBoundingBox();
+        item.center_ = item.box_.Center();
+        item.drawable_ = drawable;
+        buildItems_.Push(item);
+    }
+    
+    numChanges_ = 0;
+    
+    // Use a non-pooled item, as the work queue would recycle a pooled item once higher priority work completes
+    buildItem_ = new WorkItem();
+    buildItem_->workFunction_ = BuildBVHWork;
+    buildItem_->aux_ = this;
+    buildItem_->priority_ = 0;
+    
+    if (workQueue_ && workQueue_->GetNumThreads())
+    {
+        workQueue_->AddWorkItem(buildItem_);
+        
+        // Without a tree all queries are brute force, so finish the first build immediately
+        if (!built_)
+        {
+            workQueue_->Wait(buildItem_);
+            FinishRebuild();
+        }
+    }
+    else
+    {
+        Build();
+        FinishRebuild();
+    }
+}
+
+void DrawableBVH::FinishRebuild()
+{
+    buildItem_.Reset();
+    built_ = true;
+    nodes_ = buildNodes_;
+    buildNodes_.Clear();
+    dirtyFlags_.Resize(nodes_.Size());
+    for (unsigned i = 0; i < dirtyFlags_.Size(); ++i)
+        dirtyFlags_[i] = 0;
+    dirtyNodes_.Clear();
+    
+    unsigned numItems = buildItems_.Size();
+    drawables_.Resize(numItems);
+    drawableLeaves_.Resize(numItems);
+    for (unsigned i = 0; i < numItems; ++i)
+        drawables_[i] = buildItems_[i].drawable_;
+    for (unsigned i = 0; i < nodes_.Size(); ++i)
+    {
+        const BVHNode& node = nodes_[i];
+        if (!node.children_)
+        {
+            for (unsigned j = node.start_; j < node.start_ + node.count_; ++j)
+                drawableLeaves_[j] = i;
+        }
+    }
+    buildItems_.Clear();
+    
+    // Move the snapshot drawables into the tree, then drop those removed during the build
+    for (unsigned i = 0; i < numItems; ++i)
+    {
+        HashMap<Drawable*, unsigned>::Iterator j = positions_.Find(drawables_[i]);
+        if (j != positions_.End() && (j->second_ & LOOSE_POSITION_FLAG))
+        {
+            RemoveDrawableAt(j->second_);
+            positions_.Erase(j);
+        }
+        positions_[drawables_[i]] = i;
+    }
+    for (HashSet<Drawable*>::ConstIterator i = removedDuringBuild_.Begin(); i != removedDuringBuild_.End(); ++i)
+    {
+        HashMap<Drawable*, unsigned>::Iterator j = positions_.Find(*i);
+        if (j != positions_.End() && !(j->second_ & LOOSE_POSITION_FLAG))
+        {
+            RemoveDrawableAt(j->second_);
+            positions_.Erase(j);
+        }
+    }
+    removedDuringBuild_.Clear();
+    
+    // Drawables may have moved or stopped being occludees during the build, so refit the whole tree. Iterate backward, as
+    // removal moves the last drawable of a leaf into the freed slot
+    for (unsigned i = numItems - 1; i < numItems; --i)
+    {
+        Drawable* drawable = drawables_[i];
+        if (drawable && !drawable->IsOccludee())
+            MarkDrawableMoved(drawable);
+    }
+    for (unsigned i = nodes_.Size() - 1; i < nodes_.Size(); --i)
+    {
+        RefitNode(i);
+        dirtyFlags_[i] = 0;
+    }
+    dirtyNodes_.Clear();
+}
+
+void DrawableBVH::Build()
+{
+    buildNodes_.Clear();
+    if (buildItems_.Empty())
+        return;
+    
+    BVHNode root;
+    root.children_ = 0;
+    root.start_ = 0;
+    root.count_ = buildItems_.Size();
+    root.parent_ = M_MAX_UNSIGNED;
+    buildNodes_.Push(root);
+    
+    PODVector<unsigned> stack;
+    stack.Push(0);
+    
+    while (!stack.Empty())
+    {
+        unsigned index = stack.Back();
+        stack.Pop();
+        
+        unsigned start = buildNodes_[index].start_;
+        unsigned count = buildNodes_[index].count_;
+        BVHBuildItem* items = &buildItems_[start];
+        
+        BoundingBox box;
+        BoundingBox centerBox;
+        for (unsigned i = 0; i < count; ++i)
+        {
+            box.Merge(items[i].box_);
+            centerBox.Merge(items[i].center_);
+        }
+        buildNodes_[index].box_ = box;
+        
+        if (count <= MIN_LEAF_DRAWABLES)
+            continue;
+        
+        // Split along the axis with the largest spread of bounding box centers
+        Vector3 centerSize = centerBox.Size();
+        unsigned axis = 0;
+        if (centerSize.y_ > centerSize.x_)
+            axis = 1;
+        if (centerSize.z_ > centerSize.Data()[axis])
+            axis = 2;
+        
+        float axisSize = centerSize.Data()[axis];
+        unsigned splitCount = count / 2;
+        
+        if (axisSize > M_EPSILON)
+        {
+            // Evaluate the surface area heuristic at the bin boundaries
+            float minCenter = centerBox.min_.Data()[axis];
+            float binScale = (float)NUM_BVH_BINS / axisSize;
+            BoundingBox binBoxes[NUM_BVH_BINS];
+            unsigned binCounts[NUM_BVH_BINS];
+            for (unsigned i = 0; i < NUM_BVH_BINS; ++i)
+                binCounts[i] = 0;
+            
+            for (unsigned i = 0; i < count; ++i)
+            {
+                unsigned bin = GetBin(items[i], axis, minCenter, binScale);
+                binBoxes[bin].Merge(items[i].box_);
+                ++binCounts[bin];
+            }
+            
+            float rightAreas[NUM_BVH_BINS];
+            unsigned rightCounts[NUM_BVH_BINS];
+            BoundingBox accumBox;
+            unsigned accumCount = 0;
+            for (unsigned i = NUM_BVH_BINS - 1; i > 0; --i)
+            {
+                if (binCounts[i])
+                    accumBox.Merge(binBoxes[i]);
+                accumCount += binCounts[i];
+                rightAreas[i] = HalfArea(accumBox);
+                rightCounts[i] = accumCount;
+            }
+            
+            accumBox.Clear();
+            accumCount = 0;
+            float bestCost = M_INFINITY;
+            unsigned bestBin = 0;
+            for (unsigned i = 1; i < NUM_BVH_BINS; ++i)
+            {
+                if (binCounts[i - 1])
+                    accumBox.Merge(binBoxes[i - 1]);
+                accumCount += binCounts[i - 1];
+                if (!accumCount || !rightCounts[i])
+                    continue;
+                
+                float cost = HalfArea(accumBox) * accumCount + rightAreas[i] * rightCounts[i];
+                if (cost < bestCost)
+                {
+                    bestCost = cost;
+                    bestBin = i;
+                }
+            }
+            
+            // Stop splitting if testing the drawables directly is cheaper
+            if (count <= MAX_LEAF_DRAWABLES && bestCost >= HalfArea(box) * count)
+                continue;
+            
+            if (bestBin)
+            {
+                unsigned left = 0;
+                unsigned right = count;
+                while (left < right)
+                {
+                    if (GetBin(items[left], axis, minCenter, binScale) < bestBin)
+                        ++left;
+                    else
+                        Swap(items[left], items[--right]);
+                }
+                splitCount = left;
+            }
+        }
+        else if (count <= MAX_LEAF_DRAWABLES)
+            continue;
+        
+        // Children are allocated as a consecutive pair after all existing nodes
+        unsigned childIndex = buildNodes_.Size();
+        BVHNode child;
+        child.children_ = 0;
+        child.parent_ = index;
+        child.start_ = start;
+        child.count_ = splitCount;
+        buildNodes_.Push(child);
+        child.start_ = start + splitCount;
+        child.count_ = count - splitCount;
+        buildNodes_.Push(child);
+        
+        buildNodes_[index].children_ = childIndex;
+        buildNodes_[index].count_ = 0;
+        stack.Push(childIndex);
+        stack.Push(childIndex + 1);
+    }
+}
+
+}
@@ -0,0 +1,151 @@
+//
+// Copyright (c) 2008-2014 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#pragma once
+
+#include "BoundingBox.h"
+#include "HashMap.h"
+#include "HashSet.h"
+#include "Ptr.h"
+
+namespace Urho3D
+{
+
+class Drawable;
+class OctreeQuery;
+class RayOctreeQuery;
+class WorkQueue;
+struct WorkItem;
+
+/// Bounding volume hierarchy node.
+struct BVHNode
+{
+    /// Bounding box of the drawables below the node. Undefined if there are none.
+    BoundingBox box_;
+    /// Index of the first of two consecutive child nodes, or 0 for a leaf node.
+    unsigned children_;
+    /// Index of the first drawable of a leaf node.
+    unsigned start_;
+    /// Number of drawables in a leaf node.
+    unsigned count_;
+    /// Parent node index, or M_MAX_UNSIGNED for the root node.
+    unsigned parent_;
+};
+
+/// Drawable and its bounding box for building a bounding volume hierarchy.
+struct BVHBuildItem
+{
+    /// Bounding box.
+    BoundingBox box_;
+    /// Bounding box center.
+    Vector3 center_;
+    /// Drawable.
+    Drawable* drawable_;
+};
+
+/// Bounding volume hierarchy of drawables, built with the surface area heuristic in a worker thread and refitted as drawables move. Used by Octree for queries when enabled.
+class URHO3D_API DrawableBVH
+{
+    friend void BuildBVHWork(const WorkItem* item, unsigned threadIndex);
+    
+public:
+    /// Construct with the work queue used for background rebuilds.
+    DrawableBVH(WorkQueue* workQueue);
+    /// Destruct. Wait for a background rebuild to finish.
+    ~DrawableBVH();
+    
+    /// Add a drawable. It is tested individually by queries until the next rebuild.
+    void AddDrawable(Drawable* drawable);
+    /// Remove a drawable.
+    void RemoveDrawable(Drawable* drawable);
+    /// Mark a drawable's bounding box or occlusion settings changed.
+    void MarkDrawableMoved(Drawable* drawable);
+    /// Refit moved drawables and start or finish a background rebuild as necessary. Call after the drawables have been updated.
+    void Update();
+    
+    /// Return drawables by a query.
+    void GetDrawables(OctreeQuery& query) const;
+    /// Return drawables by a ray query.
+    void GetDrawables(RayOctreeQuery& query) const;
+    /// Return drawables whose bounding box a ray hits without testing them further.
+    void GetDrawablesOnly(RayOctreeQuery& query, PODVector<Drawable*>& drawables) const;
+    
+    /// Return number of drawables.
+    unsigned GetNumDrawables() const { return positions_.Size(); }
+    /// Return number of nodes.
+    unsigned GetNumNodes() const { return nodes_.Size(); }
+    /// Return whether a background rebuild is in progress.
+    bool IsRebuilding() const { return buildItem_.NotNull(); }
+    
+private:
+    /// Return drawables by a query from a node and its children.
+    void GetDrawablesInternal(OctreeQuery& query, unsigned index, bool inside) const;
+    /// Return drawables by a ray query from a node and its children.
+    void GetDrawablesInternal(RayOctreeQuery& query, unsigned index) const;
+    /// Return drawables whose bounding box a ray hits from a node and its children.
+    void GetDrawablesOnlyInternal(RayOctreeQuery& query, unsigned index, PODVector<Drawable*>& drawables) const;
+    /// Add a drawable to the individually tested drawables.
+    void AddLooseDrawable(Drawable* drawable);
+    /// Remove a drawable from the tree or from the individually tested drawables by its position.
+    void RemoveDrawableAt(unsigned position);
+    /// Mark a node and its parents for refit.
+    void MarkNodeDirty(unsigned index);
+    /// Recalculate the bounding box of a node.
+    void RefitNode(unsigned index);
+    /// Snapshot the drawables and start a rebuild. Wait for it to finish if there is no tree yet.
+    void StartRebuild();
+    /// Take the result of a finished rebuild into use.
+    void FinishRebuild();
+    /// Build the tree from the snapshot. Called in a worker thread.
+    void Build();
+    
+    /// Work queue.
+    WeakPtr<WorkQueue> workQueue_;
+    /// Nodes. Child nodes always have higher indices than their parents.
+    PODVector<BVHNode> nodes_;
+    /// Drawables in tree order. Each leaf node references a range.
+    PODVector<Drawable*> drawables_;
+    /// Leaf node index of each drawable in the tree.
+    PODVector<unsigned> drawableLeaves_;
+    /// Drawables tested individually, ie. added since the last rebuild or not occludees.
+    PODVector<Drawable*> looseDrawables_;
+    /// Tree or individually tested drawable index by drawable.
+    HashMap<Drawable*, unsigned> positions_;
+    /// Dirty flag of each node.
+    PODVector<unsigned char> dirtyFlags_;
+    /// Nodes requiring refit.
+    PODVector<unsigned> dirtyNodes_;
+    /// Drawable snapshot for the rebuild. Reordered into tree order by the build.
+    PODVector<BVHBuildItem> buildItems_;
+    /// Nodes produced by the rebuild.
+    PODVector<BVHNode> buildNodes_;
+    /// Drawables removed while rebuilding.
+    HashSet<Drawable*> removedDuringBuild_;
+    /// Background rebuild work item.
+    SharedPtr<WorkItem> buildItem_;
+    /// Number of drawable additions, removals and moves since the last rebuild.
+    unsigned numChanges_;
+    /// Tree built at least once flag. The tree may have no nodes even when built, if none of the drawables are occludees.
+    bool built_;
+};
+
+}
@@ -1,50 +1,50 @@
-//
-// Copyright (c) 2008-2014 the Urho3D project.
-//
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-//
-// The above copyright notice and this permission notice shall be included in
-// all copies or substantial portions of the Software.
-//
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
-// THE SOFTWARE.
-//
-
-#pragma once
-
-#include "Object.h"
-
-namespace Urho3D
-{
-
-/// AnimatedModel bone hierarchy created.
-EVENT(E_BONEHIERARCHYCREATED, BoneHierarchyCreated)
-{
-    PARAM(P_NODE, Node);                    // Node pointer
-}
-
-/// AnimatedModel animation trigger.
-EVENT(E_ANIMATIONTRIGGER, AnimationTrigger)
-{
-    PARAM(P_NODE, Node);                    // Node pointer
-    PARAM(P_NAME, Name);                    // String
-    PARAM(P_TIME, Time);                    // Float
-    PARAM(P_DATA, Data);                    // User-defined data type
-}
-/// Terrain geometry created.
-EVENT(E_TERRAINCREATED, TerrainCreated)
-{
-    PARAM(P_NODE, Node);                    // Node pointer
-}
-
-}
+//
+// Copyright (c) 2008-2014 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#pragma once
+
+#include "Object.h"
+
+namespace Urho3D
+{
+
+/// AnimatedModel bone hierarchy created.
+EVENT(E_BONEHIERARCHYCREATED, BoneHierarchyCreated)
+{
+    PARAM(P_NODE, Node);                    // Node pointer
+}
+
+/// AnimatedModel animation trigger.
+EVENT(E_ANIMATIONTRIGGER, AnimationTrigger)
+{
+    PARAM(P_NODE, Node);                    // Node pointer
+    PARAM(P_NAME, Name);                    // String
+    PARAM(P_TIME, Time);                    // Float
+    PARAM(P_DATA, Data);                    // User-defined data type
+}
+/// Terrain geometry created.
+EVENT(E_TERRAINCREATED, TerrainCreated)
+{
+    PARAM(P_NODE, Node);                    // Node pointer
+}
+
+}
@@ -1,651 +1,1013 @@
-//
-// Copyright (c) 2008-2014 the Urho3D project.
-//
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-//
-// The above copyright notice and this permission notice shall be included in
-// all copies or substantial portions of the Software.
-//
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
-// THE SOFTWARE.
-//
-
-#include "Precompiled.h"
-#include "Context.h"
-#include "CoreEvents.h"
-#include "DebugRenderer.h"
-#include "Graphics.h"
-#include "Log.h"
-#include "Profiler.h"
-#include "Octree.h"
-#include "Scene.h"
-#include "SceneEvents.h"
-#include "Sort.h"
-#include "Timer.h"
-#include "WorkQueue.h"
-
-#include "DebugNew.h"
-
-#ifdef _MSC_VER
-#pragma warning(disable:4355)
-#endif
-
-namespace Urho3D
-{
-
-static const float DEFAULT_OCTREE_SIZE = 1000.0f;
-static const int DEFAULT_OCTREE_LEVELS = 8;
-static const int RAYCASTS_PER_WORK_ITEM = 4;
-
-extern const char* SUBSYSTEM_CATEGORY;
-
-void RaycastDrawablesWork(const WorkItem* item, unsigned threadIndex)
-{
-    Octree* octree = reinterpret_cast<Octree*>(item->aux_);
-    Drawable** start = reinterpret_cast<Drawable**>(item->start_);
-    Drawable** end = reinterpret_cast<Drawable**>(item->end_);
-    const RayOctreeQuery& query = *octree->rayQuery_;
-    PODVector<RayQueryResult>& results = octree->rayQueryResults_[threadIndex];
-
-    while (start != end)
-    {
-        Drawable* drawable = *start;
-        drawable->ProcessRayQuery(query, results);
-        ++start;
-    }
-}
-
-void UpdateDrawablesWork(const WorkItem* item, unsigned threadIndex)
-{
-    const FrameInfo& frame = *(reinterpret_cast<FrameInfo*>(item->aux_));
-    Drawable** start = reinterpret_cast<Drawable**>(item->start_);
-    Drawable** end = reinterpret_cast<Drawable**>(item->end_);
-
-    while (start != end)
-    {
-        Drawable* drawable = *start;
-        if (drawable)
-            drawable->Update(frame);
-        ++start;
-    }
-}
-
-inline bool CompareRayQueryResults(const RayQueryResult& lhs, const RayQueryResult& rhs)
-{
-    return lhs.distance_ < rhs.distance_;
-}
-
-Octant::Octant(const BoundingBox& box, unsigned level, Octant* parent, Octree* root, unsigned index) :
-    level_(level),
-    numDrawables_(0),
-    parent_(parent),
-    root_(root),
-    index_(index)
-{
-    Initialize(box);
-
-    for (unsigned i = 0; i < NUM_OCTANTS; ++i)
-        children_[i] = 0;
-}
-
-Octant::~Octant()
-{
-    if (root_)
-    {
-        // Remove the drawables (if any) from this octant to the root octant
-        for (PODVector<Drawable*>::Iterator i = drawables_.Begin(); i != drawables_.End(); ++i)
-        {
-            (*i)->SetOctant(root_);
-            root_->drawables_.Push(*i);
-            root_->QueueUpdate(*i);
-        }
-        drawables_.Clear();
-        numDrawables_ = 0;
-    }
-
-    for (unsigned i = 0; i < NUM_OCTANTS; ++i)
-        DeleteChild(i);
-}
-
-Octant* Octant::GetOrCreateChild(unsigned index)
-{
-    if (children_[index])
-        return children_[index];
-
-    Vector3 newMin = worldBoundingBox_.min_;
-    Vector3 newMax = worldBoundingBox_.max_;
-    Vector3 oldCenter = worldBoundingBox_.Center();
-
-    if (index & 1)
-        newMin.x_ = oldCenter.x_;
-    else
-        newMax.x_ = oldCenter.x_;
-
-    if (index & 2)
-        newMin.y_ = oldCenter.y_;
-    else
-        newMax.y_ = oldCenter.y_;
-
-    if (index & 4)
-        newMin.z_ = oldCenter.z_;
-    else
-        newMax.z_ = oldCenter.z_;
-
-    children_[index] = new Octant(BoundingBox(newMin, newMax), level_ + 1, this, root_, index);
-    return children_[index];
-}
-
-void Octant::DeleteChild(unsigned index)
-{
-    assert(index < NUM_OCTANTS);
-    delete children_[index];
-    children_[index] = 0;
-}
-
-void Octant::InsertDrawable(Drawable* drawable)
-{
-    const BoundingBox& box = drawable->GetWorldBoundingBox();
-
-    // If root octant, insert all non-occludees here, so that octant occlusion does not hide the drawable.
-    // Also if drawable is outside the root octant bounds, insert to root
-    bool insertHere;
-    if (this == root_)
-        insertHere = !drawable->IsOccludee() || cullingBox_.IsInside(box) != INSIDE || CheckDrawableFit(box);
-    else
-        insertHere = CheckDrawableFit(box);
-
-    if (insertHere)
-    {
-        Octant* oldOctant = drawable->octant_;
-        if (oldOctant != this)
-        {
-            // Add first, then remove, because drawable count going to zero deletes the octree branch in question
-            AddDrawable(drawable);
-            if (oldOctant)
-                oldOctant->RemoveDrawable(drawable, false);
-        }
-    }
-    else
-    {
-        Vector3 boxCenter = box.Center();
-        unsigned x = boxCenter.x_ < center_.x_ ? 0 : 1;
-        unsigned y = boxCenter.y_ < center_.y_ ? 0 : 2;
-        unsigned z = boxCenter.z_ < center_.z_ ? 0 : 4;
-
-        GetOrCreateChild(x + y + z)->InsertDrawable(drawable);
-    }
-}
-
-bool Octant::CheckDrawableFit(const BoundingBox& box) const
-{
-    Vector3 boxSize = box.Size();
-
-    // If max split level, size always OK, otherwise check that box is at least half size of octant
-    if (level_ >= root_->GetNumLevels() || boxSize.x_ >= halfSize_.x_ || boxSize.y_ >= halfSize_.y_ ||
-        boxSize.z_ >= halfSize_.z_)
-        return true;
-    // Also check if the box can not fit a child octant's culling box, in that case size OK (must insert here)
-    else
-    {
-        if (box.min_.x_ <= worldBoundingBox_.min_.x_ - 0.5f * halfSize_.x_ ||
-            box.max_.x_ >= worldBoundingBox_.max_.x_ + 0.5f * halfSize_.x_ ||
-            box.min_.y_ <= worldBoundingBox_.min_.y_ - 0.5f * halfSize_.y_ ||
-            box.max_.y_ >= worldBoundingBox_.max_.y_ + 0.5f * halfSize_.y_ ||
-            box.min_.z_ <= worldBoundingBox_.min_.z_ - 0.5f * halfSize_.z_ ||
-            box.max_.z_ >= worldBoundingBox_.max_.z_ + 0.5f * halfSize_.z_)
-            return true;
-    }
-
-    // Bounding box too small, should create a child octant
-    return false;
-}
-
-void Octant::ResetRoot()
-{
-    root_ = 0;
-
-    // The whole octree is being destroyed, just detach the drawables
-    for (PODVector<Drawable*>::Iterator i = drawables_.Begin(); i != drawables_.End(); ++i)
-        (*i)->SetOctant(0);
-
-    for (unsigned i = 0; i < NUM_OCTANTS; ++i)
-    {
-        if (children_[i])
-            children_[i]->ResetRoot();
-    }
-}
-
-void Octant::DrawDebugGeometry(DebugRenderer* debug, bool depthTest)
-{
-    if (debug && debug->IsInside(worldBoundingBox_))
-    {
-        debug->AddBoundingBox(worldBoundingBox_, Color(0.25f, 0.25f, 0.25f), depthTest);
-
-        for (unsigned i = 0; i < NUM_OCTANTS; ++i)
-        {
-            if (children_[i])
-                children_[i]->DrawDebugGeometry(debug, depthTest);
-        }
-    }
-}
-
-void Octant::Initialize(const BoundingBox& box)
-{
-    worldBoundingBox_ = box;
-    center_ = box.Center();
-    halfSize_ = 0.5f * box.Size();
-    cullingBox_ = BoundingBox(worldBoundingBox_.min_ - halfSize_, worldBoundingBox_.max_ + halfSize_);
-}
-
-void Octant::GetDrawablesInternal(OctreeQuery& query, bool inside) const
-{
-    if (this != root_)
-    {
-        Intersection res = query.TestOctant(cullingBox_, inside);
-        if (res == INSIDE)
-            inside = true;
-        else if (res == OUTSIDE)
-        {
-            // Fully outside, so cull this octant, its children & drawables
-            return;
-        }
-    }
-
-    if (drawables_.Size())
-    {
-        Drawable** start = const_cast<Drawable**>(&drawables_[0]);
-        Drawable** end = start + drawables_.Size();
-        query.TestDrawables(start, end, inside);
-    }
-
-    for (unsigned i = 0; i < NUM_OCTANTS; ++i)
-    {
-        if (children_[i])
-            children_[i]->GetDrawablesInternal(query, inside);
-    }
-}
-
-void Octant::GetDrawablesInternal(RayOctreeQuery& query) const
-{
-    float octantDist = query.ray_.HitDistance(cullingBox_);
-    if (octantDist >= query.maxDistance_)
-        return;
-
-    if (drawables_.Size())
-    {
-        Drawable** start = const_cast<Drawable**>(&drawables_[0]);
-        Drawable** end = start + drawables_.Size();
-
-        while (start != end)
-        {
-            Drawable* drawable = *start++;
-
-            if ((drawable->GetDrawableFlags() & query.drawableFlags_) && (drawable->GetViewMask() & query.viewMask_))
-                drawable->ProcessRayQuery(query, query.result_);
-        }
-    }
-
-    for (unsigned i = 0; i < NUM_OCTANTS; ++i)
-    {
-        if (children_[i])
-            children_[i]->GetDrawablesInternal(query);
-    }
-}
-
-void Octant::GetDrawablesOnlyInternal(RayOctreeQuery& query, PODVector<Drawable*>& drawables) const
-{
-    float octantDist = query.ray_.HitDistance(cullingBox_);
-    if (octantDist >= query.maxDistance_)
-        return;
-
-    if (drawables_.Size())
-    {
-        Drawable** start = const_cast<Drawable**>(&drawables_[0]);
-        Drawable** end = start + drawables_.Size();
-
-        while (start != end)
-        {
-            Drawable* drawable = *start++;
-
-            if ((drawable->GetDrawableFlags() & query.drawableFlags_) && (drawable->GetViewMask() & query.viewMask_))
-                drawables.Push(drawable);
-        }
-    }
-
-    for (unsigned i = 0; i < NUM_OCTANTS; ++i)
-    {
-        if (children_[i])
-            children_[i]->GetDrawablesOnlyInternal(query, drawables);
-    }
-}
-
-Octree::Octree(Context* context) :
-    Component(context),
-    Octant(BoundingBox(-DEFAULT_OCTREE_SIZE, DEFAULT_OCTREE_SIZE), 0, 0, this),
-    numLevels_(DEFAULT_OCTREE_LEVELS)
-{
-    // Resize threaded ray query intermediate result vector according to number of worker threads
-    WorkQueue* workQueue = GetSubsystem<WorkQueue>();
-    rayQueryResults_.Resize(workQueue ? workQueue->GetNumThreads() + 1 : 1);
-    
-    // If the engine is running headless, subscribe to RenderUpdate events for manually updating the octree
-    // to allow raycasts and animation update
-    if (!GetSubsystem<Graphics>())
-        SubscribeToEvent(E_RENDERUPDATE, HANDLER(Octree, HandleRenderUpdate));
-}
-
-Octree::~Octree()
-{
-    // Reset root pointer from all child octants now so that they do not move their drawables to root
-    drawableUpdates_.Clear();
-    drawableReinsertions_.Clear();
-    ResetRoot();
-}
-
-void Octree::RegisterObject(Context* context)
-{
-    context->RegisterFactory<Octree>(SUBSYSTEM_CATEGORY);
-
-    Vector3 defaultBoundsMin = -Vector3::ONE * DEFAULT_OCTREE_SIZE;
-    Vector3 defaultBoundsMax = Vector3::ONE * DEFAULT_OCTREE_SIZE;
-
-    ATTRIBUTE(Octree, VAR_VECTOR3, "Bounding Box Min", worldBoundingBox_.min_, defaultBoundsMin, AM_DEFAULT);
-    ATTRIBUTE(Octree, VAR_VECTOR3, "Bounding Box Max", worldBoundingBox_.max_, defaultBoundsMax, AM_DEFAULT);
-    ATTRIBUTE(Octree, VAR_INT, "Number of Levels", numLevels_, DEFAULT_OCTREE_LEVELS, AM_DEFAULT);
-}
-
-void Octree::OnSetAttribute(const AttributeInfo& attr, const Variant& src)
-{
-    // If any of the (size) attributes change, resize the octree
-    Serializable::OnSetAttribute(attr, src);
-    SetSize(worldBoundingBox_, numLevels_);
-}
-
-void Octree::DrawDebugGeometry(DebugRenderer* debug, bool depthTest)
-{
-    if (debug)
-    {
-        PROFILE(OctreeDrawDebug);
-
-        Octant::DrawDebugGeometry(debug, depthTest);
-    }
-}
-
-void Octree::SetSize(const BoundingBox& box, unsigned numLevels)
-{
-    PROFILE(ResizeOctree);
-
-    // If drawables exist, they are temporarily moved to the root
-    for (unsigned i = 0; i < NUM_OCTANTS; ++i)
-        DeleteChild(i);
-
-    Initialize(box);
-    numDrawables_ = drawables_.Size();
-    numLevels_ = Max((int)numLevels, 1);
-}
-
-void Octree::Update(const FrameInfo& frame)
-{
-    // Let drawables update themselves before reinsertion. This can be used for animation
-    if (!drawableUpdates_.Empty())
-    {
-        PROFILE(UpdateDrawables);
-
-        // Perform updates in worker threads. Notify the scene that a threaded update is going on and components
-        // (for example physics objects) should not perform non-threadsafe work when marked dirty
-        Scene* scene = GetScene();
-        WorkQueue* queue = GetSubsystem<WorkQueue>();
-        scene->BeginThreadedUpdate();
-        
-        int numWorkItems = queue->GetNumThreads() + 1; // Worker threads + main thread
-        int drawablesPerItem = Max((int)(drawableUpdates_.Size() / numWorkItems), 1);
-        
-        PODVector<Drawable*>::Iterator start = drawableUpdates_.Begin();
-        // Create a work item for each thread
-        for (int i = 0; i < numWorkItems; ++i)
-        {
-            SharedPtr<WorkItem> item = queue->GetFreeItem();
-            item->priority_ = M_MAX_UNSIGNED;
-            item->workFunction_ = UpdateDrawablesWork;
-            item->aux_ = const_cast<FrameInfo*>(&frame);
-
-            PODVector<Drawable*>::Iterator end = drawableUpdates_.End();
-            if (i < numWorkItems - 1 && end - start > drawablesPerItem)
-                end = start + drawablesPerItem;
-
-            item->start_ = &(*start);
-            item->end_ = &(*end);
-            queue->AddWorkItem(item);
-
-            start = end;
-        }
-
-        queue->Complete(M_MAX_UNSIGNED);
-        scene->EndThreadedUpdate();
-    }
-    
-    // Notify drawable update being finished. Custom animation (eg. IK) can be done at this point
-    Scene* scene = GetScene();
-    if (scene)
-    {
-        using namespace SceneDrawableUpdateFinished;
-
-        VariantMap& eventData = GetEventDataMap();
-        eventData[P_SCENE] = scene;
-        eventData[P_TIMESTEP] = frame.timeStep_;
-        scene->SendEvent(E_SCENEDRAWABLEUPDATEFINISHED, eventData);
-    }
-    
-    // Reinsert drawables that have been moved or resized, or that have been newly added to the octree and do not sit inside
-    // the proper octant yet
-    if (!drawableUpdates_.Empty())
-    {
-        PROFILE(ReinsertToOctree);
-
-        for (PODVector<Drawable*>::Iterator i = drawableUpdates_.Begin(); i != drawableUpdates_.End(); ++i)
-        {
-            Drawable* drawable = *i;
-            drawable->updateQueued_ = false;
-            Octant* octant = drawable->GetOctant();
-            const BoundingBox& box = drawable->GetWorldBoundingBox();
-
-            // Skip if no octant or does not belong to this octree anymore
-            if (!octant || octant->GetRoot() != this)
-                continue;
-            // Skip if still fits the current octant
-            if (drawable->IsOccludee() && octant->GetCullingBox().IsInside(box) == INSIDE && octant->CheckDrawableFit(box))
-                continue;
-
-            InsertDrawable(drawable);
-
-            #ifdef _DEBUG
-            // Verify that the drawable will be culled correctly
-            octant = drawable->GetOctant();
-            if (octant != this && octant->GetCullingBox().IsInside(box) != INSIDE)
-            {
-                LOGERROR("Drawable is not fully inside its octant's culling bounds: drawable box " + box.ToString() +
-                    " octant box " + octant->GetCullingBox().ToString());
-            }
-            #endif
-        }
-    }
-    
-    drawableUpdates_.Clear();
-}
-
-void Octree::AddManualDrawable(Drawable* drawable)
-{
-    if (!drawable || drawable->GetOctant())
-        return;
-
-    AddDrawable(drawable);
-}
-
-void Octree::RemoveManualDrawable(Drawable* drawable)
-{
-    if (!drawable)
-        return;
-
-    Octant* octant = drawable->GetOctant();
-    if (octant && octant->GetRoot() == this)
-        octant->RemoveDrawable(drawable);
-}
-
-void Octree::GetDrawables(OctreeQuery& query) const
-{
-    query.result_.Clear();
-    GetDrawablesInternal(query, false);
-}
-
-void Octree::Raycast(RayOctreeQuery& query) const
-{
-    PROFILE(Raycast);
-
-    query.result_.Clear();
-
-    WorkQueue* queue = GetSubsystem<WorkQueue>();
-
-    // If no worker threads or no triangle-level testing, do not create work items
-    if (!queue->GetNumThreads() || query.level_ < RAY_TRIANGLE)
-        GetDrawablesInternal(query);
-    else
-    {
-        // Threaded ray query: first get the drawables
-        rayQuery_ = &query;
-        rayQueryDrawables_.Clear();
-        GetDrawablesOnlyInternal(query, rayQueryDrawables_);
-
-        // Check that amount of drawables is large enough to justify threading
-        if (rayQueryDrawables_.Size() >= RAYCASTS_PER_WORK_ITEM * 2)
-        {
-            for (unsigned i = 0; i < rayQueryResults_.Size(); ++i)
-                rayQueryResults_[i].Clear();
-
-            PODVector<Drawable*>::Iterator start = rayQueryDrawables_.Begin();
-            while (start != rayQueryDrawables_.End())
-            {
-                SharedPtr<WorkItem> item = queue->GetFreeItem();
-                item->priority_ = M_MAX_UNSIGNED;
-                item->workFunction_ = RaycastDrawablesWork;
-                item->aux_ = const_cast<Octree*>(this);
-
-                PODVector<Drawable*>::Iterator end = rayQueryDrawables_.End();
-                if (end - start > RAYCASTS_PER_WORK_ITEM)
-                    end = start + RAYCASTS_PER_WORK_ITEM;
-
-                item->start_ = &(*start);
-                item->end_ = &(*end);
-                queue->AddWorkItem(item);
-
-                start = end;
-            }
-
-            // Merge per-thread results
-            queue->Complete(M_MAX_UNSIGNED);
-            for (unsigned i = 0; i < rayQueryResults_.Size(); ++i)
-                query.result_.Insert(query.result_.End(), rayQueryResults_[i].Begin(), rayQueryResults_[i].End());
-        }
-        else
-        {
-            for (PODVector<Drawable*>::Iterator i = rayQueryDrawables_.Begin(); i != rayQueryDrawables_.End(); ++i)
-                (*i)->ProcessRayQuery(query, query.result_);
-        }
-    }
-
-    Sort(query.result_.Begin(), query.result_.End(), CompareRayQueryResults);
-}
-
-void Octree::RaycastSingle(RayOctreeQuery& query) const
-{
-    PROFILE(Raycast);
-
-    query.result_.Clear();
-    rayQueryDrawables_.Clear();
-    GetDrawablesOnlyInternal(query, rayQueryDrawables_);
-
-    // Sort by increasing hit distance to AABB
-    for (PODVector<Drawable*>::Iterator i = rayQueryDrawables_.Begin(); i != rayQueryDrawables_.End(); ++i)
-    {
-        Drawable* drawable = *i;
-        drawable->SetSortValue(query.ray_.HitDistance(drawable->GetWorldBoundingBox()));
-    }
-
-    Sort(rayQueryDrawables_.Begin(), rayQueryDrawables_.End(), CompareDrawables);
-
-    // Then do the actual test according to the query, and early-out as possible
-    float closestHit = M_INFINITY;
-    for (PODVector<Drawable*>::Iterator i = rayQueryDrawables_.Begin(); i != rayQueryDrawables_.End(); ++i)
-    {
-        Drawable* drawable = *i;
-        if (drawable->GetSortValue() < Min(closestHit, query.maxDistance_))
-        {
-            unsigned oldSize = query.result_.Size();
-            drawable->ProcessRayQuery(query, query.result_);
-            if (query.result_.Size() > oldSize)
-                closestHit = Min(closestHit, query.result_.Back().distance_);
-        }
-        else
-            break;
-    }
-
-    if (query.result_.Size() > 1)
-    {
-        Sort(query.result_.Begin(), query.result_.End(), CompareRayQueryResults);
-        query.result_.Resize(1);
-    }
-}
-
-void Octree::QueueUpdate(Drawable* drawable)
-{
-    Scene* scene = GetScene();
-    if (scene && scene->IsThreadedUpdate())
-    {
-        MutexLock lock(octreeMutex_);
-        drawableUpdates_.Push(drawable);
-    }
-    else
-        drawableUpdates_.Push(drawable);
-    
-    drawable->updateQueued_ = true;
-}
-
-void Octree::CancelUpdate(Drawable* drawable)
-{
-    drawableUpdates_.Remove(drawable);
-    drawable->updateQueued_ = false;
-}
-
-void Octree::DrawDebugGeometry(bool depthTest)
-{
-    DebugRenderer* debug = GetComponent<DebugRenderer>();
-    DrawDebugGeometry(debug, depthTest);
-}
-
-void Octree::HandleRenderUpdate(StringHash eventType, VariantMap& eventData)
-{
-    // When running in headless mode, update the Octree manually during the RenderUpdate event
-    Scene* scene = GetScene();
-    if (!scene || !scene->IsUpdateEnabled())
-        return;
-    
-    using namespace RenderUpdate;
-    
-    FrameInfo frame;
-    frame.frameNumber_ = GetSubsystem<Time>()->GetFrameNumber();
-    frame.timeStep_ = eventData[P_TIMESTEP].GetFloat();
-    frame.camera_ = 0;
-    
-    Update(frame);
-}
-
-}
+//
+// Copyright (c) 2008-2014 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "Precompiled.h"
+#include "Context.h"
+#include "CoreEvents.h"
+#include "DebugRenderer.h"
+#include "DrawableBVH.h"
+#include "Graphics.h"
+#include "Log.h"
+#include "Profiler.h"
+#include "Octree.h"
+#include "Scene.h"
+#include "SceneEvents.h"
+#include "Sort.h"
+#include "Timer.h"
+#include "WorkQueue.h"
+
+#include "DebugNew.h"
+
+#ifdef _MSC_VER
+#pragma warning(disable:4355)
+#endif
+
+namespace Urho3D
+{
+
+static const float DEFAULT_OCTREE_SIZE = 1000.0f;
+static const int DEFAULT_OCTREE_LEVELS = 8;
+static const float DEFAULT_OCTREE_LOOSENESS = 2.0f;
+static const float MIN_OCTREE_LOOSENESS = 1.25f;
+static const float MAX_OCTREE_LOOSENESS = 4.0f;
+/// Number of octree updates an empty octant is kept for, so that drawables moving back and forth do not repeatedly delete and recreate it.
+static const unsigned EMPTY_OCTANT_FRAMES = 30;
+static const int RAYCASTS_PER_WORK_ITEM = 4;
+/// Maximum drawables passed to an octree query at once after batched culling.
+static const unsigned MAX_CULLED_DRAWABLES = 64;
+
+extern const char* SUBSYSTEM_CATEGORY;
+
+void RaycastDrawablesWork(const WorkItem* item, unsigned threadIndex)
+{
+    Octree* octree = reinterpret_cast<Octree*>(item->aux_);
+    Drawable** start = reinterpret_cast<Drawable**>(item->start_);
+    Drawable** end = reinterpret_cast<Drawable**>(item->end_);
+    const RayOctreeQuery& query = *octree->rayQuery_;
+    PODVector<RayQueryResult>& results = octree->rayQueryResults_[threadIndex];
+
+    while (start != end)
+    {
+        Drawable* drawable = *start;
+        drawable->ProcessRayQuery(query, results);
+        ++start;
+    }
+}
+
+/// Functor for updating drawables in worker threads.
+struct UpdateDrawablesWork
+{
+    /// Construct.
+    UpdateDrawablesWork(const FrameInfo& frame) :
+        frame_(frame)
+    {
+    }
+    
+    /// Update a range of drawables.
+    void operator () (Drawable** start, Drawable** end, unsigned threadIndex) const
+    {
+        while (start != end)
+        {
+            Drawable* drawable = *start;
+            if (drawable)
+                drawable->Update(frame_);
+            ++start;
+        }
+    }
+    
+    /// Frame info.
+    const FrameInfo& frame_;
+};
+
+static void SetCullingBounds(DrawableCullingBlock& block, unsigned slot, const BoundingBox& box)
+{
+    Vector3 center = box.Center();
+    Vector3 halfSize = center - box.min_;
+    block.centerX_[slot] = center.x_;
+    block.centerY_[slot] = center.y_;
+    block.centerZ_[slot] = center.z_;
+    block.halfSizeX_[slot] = halfSize.x_;
+    block.halfSizeY_[slot] = halfSize.y_;
+    block.halfSizeZ_[slot] = halfSize.z_;
+}
+
+inline bool CompareRayQueryResults(const RayQueryResult& lhs, const RayQueryResult& rhs)
+{
+    return lhs.distance_ < rhs.distance_;
+}
+
+Octant::Octant(const BoundingBox& box, unsigned level, Octant* parent, Octree* root, unsigned index) :
+    level_(level),
+    numDrawables_(0),
+    parent_(parent),
+    root_(root),
+    index_(index),
+    emptyFrames_(0),
+    cullingBlocksDirty_(false),
+    emptyQueued_(false)
+{
+    Initialize(box);
+
+    for (unsigned i = 0; i < NUM_OCTANTS; ++i)
+        children_[i] = 0;
+}
+
+Octant::~Octant()
+{
+    if (root_)
+    {
+        if (cullingBlocksDirty_)
+            root_->dirtyCullingOctants_.Remove(this);
+        if (emptyQueued_)
+            root_->emptyOctants_.Remove(this);
+
+        // Remove the drawables (if any) from this octant to the root octant
+        for (PODVector<Drawable*>::Iterator i = drawables_.Begin(); i != drawables_.End(); ++i)
+        {
+            (*i)->SetOctant(root_);
+            root_->drawables_.Push(*i);
+            root_->QueueUpdate(*i);
+        }
+        drawables_.Clear();
+        numDrawables_ = 0;
+    }
+
+    for (unsigned i = 0; i < NUM_OCTANTS; ++i)
+        DeleteChild(i);
+}
+
+Octant* Octant::GetOrCreateChild(unsigned index)
+{
+    if (children_[index])
+        return children_[index];
+
+    Vector3 newMin = worldBoundingBox_.min_;
+    Vector3 newMax = worldBoundingBox_.max_;
+    Vector3 oldCenter = worldBoundingBox_.Center();
+
+    if (index & 1)
+        newMin.x_ = oldCenter.x_;
+    else
+        newMax.x_ = oldCenter.x_;
+
+    if (index & 2)
+        newMin.y_ = oldCenter.y_;
+    else
+        newMax.y_ = oldCenter.y_;
+
+    if (index & 4)
+        newMin.z_ = oldCenter.z_;
+    else
+        newMax.z_ = oldCenter.z_;
+
+    children_[index] = new(AllocatorReserve(root_->octantAllocator_)) Octant(BoundingBox(newMin, newMax), level_ + 1, this,
+        root_, index);
+    return children_[index];
+}
+
+void Octant::DeleteChild(unsigned index)
+{
+    assert(index < NUM_OCTANTS);
+    Octant* child = children_[index];
+    if (child)
+    {
+        child->~Octant();
+        AllocatorFree(root_->octantAllocator_, child);
+        children_[index] = 0;
+    }
+}
+
+void Octant::MarkEmpty()
+{
+    if (!emptyQueued_ && root_)
+    {
+        emptyQueued_ = true;
+        emptyFrames_ = 0;
+        root_->emptyOctants_.Push(this);
+    }
+}
+
+void Octant::AddDrawable(Drawable* drawable)
+{
+    // Drawables moving between octants of the same octree are already known by the bounding volume hierarchy
+    Octant* oldOctant = drawable->GetOctant();
+    if (root_ && root_->bvh_ && (!oldOctant || oldOctant->GetRoot() != root_))
+        root_->bvh_->AddDrawable(drawable);
+    
+    drawable->SetOctant(this);
+    drawables_.Push(drawable);
+    IncDrawableCount();
+    MarkCullingBlocksDirty();
+}
+
+void Octant::RemoveDrawable(Drawable* drawable, bool resetOctant)
+{
+    if (drawables_.Remove(drawable))
+    {
+        if (resetOctant)
+        {
+            drawable->SetOctant(0);
+            if (root_ && root_->bvh_)
+                root_->bvh_->RemoveDrawable(drawable);
+        }
+        MarkCullingBlocksDirty();
+        DecDrawableCount();
+    }
+}
+
+void Octant::InsertDrawable(Drawable* drawable)
+{
+    const BoundingBox& box = drawable->GetWorldBoundingBox();
+
+    // If root octant, insert all non-occludees here, so that octant occlusion does not hide the drawable.
+    // Also if drawable is outside the root octant bounds, insert to root
+    bool insertHere;
+    if (this == root_)
+        insertHere = !drawable->IsOccludee() || cullingBox_.IsInside(box) != INSIDE || CheckDrawableFit(box);
+    else
+        insertHere = CheckDrawableFit(box);
+
+    if (insertHere)
+    {
+        Octant* oldOctant = drawable->octant_;
+        if (oldOctant != this)
+        {
+            // Add first, then remove, because drawable count going to zero deletes the octree branch in question
+            AddDrawable(drawable);
+            if (oldOctant)
+                oldOctant->RemoveDrawable(drawable, false);
+        }
+    }
+    else
+    {
+        Vector3 boxCenter = box.Center();
+        unsigned x = boxCenter.x_ < center_.x_ ? 0 : 1;
+        unsigned y = boxCenter.y_ < center_.y_ ? 0 : 2;
+        unsigned z = boxCenter.z_ < center_.z_ ? 0 : 4;
+
+        GetOrCreateChild(x + y + z)->InsertDrawable(drawable);
+    }
+}
+
+bool Octant::CheckDrawableFit(const BoundingBox& box) const
+{
+    Vector3 boxSize = box.Size();
+    // Distance the child octants' culling boxes extend beyond their actual bounds
+    Vector3 childMargin = 0.5f * (root_->GetLooseness() - 1.0f) * halfSize_;
+
+    // If max split level, size always OK, otherwise check that the box is small enough to always fit a child octant's
+    // culling box (half size of octant with the default looseness)
+    if (level_ >= root_->GetNumLevels() || boxSize.x_ >= 2.0f * childMargin.x_ || boxSize.y_ >= 2.0f * childMargin.y_ ||
+        boxSize.z_ >= 2.0f * childMargin.z_)
+        return true;
+    // Also check if the box can not fit a child octant's culling box, in that case size OK (must insert here)
+    else
+    {
+        if (box.min_.x_ <= worldBoundingBox_.min_.x_ - childMargin.x_ ||
+            box.max_.x_ >= worldBoundingBox_.max_.x_ + childMargin.x_ ||
+            box.min_.y_ <= worldBoundingBox_.min_.y_ - childMargin.y_ ||
+            box.max_.y_ >= worldBoundingBox_.max_.y_ + childMargin.y_ ||
+            box.min_.z_ <= worldBoundingBox_.min_.z_ - childMargin.z_ ||
+            box.max_.z_ >= worldBoundingBox_.max_.z_ + childMargin.z_)
+            return true;
+    }
+
+    // Bounding box too small, should create a child octant
+    return false;
+}
+
+void Octant::MarkCullingBlocksDirty()
+{
+    if (!cullingBlocksDirty_ && root_)
+    {
+        cullingBlocksDirty_ = true;
+        root_->dirtyCullingOctants_.Push(this);
+    }
+}
+
+void Octant::UpdateCullingBlocks()
+{
+    unsigned numDrawables = drawables_.Size();
+    cullingBlocks_.Resize((numDrawables + 3) >> 2);
+
+    for (unsigned i = 0; i < cullingBlocks_.Size() * 4; ++i)
+    {
+        DrawableCullingBlock& block = cullingBlocks_[i >> 2];
+        unsigned slot = i & 3;
+
+        if (i < numDrawables)
+        {
+            Drawable* drawable = drawables_[i];
+            drawable->cullingIndex_ = i;
+            SetCullingBounds(block, slot, drawable->GetWorldBoundingBox());
+            block.viewMask_[slot] = drawable->GetViewMask();
+        }
+        else
+        {
+            block.centerX_[slot] = block.centerY_[slot] = block.centerZ_[slot] = 0.0f;
+            block.halfSizeX_[slot] = block.halfSizeY_[slot] = block.halfSizeZ_[slot] = 0.0f;
+            block.viewMask_[slot] = 0;
+        }
+    }
+
+    cullingBlocksDirty_ = false;
+}
+
+void Octant::UpdateCullingBounds(Drawable* drawable)
+{
+    // If a rebuild is pending, the indices may be out of date and the rebuild will read the bounds anyway
+    if (cullingBlocksDirty_)
+        return;
+
+    unsigned index = drawable->cullingIndex_;
+    if (index < drawables_.Size() && drawables_[index] == drawable)
+        SetCullingBounds(cullingBlocks_[index >> 2], index & 3, drawable->worldBoundingBox_);
+}
+
+void Octant::DetachDrawables()
+{
+    // The whole octree is being destroyed, just detach the drawables. Also clear the removal and culling data rebuild
+    // flags, as the octree clears its queues
+    for (PODVector<Drawable*>::Iterator i = drawables_.Begin(); i != drawables_.End(); ++i)
+        (*i)->SetOctant(0);
+    drawables_.Clear();
+    numDrawables_ = 0;
+    cullingBlocksDirty_ = false;
+    emptyQueued_ = false;
+
+    for (unsigned i = 0; i < NUM_OCTANTS; ++i)
+    {
+        if (children_[i])
+            children_[i]->DetachDrawables();
+    }
+}
+
+void Octant::DrawDebugGeometry(DebugRenderer* debug, bool depthTest)
+{
+    if (debug && debug->IsInside(worldBoundingBox_))
+    {
+        debug->AddBoundingBox(worldBoundingBox_, Color(0.25f, 0.25f, 0.25f), depthTest);
+
+        for (unsigned i = 0; i < NUM_OCTANTS; ++i)
+        {
+            if (children_[i])
+                children_[i]->DrawDebugGeometry(debug, depthTest);
+        }
+    }
+}
+
+void Octant::Initialize(const BoundingBox& box)
+{
+    worldBoundingBox_ = box;
+    center_ = box.Center();
+    halfSize_ = 0.5f * box.Size();
+    // The octree root is not fully constructed yet when initializing itself, so use default looseness in that case
+    Vector3 margin = ((root_ ? root_->GetLooseness() : DEFAULT_OCTREE_LOOSENESS) - 1.0f) * halfSize_;
+    cullingBox_ = BoundingBox(worldBoundingBox_.min_ - margin, worldBoundingBox_.max_ + margin);
+}
+
+void Octant::GetDrawablesInternal(OctreeQuery& query, bool inside) const
+{
+    // Skip empty octants that are waiting for removal
+    if (!numDrawables_)
+        return;
+
+    if (this != root_)
+    {
+        Intersection res = query.TestOctant(cullingBox_, inside);
+        if (res == INSIDE)
+            inside = true;
+        else if (res == OUTSIDE)
+        {
+            // Fully outside, so cull this octant, its children & drawables
+            return;
+        }
+    }
+
+    if (drawables_.Size())
+    {
+        // Frustum queries cull by the packed bounds first when they are up to date, so that only the drawables that pass are
+        // accessed
+        const Frustum* frustum = (inside || cullingBlocksDirty_) ? 0 : query.GetCullingFrustum();
+        if (frustum)
+            GetDrawablesBatched(query, *frustum);
+        else
+        {
+            Drawable** start = const_cast<Drawable**>(&drawables_[0]);
+            Drawable** end = start + drawables_.Size();
+            query.TestDrawables(start, end, inside);
+        }
+    }
+
+    for (unsigned i = 0; i < NUM_OCTANTS; ++i)
+    {
+        if (children_[i])
+            children_[i]->GetDrawablesInternal(query, inside);
+    }
+}
+
+void Octant::GetDrawablesBatched(OctreeQuery& query, const Frustum& frustum) const
+{
+    Drawable* culled[MAX_CULLED_DRAWABLES];
+    unsigned numCulled = 0;
+    unsigned viewMask = query.viewMask_;
+
+#ifdef URHO3D_MATH_SSE
+    __m128 normalX[NUM_FRUSTUM_PLANES];
+    __m128 normalY[NUM_FRUSTUM_PLANES];
+    __m128 normalZ[NUM_FRUSTUM_PLANES];
+    __m128 absNormalX[NUM_FRUSTUM_PLANES];
+    __m128 absNormalY[NUM_FRUSTUM_PLANES];
+    __m128 absNormalZ[NUM_FRUSTUM_PLANES];
+    __m128 planeD[NUM_FRUSTUM_PLANES];
+    for (unsigned i = 0; i < NUM_FRUSTUM_PLANES; ++i)
+    {
+        const Plane& plane = frustum.planes_[i];
+        normalX[i] = _mm_set1_ps(plane.normal_.x_);
+        normalY[i] = _mm_set1_ps(plane.normal_.y_);
+        normalZ[i] = _mm_set1_ps(plane.normal_.z_);
+        absNormalX[i] = _mm_set1_ps(plane.absNormal_.x_);
+        absNormalY[i] = _mm_set1_ps(plane.absNormal_.y_);
+        absNormalZ[i] = _mm_set1_ps(plane.absNormal_.z_);
+        planeD[i] = _mm_set1_ps(plane.d_);
+    }
+    __m128 zero = _mm_setzero_ps();
+#endif
+
+    for (unsigned i = 0; i < cullingBlocks_.Size(); ++i)
+    {
+        const DrawableCullingBlock& block = cullingBlocks_[i];
+
+        // Same test as Frustum::IsInsideFast(), for four bounding boxes at a time
+#ifdef URHO3D_MATH_SSE
+        __m128 centerX = _mm_loadu_ps(block.centerX_);
+        __m128 centerY = _mm_loadu_ps(block.centerY_);
+        __m128 centerZ = _mm_loadu_ps(block.centerZ_);
+        __m128 halfSizeX = _mm_loadu_ps(block.halfSizeX_);
+        __m128 halfSizeY = _mm_loadu_ps(block.halfSizeY_);
+        __m128 halfSizeZ = _mm_loadu_ps(block.halfSizeZ_);
+        __m128 outside = zero;
+        for (unsigned j = 0; j < NUM_FRUSTUM_PLANES; ++j)
+        {
+            __m128 dist = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(normalX[j], centerX), _mm_mul_ps(normalY[j], centerY)),
+                _mm_mul_ps(normalZ[j], centerZ)), planeD[j]);
+            __m128 absDist = _mm_add_ps(_mm_add_ps(_mm_mul_ps(absNormalX[j], halfSizeX), _mm_mul_ps(absNormalY[j], halfSizeY)),
+                _mm_mul_ps(absNormalZ[j], halfSizeZ));
+            outside = _mm_or_ps(outside, _mm_cmplt_ps(dist, _mm_sub_ps(zero, absDist)));
+        }
+        unsigned insideMask = ~_mm_movemask_ps(outside) & 0xf;
+#else
+        unsigned insideMask = 0;
+        for (unsigned j = 0; j < 4; ++j)
+        {
+            bool isOutside = false;
+            for (unsigned k = 0; k < NUM_FRUSTUM_PLANES; ++k)
+            {
+                const Plane& plane = frustum.planes_[k];
+                float dist = plane.normal_.x_ * block.centerX_[j] + plane.normal_.y_ * block.centerY_[j] + plane.normal_.z_ *
+                    block.centerZ_[j] + plane.d_;
+                float absDist = plane.absNormal_.x_ * block.halfSizeX_[j] + plane.absNormal_.y_ * block.halfSizeY_[j] +
+                    plane.absNormal_.z_ * block.halfSizeZ_[j];
+                if (dist < -absDist)
+                {
+                    isOutside = true;
+                    break;
+                }
+            }
+            if (!isOutside)
+                insideMask |= 1 << j;
+        }
+#endif
+
+        if (!insideMask)
+            continue;
+
+        for (unsigned j = 0; j < 4; ++j)
+        {
+            // Unused slots have a zero view mask, so they never pass
+            if ((insideMask & (1 << j)) && (block.viewMask_[j] & viewMask))
+            {
+                culled[numCulled++] = drawables_[(i << 2) + j];
+                if (numCulled == MAX_CULLED_DRAWABLES)
+                {
+                    query.TestDrawables(culled, culled + numCulled, true);
+                    numCulled = 0;
+                }
+            }
+        }
+    }
+
+    if (numCulled)
+        query.TestDrawables(culled, culled + numCulled, true);
+}
+
+void Octant::GetDrawablesInternal(RayOctreeQuery& query) const
+{
+    if (!numDrawables_)
+        return;
+
+    float octantDist = query.ray_.HitDistance(cullingBox_);
+    if (octantDist >= query.maxDistance_)
+        return;
+
+    if (drawables_.Size())
+    {
+        Drawable** start = const_cast<Drawable**>(&drawables_[0]);
+        Drawable** end = start + drawables_.Size();
+
+        while (start != end)
+        {
+            Drawable* drawable = *start++;
+
+            if ((drawable->GetDrawableFlags() & query.drawableFlags_) && (drawable->GetViewMask() & query.viewMask_))
+                drawable->ProcessRayQuery(query, query.result_);
+        }
+    }
+
+    for (unsigned i = 0; i < NUM_OCTANTS; ++i)
+    {
+        if (children_[i])
+            children_[i]->GetDrawablesInternal(query);
+    }
+}
+
+void Octant::GetDrawablesOnlyInternal(RayOctreeQuery& query, PODVector<Drawable*>& drawables) const
+{
+    if (!numDrawables_)
+        return;
+
+    float octantDist = query.ray_.HitDistance(cullingBox_);
+    if (octantDist >= query.maxDistance_)
+        return;
+
+    if (drawables_.Size())
+    {
+        Drawable** start = const_cast<Drawable**>(&drawables_[0]);
+        Drawable** end = start + drawables_.Size();
+
+        while (start != end)
+        {
+            Drawable* drawable = *start++;
+
+            if ((drawable->GetDrawableFlags() & query.drawableFlags_) && (drawable->GetViewMask() & query.viewMask_))
+                drawables.Push(drawable);
+        }
+    }
+
+    for (unsigned i = 0; i < NUM_OCTANTS; ++i)
+    {
+        if (children_[i])
+            children_[i]->GetDrawablesOnlyInternal(query, drawables);
+    }
+}
+
+Octree::Octree(Context* context) :
+    Component(context),
+    Octant(BoundingBox(-DEFAULT_OCTREE_SIZE, DEFAULT_OCTREE_SIZE), 0, 0, 0),
+    bvh_(0),
+    octantAllocator_(AllocatorInitialize(sizeof(Octant))),
+    numLevels_(DEFAULT_OCTREE_LEVELS),
+    looseness_(DEFAULT_OCTREE_LOOSENESS)
+{
+    root_ = this;
+
+
+    // Resize threaded ray query intermediate result vector according to number of worker threads
+    WorkQueue* workQueue = GetSubsystem<WorkQueue>();
+    rayQueryResults_.Resize(workQueue ? workQueue->GetNumThreads() + 1 : 1);
+    
+    // If the engine is running headless, subscribe to RenderUpdate events for manually updating the octree
+    // to allow raycasts and animation update
+    if (!GetSubsystem<Graphics>())
+        SubscribeToEvent(E_RENDERUPDATE, HANDLER(Octree, HandleRenderUpdate));
+}
+
+Octree::~Octree()
+{
+    delete bvh_;
+    bvh_ = 0;
+    
+    // Detach drawables from all octants now so that the child octants do not move their drawables to root
+    drawableUpdates_.Clear();
+    drawableReinsertions_.Clear();
+    dirtyCullingOctants_.Clear();
+    emptyOctants_.Clear();
+    DetachDrawables();
+
+    // Free the child octants while the allocator still exists, then prevent the root octant destructor from accessing the
+    // octree
+    for (unsigned i = 0; i < NUM_OCTANTS; ++i)
+        DeleteChild(i);
+    AllocatorUninitialize(octantAllocator_);
+    octantAllocator_ = 0;
+    root_ = 0;
+}
+
+void Octree::RegisterObject(Context* context)
+{
+    context->RegisterFactory<Octree>(SUBSYSTEM_CATEGORY);
+
+    Vector3 defaultBoundsMin = -Vector3::ONE * DEFAULT_OCTREE_SIZE;
+    Vector3 defaultBoundsMax = Vector3::ONE * DEFAULT_OCTREE_SIZE;
+
+    ATTRIBUTE(Octree, VAR_VECTOR3, "Bounding Box Min", worldBoundingBox_.min_, defaultBoundsMin, AM_DEFAULT);
+    ATTRIBUTE(Octree, VAR_VECTOR3, "Bounding Box Max", worldBoundingBox_.max_, defaultBoundsMax, AM_DEFAULT);
+    ATTRIBUTE(Octree, VAR_INT, "Number of Levels", numLevels_, DEFAULT_OCTREE_LEVELS, AM_DEFAULT);
+    ATTRIBUTE(Octree, VAR_FLOAT, "Looseness", looseness_, DEFAULT_OCTREE_LOOSENESS, AM_DEFAULT);
+    ACCESSOR_ATTRIBUTE(Octree, VAR_BOOL, "Use BVH", GetUseBVH, SetUseBVH, bool, false, AM_DEFAULT);
+}
+
+void Octree::OnSetAttribute(const AttributeInfo& attr, const Variant& src)
+{
+    // If any of the (size) attributes change, resize the octree
+    Serializable::OnSetAttribute(attr, src);
+    if (!attr.accessor_)
+        SetSize(worldBoundingBox_, numLevels_);
+}
+
+void Octree::DrawDebugGeometry(DebugRenderer* debug, bool depthTest)
+{
+    if (debug)
+    {
+        PROFILE(OctreeDrawDebug);
+
+        Octant::DrawDebugGeometry(debug, depthTest);
+    }
+}
+
+void Octree::SetSize(const BoundingBox& box, unsigned numLevels)
+{
+    PROFILE(ResizeOctree);
+
+    // If drawables exist, they are temporarily moved to the root
+    for (unsigned i = 0; i < NUM_OCTANTS; ++i)
+        DeleteChild(i);
+
+    looseness_ = Clamp(looseness_, MIN_OCTREE_LOOSENESS, MAX_OCTREE_LOOSENESS);
+    Initialize(box);
+    numDrawables_ = drawables_.Size();
+    numLevels_ = Max((int)numLevels, 1);
+}
+
+void Octree::SetLooseness(float looseness)
+{
+    looseness_ = looseness;
+    SetSize(worldBoundingBox_, numLevels_);
+}
+
+void Octree::SetUseBVH(bool enable)
+{
+    if (enable == (bvh_ != 0))
+        return;
+    
+    if (enable)
+    {
+        bvh_ = new DrawableBVH(GetSubsystem<WorkQueue>());
+        AddDrawablesToBVH(this);
+        bvh_->Update();
+    }
+    else
+    {
+        delete bvh_;
+        bvh_ = 0;
+    }
+}
+
+void Octree::Update(const FrameInfo& frame)
+{
+    // Let drawables update themselves before reinsertion. This can be used for animation
+    if (!drawableUpdates_.Empty())
+    {
+        PROFILE(UpdateDrawables);
+
+        // Perform updates in worker threads. Notify the scene that a threaded update is going on and components
+        // (for example physics objects) should not perform non-threadsafe work when marked dirty
+        Scene* scene = GetScene();
+        WorkQueue* queue = GetSubsystem<WorkQueue>();
+        scene->BeginThreadedUpdate();
+        
+        queue->ParallelFor(drawableUpdates_, 1, UpdateDrawablesWork(frame));
+        scene->EndThreadedUpdate();
+    }
+    
+    // Notify drawable update being finished. Custom animation (eg. IK) can be done at this point
+    Scene* scene = GetScene();
+    if (scene)
+    {
+        SceneDrawableUpdateFinished::Data eventData;
+        eventData.scene_ = scene;
+        eventData.timeStep_ = frame.timeStep_;
+        scene->SendEvent(E_SCENEDRAWABLEUPDATEFINISHED, eventData);
+    }
+    
+    // Reinsert drawables that have been moved or resized, or that have been newly added to the octree and do not sit inside
+    // the proper octant yet
+    if (!drawableUpdates_.Empty())
+    {
+        PROFILE(ReinsertToOctree);
+
+        for (PODVector<Drawable*>::Iterator i = drawableUpdates_.Begin(); i != drawableUpdates_.End(); ++i)
+        {
+            Drawable* drawable = *i;
+            drawable->updateQueued_ = false;
+            Octant* octant = drawable->GetOctant();
+            const BoundingBox& box = drawable->GetWorldBoundingBox();
+
+            // Skip if no octant or does not belong to this octree anymore
+            if (!octant || octant->GetRoot() != this)
+                continue;
+            if (bvh_)
+                bvh_->MarkDrawableMoved(drawable);
+            // Skip if still fits the current octant
+            if (drawable->IsOccludee() && octant->GetCullingBox().IsInside(box) == INSIDE && octant->CheckDrawableFit(box))
+                continue;
+
+            // Else reinsert starting from the nearest parent octant that still contains the drawable. Non-occludees are
+            // always reinserted from the root
+            if (drawable->IsOccludee())
+            {
+                while (octant != this && octant->GetCullingBox().IsInside(box) != INSIDE)
+                    octant = octant->GetParent();
+                octant->InsertDrawable(drawable);
+            }
+            else
+                InsertDrawable(drawable);
+
+            #ifdef _DEBUG
+            // Verify that the drawable will be culled correctly
+            octant = drawable->GetOctant();
+            if (octant != this && octant->GetCullingBox().IsInside(box) != INSIDE)
+            {
+                LOGERROR("Drawable is not fully inside its octant's culling bounds: drawable box " + box.ToString() +
+                    " octant box " + octant->GetCullingBox().ToString());
+            }
+            #endif
+        }
+    }
+    
+    drawableUpdates_.Clear();
+
+    if (bvh_)
+    {
+        PROFILE(UpdateBVH);
+        bvh_->Update();
+    }
+
+    // Remove octants that have stayed empty for long enough
+    if (!emptyOctants_.Empty())
+    {
+        PODVector<Octant*> expiredOctants;
+
+        for (unsigned i = 0; i < emptyOctants_.Size();)
+        {
+            Octant* octant = emptyOctants_[i];
+            if (octant->numDrawables_)
+            {
+                octant->emptyQueued_ = false;
+                emptyOctants_[i] = emptyOctants_.Back();
+                emptyOctants_.Pop();
+                continue;
+            }
+
+            // If the parent is empty as well, it will remove this octant along with itself
+            ++octant->emptyFrames_;
+            Octant* parent = octant->parent_;
+            if (octant->emptyFrames_ >= EMPTY_OCTANT_FRAMES && (parent == this || parent->numDrawables_))
+                expiredOctants.Push(octant);
+            ++i;
+        }
+
+        // Removing an octant also removes it and its children from the queue
+        for (PODVector<Octant*>::Iterator i = expiredOctants.Begin(); i != expiredOctants.End(); ++i)
+            (*i)->parent_->DeleteChild((*i)->index_);
+    }
+
+    // Rebuild the packed culling data of octants whose drawables have been added, removed or changed
+    if (!dirtyCullingOctants_.Empty())
+    {
+        PROFILE(UpdateCullingData);
+
+        for (PODVector<Octant*>::Iterator i = dirtyCullingOctants_.Begin(); i != dirtyCullingOctants_.End(); ++i)
+            (*i)->UpdateCullingBlocks();
+        dirtyCullingOctants_.Clear();
+    }
+}
+
+void Octree::AddManualDrawable(Drawable* drawable)
+{
+    if (!drawable || drawable->GetOctant())
+        return;
+
+    AddDrawable(drawable);
+}
+
+void Octree::RemoveManualDrawable(Drawable* drawable)
+{
+    if (!drawable)
+        return;
+
+    Octant* octant = drawable->GetOctant();
+    if (octant && octant->GetRoot() == this)
+        octant->RemoveDrawable(drawable);
+}
+
+void Octree::GetDrawables(OctreeQuery& query) const
+{
+    query.result_.Clear();
+    if (bvh_)
+        bvh_->GetDrawables(query);
+    else
+        GetDrawablesInternal(query, false);
+}
+
+void Octree::Raycast(RayOctreeQuery& query) const
+{
+    PROFILE(Raycast);
+
+    query.result_.Clear();
+
+    WorkQueue* queue = GetSubsystem<WorkQueue>();
+
+    // If no worker threads or no triangle-level testing, do not create work items
+    if (!queue->GetNumThreads() || query.level_ < RAY_TRIANGLE)
+    {
+        if (bvh_)
+            bvh_->GetDrawables(query);
+        else
+            GetDrawablesInternal(query);
+    }
+    else
+    {
+        // Threaded ray query: first get the drawables
+        rayQuery_ = &query;
+        rayQueryDrawables_.Clear();
+        if (bvh_)
+            bvh_->GetDrawablesOnly(query, rayQueryDrawables_);
+        else
+            GetDrawablesOnlyInternal(query, rayQueryDrawables_);
+
+        // Check that amount of drawables is large enough to justify threading
+        if (rayQueryDrawables_.Size() >= RAYCASTS_PER_WORK_ITEM * 2)
+        {
+            for (unsigned i = 0; i < rayQueryResults_.Size(); ++i)
+                rayQueryResults_[i].Clear();
+
+            PODVector<Drawable*>::Iterator start = rayQueryDrawables_.Begin();
+            while (start != rayQueryDrawables_.End())
+            {
+                SharedPtr<WorkItem> item = queue->GetFreeItem();
+                item->priority_ = M_MAX_UNSIGNED;
+                item->workFunction_ = RaycastDrawablesWork;
+                item->aux_ = const_cast<Octree*>(this);
+
+                PODVector<Drawable*>::Iterator end = rayQueryDrawables_.End();
+                if (end - start > RAYCASTS_PER_WORK_ITEM)
+                    end = start + RAYCASTS_PER_WORK_ITEM;
+
+                item->start_ = &(*start);
+                item->end_ = &(*end);
+                queue->AddWorkItem(item);
+
+                start = end;
+            }
+
+            // Merge per-thread results
+            queue->Complete(M_MAX_UNSIGNED);
+            for (unsigned i = 0; i < rayQueryResults_.Size(); ++i)
+                query.result_.Insert(query.result_.End(), rayQueryResults_[i].Begin(), rayQueryResults_[i].End());
+        }
+        else
+        {
+            for (PODVector<Drawable*>::Iterator i = rayQueryDrawables_.Begin(); i != rayQueryDrawables_.End(); ++i)
+                (*i)->ProcessRayQuery(query, query.result_);
+        }
+    }
+
+    Sort(query.result_.Begin(), query.result_.End(), CompareRayQueryResults);
+}
+
+void Octree::RaycastSingle(RayOctreeQuery& query) const
+{
+    PROFILE(Raycast);
+
+    query.result_.Clear();
+    rayQueryDrawables_.Clear();
+    if (bvh_)
+        bvh_->GetDrawablesOnly(query, rayQueryDrawables_);
+    else
+        GetDrawablesOnlyInternal(query, rayQueryDrawables_);
+
+    // Sort by increasing hit distance to AABB
+    for (PODVector<Drawable*>::Iterator i = rayQueryDrawables_.Begin(); i != rayQueryDrawables_.End(); ++i)
+    {
+        Drawable* drawable = *i;
+        drawable->SetSortValue(query.ray_.HitDistance(drawable->GetWorldBoundingBox()));
+    }
+
+    Sort(rayQueryDrawables_.Begin(), rayQueryDrawables_.End(), CompareDrawables);
+
+    // Then do the actual test according to the query, and early-out as possible
+    float closestHit = M_INFINITY;
+    for (PODVector<Drawable*>::Iterator i = rayQueryDrawables_.Begin(); i != rayQueryDrawables_.End(); ++i)
+    {
+        Drawable* drawable = *i;
+        if (drawable->GetSortValue() < Min(closestHit, query.maxDistance_))
+        {
+            unsigned oldSize = query.result_.Size();
+            drawable->ProcessRayQuery(query, query.result_);
+            if (query.result_.Size() > oldSize)
+                closestHit = Min(closestHit, query.result_.Back().distance_);
+        }
+        else
+            break;
+    }
+
+    if (query.result_.Size() > 1)
+    {
+        Sort(query.result_.Begin(), query.result_.End(), CompareRayQueryResults);
+        query.result_.Resize(1);
+    }
+}
+
+void Octree::QueueUpdate(Drawable* drawable)
+{
+    Scene* scene = GetScene();
+    Octant* octant = drawable->GetOctant();
+    if (scene && scene->IsThreadedUpdate())
+    {
+        MutexLock lock(octreeMutex_);
+        drawableUpdates_.Push(drawable);
+        if (octant)
+            octant->MarkCullingBlocksDirty();
+    }
+    else
+    {
+        drawableUpdates_.Push(drawable);
+        if (octant)
+            octant->MarkCullingBlocksDirty();
+    }
+    
+    drawable->updateQueued_ = true;
+}
+
+void Octree::CancelUpdate(Drawable* drawable)
+{
+    drawableUpdates_.Remove(drawable);
+    drawable->updateQueued_ = false;
+}
+
+void Octree::DrawDebugGeometry(bool depthTest)
+{
+    DebugRenderer* debug = GetComponent<DebugRenderer>();
+    DrawDebugGeometry(debug, depthTest);
+}
+
+void Octree::AddDrawablesToBVH(Octant* octant)
+{
+    for (PODVector<Drawable*>::ConstIterator i = octant->drawables_.Begin(); i != octant->drawables_.End(); ++i)
+        bvh_->AddDrawable(*i);
+
+    for (unsigned i = 0; i < NUM_OCTANTS; ++i)
+    {
+        if (octant->children_[i])
+            AddDrawablesToBVH(octant->children_[i]);
+    }
+}
+
+void Octree::HandleRenderUpdate(StringHash eventType, VariantMap& eventData)
+{
+    // When running in headless mode, update the Octree manually during the RenderUpdate event
+    Scene* scene = GetScene();
+    if (!scene || !scene->IsUpdateEnabled())
+        return;
+    
+    using namespace RenderUpdate;
+    
+    FrameInfo frame;
+    frame.frameNumber_ = GetSubsystem<Time>()->GetFrameNumber();
+    frame.timeStep_ = eventData[P_TIMESTEP].GetFloat();
+    frame.camera_ = 0;
+    
+    Update(frame);
+}
+
+}
@@ -1,218 +1,263 @@
-//
-// Copyright (c) 2008-2014 the Urho3D project.
-//
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-//
-// The above copyright notice and this permission notice shall be included in
-// all copies or substantial portions of the Software.
-//
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
-// THE SOFTWARE.
-//
-
-#pragma once
-
-#include "Drawable.h"
-#include "List.h"
-#include "Mutex.h"
-#include "OctreeQuery.h"
-
-namespace Urho3D
-{
-
-class Octree;
-
-static const int NUM_OCTANTS = 8;
-static const unsigned ROOT_INDEX = M_MAX_UNSIGNED;
-
-/// %Octree octant
-class URHO3D_API Octant
-{
-public:
-    /// Construct.
-    Octant(const BoundingBox& box, unsigned level, Octant* parent, Octree* root, unsigned index = ROOT_INDEX);
-    /// Destruct. Move drawables to root if available (detach if not) and free child octants.
-    virtual ~Octant();
-    
-    /// Return or create a child octant.
-    Octant* GetOrCreateChild(unsigned index);
-    /// Delete child octant.
-    void DeleteChild(unsigned index);
-    /// Insert a drawable object by checking for fit recursively.
-    void InsertDrawable(Drawable* drawable);
-    /// Check if a drawable object fits.
-    bool CheckDrawableFit(const BoundingBox& box) const;
-    
-    /// Add a drawable object to this octant.
-    void AddDrawable(Drawable* drawable)
-    {
-        drawable->SetOctant(this);
-        drawables_.Push(drawable);
-        IncDrawableCount();
-    }
-    
-    /// Remove a drawable object from this octant.
-    void RemoveDrawable(Drawable* drawable, bool resetOctant = true)
-    {
-        if (drawables_.Remove(drawable))
-        {
-            if (resetOctant)
-                drawable->SetOctant(0);
-            DecDrawableCount();
-        }
-    }
-    
-    /// Return world-space bounding box.
-    const BoundingBox& GetWorldBoundingBox() const { return worldBoundingBox_; }
-    /// Return bounding box used for fitting drawable objects.
-    const BoundingBox& GetCullingBox() const { return cullingBox_; }
-    /// Return subdivision level.
-    unsigned GetLevel() const { return level_; }
-    /// Return parent octant.
-    Octant* GetParent() const { return parent_; }
-    /// Return octree root.
-    Octree* GetRoot() const { return root_; }
-    /// Return number of drawables.
-    unsigned GetNumDrawables() const { return numDrawables_; }
-    /// Return true if there are no drawable objects in this octant and child octants.
-    bool IsEmpty() { return numDrawables_ == 0; }
-    
-    /// Reset root pointer recursively. Called when the whole octree is being destroyed.
-    void ResetRoot();
-    /// Draw bounds to the debug graphics recursively.
-    void DrawDebugGeometry(DebugRenderer* debug, bool depthTest);
-    
-protected:
-    /// Initialize bounding box.
-    void Initialize(const BoundingBox& box);
-    /// Return drawable objects by a query, called internally.
-    void GetDrawablesInternal(OctreeQuery& query, bool inside) const;
-    /// Return drawable objects by a ray query, called internally.
-    void GetDrawablesInternal(RayOctreeQuery& query) const;
-    /// Return drawable objects only for a threaded ray query, called internally.
-    void GetDrawablesOnlyInternal(RayOctreeQuery& query, PODVector<Drawable*>& drawables) const;
-    
-    /// Increase drawable object count recursively.
-    void IncDrawableCount()
-    {
-        ++numDrawables_;
-        if (parent_)
-            parent_->IncDrawableCount();
-    }
-    
-    /// Decrease drawable object count recursively and remove octant if it becomes empty.
-    void DecDrawableCount()
-    {
-        Octant* parent = parent_;
-        
-        --numDrawables_;
-        if (!numDrawables_)
-        {
-            if (parent)
-                parent->DeleteChild(index_);
-        }
-        
-        if (parent)
-            parent->DecDrawableCount();
-    }
-    
-    /// World bounding box.
-    BoundingBox worldBoundingBox_;
-    /// Bounding box used for drawable object fitting.
-    BoundingBox cullingBox_;
-    /// Drawable objects.
-    PODVector<Drawable*> drawables_;
-    /// Child octants.
-    Octant* children_[NUM_OCTANTS];
-    /// World bounding box center.
-    Vector3 center_;
-    /// World bounding box half size.
-    Vector3 halfSize_;
-    /// Subdivision level.
-    unsigned level_;
-    /// Number of drawable objects in this octant and child octants.
-    unsigned numDrawables_;
-    /// Parent octant.
-    Octant* parent_;
-    /// Octree root.
-    Octree* root_;
-    /// Octant index relative to its siblings or ROOT_INDEX for root octant
-    unsigned index_;
-};
-
-/// %Octree component. Should be added only to the root scene node
-class URHO3D_API Octree : public Component, public Octant
-{
-    friend void RaycastDrawablesWork(const WorkItem* item, unsigned threadIndex);
-    
-    OBJECT(Octree);
-    
-public:
-    /// Construct.
-    Octree(Context* context);
-    /// Destruct.
-    ~Octree();
-    /// Register object factory.
-    static void RegisterObject(Context* context);
-    
-    /// Handle attribute change.
-    virtual void OnSetAttribute(const AttributeInfo& attr, const Variant& src);
-    /// Visualize the component as debug geometry.
-    virtual void DrawDebugGeometry(DebugRenderer* debug, bool depthTest);
-    
-    /// Set size and maximum subdivision levels. If octree is not empty, drawable objects will be temporarily moved to the root.
-    void SetSize(const BoundingBox& box, unsigned numLevels);
-    /// Update and reinsert drawable objects.
-    void Update(const FrameInfo& frame);
-    /// Add a drawable manually.
-    void AddManualDrawable(Drawable* drawable);
-    /// Remove a manually added drawable.
-    void RemoveManualDrawable(Drawable* drawable);
-    
-    /// Return drawable objects by a query.
-    void GetDrawables(OctreeQuery& query) const;
-    /// Return drawable objects by a ray query.
-    void Raycast(RayOctreeQuery& query) const;
-    /// Return the closest drawable object by a ray query.
-    void RaycastSingle(RayOctreeQuery& query) const;
-    /// Return subdivision levels.
-    unsigned GetNumLevels() const { return numLevels_; }
-    
-    /// Mark drawable object as requiring an update and a reinsertion.
-    void QueueUpdate(Drawable* drawable);
-    /// Cancel drawable object's update.
-    void CancelUpdate(Drawable* drawable);
-    /// Visualize the component as debug geometry.
-    void DrawDebugGeometry(bool depthTest);
-    
-private:
-    /// Handle render update in case of headless execution.
-    void HandleRenderUpdate(StringHash eventType, VariantMap& eventData);
-    
-    /// Drawable objects that require update.
-    PODVector<Drawable*> drawableUpdates_;
-    /// Drawable objects that require reinsertion.
-    PODVector<Drawable*> drawableReinsertions_;
-    /// Mutex for octree reinsertions.
-    Mutex octreeMutex_;
-    /// Current threaded ray query.
-    mutable RayOctreeQuery* rayQuery_;
-    /// Drawable list for threaded ray query.
-    mutable PODVector<Drawable*> rayQueryDrawables_;
-    /// Threaded ray query intermediate results.
-    mutable Vector<PODVector<RayQueryResult> > rayQueryResults_;
-    /// Subdivision level.
-    unsigned numLevels_;
-};
-
-}
+//
+// Copyright (c) 2008-2014 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#pragma once
+
+#include "Allocator.h"
+#include "Drawable.h"
+#include "List.h"
+#include "Mutex.h"
+#include "OctreeQuery.h"
+
+namespace Urho3D
+{
+
+class DrawableBVH;
+class Octree;
+
+static const int NUM_OCTANTS = 8;
+static const unsigned ROOT_INDEX = M_MAX_UNSIGNED;
+
+/// Packed world bounding boxes and view masks of four drawables for batched frustum culling.
+struct DrawableCullingBlock
+{
+    /// Bounding box center X coordinates.
+    float centerX_[4];
+    /// Bounding box center Y coordinates.
+    float centerY_[4];
+    /// Bounding box center Z coordinates.
+    float centerZ_[4];
+    /// Bounding box half size X coordinates.
+    float halfSizeX_[4];
+    /// Bounding box half size Y coordinates.
+    float halfSizeY_[4];
+    /// Bounding box half size Z coordinates.
+    float halfSizeZ_[4];
+    /// View masks. Zero for unused slots.
+    unsigned viewMask_[4];
+};
+
+/// %Octree octant
+class URHO3D_API Octant
+{
+    friend class Octree;
+    
+public:
+    /// Construct.
+    Octant(const BoundingBox& box, unsigned level, Octant* parent, Octree* root, unsigned index = ROOT_INDEX);
+    /// Destruct. Move drawables to root if available (detach if not) and free child octants.
+    virtual ~Octant();
+    
+    /// Return or create a child octant.
+    Octant* GetOrCreateChild(unsigned index);
+    /// Delete child octant.
+    void DeleteChild(unsigned index);
+    /// Insert a drawable object by checking for fit recursively.
+    void InsertDrawable(Drawable* drawable);
+    /// Check if a drawable object fits.
+    bool CheckDrawableFit(const BoundingBox& box) const;
+    
+    /// Add a drawable object to this octant.
+    void AddDrawable(Drawable* drawable);
+    /// Remove a drawable object from this octant.
+    void RemoveDrawable(Drawable* drawable, bool resetOctant = true);
+    
+    /// Return world-space bounding box.
+    const BoundingBox& GetWorldBoundingBox() const { return worldBoundingBox_; }
+    /// Return bounding box used for fitting drawable objects.
+    const BoundingBox& GetCullingBox() const { return cullingBox_; }
+    /// Return subdivision level.
+    unsigned GetLevel() const { return level_; }
+    /// Return parent octant.
+    Octant* GetParent() const { return parent_; }
+    /// Return octree root.
+    Octree* GetRoot() const { return root_; }
+    /// Return number of drawables.
+    unsigned GetNumDrawables() const { return numDrawables_; }
+    /// Return true if there are no drawable objects in this octant and child octants.
+    bool IsEmpty() { return numDrawables_ == 0; }
+    
+    /// Mark the packed drawable culling data as needing a rebuild on the next octree update. Until then queries test the drawables one by one.
+    void MarkCullingBlocksDirty();
+    /// Rebuild the packed drawable culling data. Called by the octree.
+    void UpdateCullingBlocks();
+    /// Refresh the packed world bounding box of a drawable after it has been recalculated. Called by the drawable.
+    void UpdateCullingBounds(Drawable* drawable);
+    /// Detach drawable objects recursively. Called when the whole octree is being destroyed.
+    void DetachDrawables();
+    /// Draw bounds to the debug graphics recursively.
+    void DrawDebugGeometry(DebugRenderer* debug, bool depthTest);
+    
+protected:
+    /// Initialize bounding box.
+    void Initialize(const BoundingBox& box);
+    /// Return drawable objects by a query, called internally.
+    void GetDrawablesInternal(OctreeQuery& query, bool inside) const;
+    /// Return drawable objects by a frustum-based query using the packed culling data, called internally.
+    void GetDrawablesBatched(OctreeQuery& query, const Frustum& frustum) const;
+    /// Return drawable objects by a ray query, called internally.
+    void GetDrawablesInternal(RayOctreeQuery& query) const;
+    /// Return drawable objects only for a threaded ray query, called internally.
+    void GetDrawablesOnlyInternal(RayOctreeQuery& query, PODVector<Drawable*>& drawables) const;
+    
+    /// Increase drawable object count recursively.
+    void IncDrawableCount()
+    {
+        ++numDrawables_;
+        if (parent_)
+            parent_->IncDrawableCount();
+    }
+    
+    /// Decrease drawable object count recursively and queue octant for removal if it becomes empty.
+    void DecDrawableCount()
+    {
+        --numDrawables_;
+        if (parent_)
+        {
+            if (!numDrawables_)
+                MarkEmpty();
+            parent_->DecDrawableCount();
+        }
+    }
+    
+    /// Queue an empty octant for delayed removal.
+    void MarkEmpty();
+    
+    /// World bounding box.
+    BoundingBox worldBoundingBox_;
+    /// Bounding box used for drawable object fitting.
+    BoundingBox cullingBox_;
+    /// Drawable objects.
+    PODVector<Drawable*> drawables_;
+    /// Packed culling data of the drawable objects, in the same order.
+    PODVector<DrawableCullingBlock> cullingBlocks_;
+    /// Child octants.
+    Octant* children_[NUM_OCTANTS];
+    /// World bounding box center.
+    Vector3 center_;
+    /// World bounding box half size.
+    Vector3 halfSize_;
+    /// Subdivision level.
+    unsigned level_;
+    /// Number of drawable objects in this octant and child octants.
+    unsigned numDrawables_;
+    /// Parent octant.
+    Octant* parent_;
+    /// Octree root.
+    Octree* root_;
+    /// Octant index relative to its siblings or ROOT_INDEX for root octant
+    unsigned index_;
+    /// Number of octree updates the octant has been empty for.
+    unsigned emptyFrames_;
+    /// Packed culling data needs rebuild flag.
+    bool cullingBlocksDirty_;
+    /// Queued for removal flag.
+    bool emptyQueued_;
+};
+
+/// %Octree component. Should be added only to the root scene node
+class URHO3D_API Octree : public Component, public Octant
+{
+    friend class Octant;
+    friend void RaycastDrawablesWork(const WorkItem* item, unsigned threadIndex);
+    
+    OBJECT(Octree);
+    
+public:
+    /// Construct.
+    Octree(Context* context);
+    /// Destruct.
+    ~Octree();
+    /// Register object factory.
+    static void RegisterObject(Context* context);
+    
+    /// Handle attribute change.
+    virtual void OnSetAttribute(const AttributeInfo& attr, const Variant& src);
+    /// Visualize the component as debug geometry.
+    virtual void DrawDebugGeometry(DebugRenderer* debug, bool depthTest);
+    
+    /// Set size and maximum subdivision levels. If octree is not empty, drawable objects will be temporarily moved to the root.
+    void SetSize(const BoundingBox& box, unsigned numLevels);
+    /// Set looseness, the size of an octant's culling box relative to its actual size. Higher values allow drawable objects to move further before reinsertion, at the cost of less exact culling. Default 2.
+    void SetLooseness(float looseness);
+    /// Set whether to use a bounding volume hierarchy instead of the octants for queries. The hierarchy adapts to uneven drawable distributions and large worlds better, at the cost of refitting and rebuilding it as drawables move.
+    void SetUseBVH(bool enable);
+    /// Update and reinsert drawable objects.
+    void Update(const FrameInfo& frame);
+    /// Add a drawable manually.
+    void AddManualDrawable(Drawable* drawable);
+    /// Remove a manually added drawable.
+    void RemoveManualDrawable(Drawable* drawable);
+    
+    /// Return drawable objects by a query.
+    void GetDrawables(OctreeQuery& query) const;
+    /// Return drawable objects by a ray query.
+    void Raycast(RayOctreeQuery& query) const;
+    /// Return the closest drawable object by a ray query.
+    void RaycastSingle(RayOctreeQuery& query) const;
+    /// Return subdivision levels.
+    unsigned GetNumLevels() const { return numLevels_; }
+    /// Return looseness.
+    float GetLooseness() const { return looseness_; }
+    /// Return whether a bounding volume hierarchy is used for queries.
+    bool GetUseBVH() const { return bvh_ != 0; }
+    
+    /// Mark drawable object as requiring an update and a reinsertion.
+    void QueueUpdate(Drawable* drawable);
+    /// Cancel drawable object's update.
+    void CancelUpdate(Drawable* drawable);
+    /// Visualize the component as debug geometry.
+    void DrawDebugGeometry(bool depthTest);
+    
+private:
+    /// Handle render update in case of headless execution.
+    void HandleRenderUpdate(StringHash eventType, VariantMap& eventData);
+    /// Add drawable objects of an octant and its children to the bounding volume hierarchy.
+    void AddDrawablesToBVH(Octant* octant);
+    
+    /// Drawable objects that require update.
+    PODVector<Drawable*> drawableUpdates_;
+    /// Drawable objects that require reinsertion.
+    PODVector<Drawable*> drawableReinsertions_;
+    /// Octants whose packed drawable culling data needs rebuild.
+    PODVector<Octant*> dirtyCullingOctants_;
+    /// Empty octants queued for removal.
+    PODVector<Octant*> emptyOctants_;
+    /// Bounding volume hierarchy used for queries when enabled.
+    DrawableBVH* bvh_;
+    /// Allocator for child octants.
+    AllocatorBlock* octantAllocator_;
+    /// Mutex for octree reinsertions.
+    Mutex octreeMutex_;
+    /// Current threaded ray query.
+    mutable RayOctreeQuery* rayQuery_;
+    /// Drawable list for threaded ray query.
+    mutable PODVector<Drawable*> rayQueryDrawables_;
+    /// Threaded ray query intermediate results.
+    mutable Vector<PODVector<RayQueryResult> > rayQueryResults_;
+    /// Subdivision level.
+    unsigned numLevels_;
+    /// Culling box size relative to octant size.
+    float looseness_;
+};
+
+}
@@ -0,0 +1,515 @@
+//
+// Copyright (c) 2008-2014 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "Precompiled.h"
+#include "Batch.h"
+#include "Geometry.h"
+#include "Graphics.h"
+#include "RenderCommandBuffer.h"
+#include "ShaderProgram.h"
+#include "ShaderVariation.h"
+#include "Texture.h"
+#include "Variant.h"
+#include "VertexBuffer.h"
+
+#include "DebugNew.h"
+
+namespace Urho3D
+{
+
+RenderCommandBuffer::RenderCommandBuffer() :
+    graphics_(0)
+{
+    Clear();
+}
+
+void RenderCommandBuffer::Clear()
+{
+    commands_.Clear();
+    data_.Clear();
+    ClearParameterSources();
+    
+    viewport_ = IntRect::ZERO;
+    vertexShader_ = 0;
+    pixelShader_ = 0;
+    shaderProgram_ = 0;
+    constantDepthBias_ = 0.0f;
+    slopeScaledDepthBias_ = 0.0f;
+    blendMode_ = MAX_BLENDMODES;
+    cullMode_ = MAX_CULLMODES;
+    depthTestMode_ = MAX_COMPAREMODES;
+    depthWrite_ = M_MAX_UNSIGNED;
+    texturesValid_ = 0;
+    shadersValid_ = false;
+    viewportValid_ = false;
+    depthBiasValid_ = false;
+}
+
+void RenderCommandBuffer::SetViewport(const IntRect& rect)
+{
+    if (viewportValid_ && rect == viewport_)
+        return;
+    
+    RecordedCommand& command = AddCommand(RCMD_VIEWPORT);
+    command.args_[0] = (unsigned)rect.left_;
+    command.args_[1] = (unsigned)rect.top_;
+    command.args_[2] = (unsigned)rect.right_;
+    command.args_[3] = (unsigned)rect.bottom_;
+    
+    viewport_ = rect;
+    viewportValid_ = true;
+}
+
+void RenderCommandBuffer::SetShaders(ShaderVariation* vs, ShaderVariation* ps)
+{
+    if (shadersValid_ && vs == vertexShader_ && ps == pixelShader_)
+        return;
+    
+    RecordedCommand& command = AddCommand(RCMD_SHADERS);
+    command.object_ = vs;
+    command.object2_ = ps;
+    
+    vertexShader_ = vs;
+    pixelShader_ = ps;
+    #ifdef URHO3D_OPENGL
+    shaderProgram_ = graphics_ && vs && ps ? graphics_->GetShaderProgram(vs, ps) : 0;
+    #endif
+    shadersValid_ = true;
+    ClearParameterSources();
+}
+
+void RenderCommandBuffer::SetShaderParameter(StringHash param, const float* data, unsigned count)
+{
+    AddParameter(param, RPT_FLOATS, data, count);
+}
+
+void RenderCommandBuffer::SetShaderParameter(StringHash param, float value)
+{
+    AddParameter(param, RPT_FLOAT, &value, 1);
+}
+
+void RenderCommandBuffer::SetShaderParameter(StringHash param, bool value)
+{
+    float data = value ? 1.0f : 0.0f;
+    AddParameter(param, RPT_BOOL, &data, 1);
+}
+
+void RenderCommandBuffer::SetShaderParameter(StringHash param, const Color& color)
+{
+    AddParameter(param, RPT_COLOR, color.Data(), 4);
+}
+
+void RenderCommandBuffer::SetShaderParameter(StringHash param, const Vector2& vector)
+{
+    AddParameter(param, RPT_VECTOR2, vector.Data(), 2);
+}
+
+void RenderCommandBuffer::SetShaderParameter(StringHash param, const Matrix3& matrix)
+{
+    AddParameter(param, RPT_MATRIX3, matrix.Data(), 9);
+}
+
+void RenderCommandBuffer::SetShaderParameter(StringHash param, const Vector3& vector)
+{
+    AddParameter(param, RPT_VECTOR3, vector.Data(), 3);
+}
+
+void RenderCommandBuffer::SetShaderParameter(StringHash param, const Matrix4& matrix)
+{
+    AddParameter(param, RPT_MATRIX4, matrix.Data(), 16);
+}
+
+void RenderCommandBuffer::SetShaderParameter(StringHash param, const Vector4& vector)
+{
+    AddParameter(param, RPT_VECTOR4, vector.Data(), 4);
+}
+
+void RenderCommandBuffer::SetShaderParameter(StringHash param, const Matrix3x4& matrix)
+{
+    AddParameter(param, RPT_MATRIX3X4, matrix.Data(), 12);
+}
+
+void RenderCommandBuffer::SetShaderParameter(StringHash param, const Variant& value)
+{
+    switch (value.GetType())
+    {
+    case VAR_BOOL:
+        SetShaderParameter(param, value.GetBool());
+        break;
+        
+    case VAR_FLOAT:
+        SetShaderParameter(param, value.GetFloat());
+        break;
+        
+    case VAR_VECTOR2:
+        SetShaderParameter(param, value.GetVector2());
+        break;
+        
+    case VAR_VECTOR3:
+        SetShaderParameter(param, value.GetVector3());
+        break;
+        
+    case VAR_VECTOR4:
+        SetShaderParameter(param, value.GetVector4());
+        break;
+        
+    case VAR_COLOR:
+        SetShaderParameter(param, value.GetColor());
+        break;
+        
+    case VAR_MATRIX3:
+        SetShaderParameter(param, value.GetMatrix3());
+        break;
+        
+    case VAR_MATRIX3X4:
+        SetShaderParameter(param, value.GetMatrix3x4());
+        break;
+        
+    case VAR_MATRIX4:
+        SetShaderParameter(param, value.GetMatrix4());
+        break;
+        
+    default:
+        // Unsupported parameter type, do nothing
+        break;
+    }
+}
+
+bool RenderCommandBuffer::NeedParameterUpdate(ShaderParameterGroup group, const void* source)
+{
+    if ((unsigned)(size_t)parameterSources_[group] == M_MAX_UNSIGNED || parameterSources_[group] != source)
+    {
+        parameterSources_[group] = source;
+        return true;
+    }
+    else
+        return false;
+}
+
+bool RenderCommandBuffer::HasShaderParameter(ShaderType type, StringHash param) const
+{
+    #ifdef URHO3D_OPENGL
+    if (!vertexShader_ || !pixelShader_)
+        return false;
+    return !shaderProgram_ || shaderProgram_->HasParameter(param);
+    #else
+    if (type == VS)
+        return vertexShader_ && vertexShader_->HasParameter(param);
+    else
+        return pixelShader_ && pixelShader_->HasParameter(param);
+    #endif
+}
+
+bool RenderCommandBuffer::HasTextureUnit(TextureUnit unit) const
+{
+    #ifdef URHO3D_OPENGL
+    if (!vertexShader_ || !pixelShader_)
+        return false;
+    return !shaderProgram_ || shaderProgram_->HasTextureUnit(unit);
+    #else
+    return pixelShader_ && pixelShader_->HasTextureUnit(unit);
+    #endif
+}
+
+void RenderCommandBuffer::SetTexture(unsigned index, Texture* texture)
+{
+    if (index >= MAX_TEXTURE_UNITS)
+        return;
+    
+    unsigned bit = 1 << index;
+    if ((texturesValid_ & bit) && textures_[index] == texture)
+        return;
+    
+    RecordedCommand& command = AddCommand(RCMD_TEXTURE);
+    command.object_ = texture;
+    command.args_[0] = index;
+    
+    textures_[index] = texture;
+    texturesValid_ |= bit;
+}
+
+void RenderCommandBuffer::SetBlendMode(BlendMode mode)
+{
+    if (mode == blendMode_)
+        return;
+    
+    AddCommand(RCMD_BLENDMODE).args_[0] = mode;
+    blendMode_ = mode;
+}
+
+void RenderCommandBuffer::SetCullMode(CullMode mode)
+{
+    if (mode == cullMode_)
+        return;
+    
+    AddCommand(RCMD_CULLMODE).args_[0] = mode;
+    cullMode_ = mode;
+}
+
+void RenderCommandBuffer::SetDepthBias(float constantBias, float slopeScaledBias)
+{
+    if (depthBiasValid_ && constantBias == constantDepthBias_ && slopeScaledBias == slopeScaledDepthBias_)
+        return;
+    
+    RecordedCommand& command = AddCommand(RCMD_DEPTHBIAS);
+    command.args_[0] = data_.Size();
+    data_.Push(constantBias);
+    data_.Push(slopeScaledBias);
+    
+    constantDepthBias_ = constantBias;
+    slopeScaledDepthBias_ = slopeScaledBias;
+    depthBiasValid_ = true;
+    #ifdef URHO3D_OPENGL
+    // The constant bias is applied to the projection matrix, so camera parameters must be set again
+    parameterSources_[SP_CAMERA] = (const void*)M_MAX_UNSIGNED;
+    #endif
+}
+
+void RenderCommandBuffer::SetDepthTest(CompareMode mode)
+{
+    if (mode == depthTestMode_)
+        return;
+    
+    AddCommand(RCMD_DEPTHTEST).args_[0] = mode;
+    depthTestMode_ = mode;
+}
+
+void RenderCommandBuffer::SetDepthWrite(bool enable)
+{
+    unsigned value = enable ? 1 : 0;
+    if (value == depthWrite_)
+        return;
+    
+    AddCommand(RCMD_DEPTHWRITE).args_[0] = value;
+    depthWrite_ = value;
+}
+
+void RenderCommandBuffer::SetScissorTest(bool enable, const Rect& rect, bool borderInclusive)
+{
+    RecordedCommand& command = AddCommand(RCMD_SCISSORTEST);
+    command.args_[0] = enable ? 1 : 0;
+    command.args_[1] = borderInclusive ? 1 : 0;
+    command.args_[2] = data_.Size();
+    data_.Push(rect.min_.x_);
+    data_.Push(rect.min_.y_);
+    data_.Push(rect.max_.x_);
+    data_.Push(rect.max_.y_);
+}
+
+void RenderCommandBuffer::SetStencilTest(bool enable, CompareMode mode, StencilOp pass, StencilOp fail, StencilOp zFail,
+    unsigned stencilRef, unsigned compareMask, unsigned writeMask)
+{
+    RecordedCommand& command = AddCommand(RCMD_STENCILTEST);
+    command.args_[0] = (enable ? 1 : 0) | (mode << 8) | (pass << 16) | (fail << 20) | (zFail << 24);
+    command.args_[1] = stencilRef;
+    command.args_[2] = compareMask;
+    command.args_[3] = writeMask;
+}
+
+void RenderCommandBuffer::Draw(Geometry* geometry)
+{
+    AddCommand(RCMD_DRAW).object_ = geometry;
+}
+
+void RenderCommandBuffer::DrawInstances(const BatchGroup* group, VertexBuffer* instanceBuffer)
+{
+    RecordedCommand& command = AddCommand(RCMD_DRAWINSTANCES);
+    command.object_ = group;
+    command.object2_ = instanceBuffer;
+}
+
+unsigned RenderCommandBuffer::Execute(Graphics* graphics) const
+{
+    unsigned numDraws = 0;
+    
+    if (!graphics)
+    {
+        for (PODVector<RecordedCommand>::ConstIterator i = commands_.Begin(); i != commands_.End(); ++i)
+        {
+            if (i->type_ == RCMD_DRAW || i->type_ == RCMD_DRAWINSTANCES)
+                ++numDraws;
+        }
+        return numDraws;
+    }
+    
+    // Graphics does not know about the parameters set from here, so forget its sources both before and after
+    graphics->ClearParameterSources();
+    
+    const float* data = data_.Empty() ? 0 : &data_[0];
+    
+    for (PODVector<RecordedCommand>::ConstIterator i = commands_.Begin(); i != commands_.End(); ++i)
+    {
+        const RecordedCommand& command = *i;
+        
+        switch (command.type_)
+        {
+        case RCMD_VIEWPORT:
+            graphics->SetViewport(IntRect((int)command.args_[0], (int)command.args_[1], (int)command.args_[2],
+                (int)command.args_[3]));
+            break;
+            
+        case RCMD_SHADERS:
+            graphics->SetShaders((ShaderVariation*)command.object_, (ShaderVariation*)command.object2_);
+            break;
+            
+        case RCMD_PARAMETER:
+            {
+                StringHash param(command.args_[0]);
+                const float* values = data + command.args_[2];
+                
+                switch (command.args_[1])
+                {
+                case RPT_FLOATS:
+                    graphics->SetShaderParameter(param, values, command.args_[3]);
+                    break;
+                    
+                case RPT_FLOAT:
+                    graphics->SetShaderParameter(param, values[0]);
+                    break;
+                    
+                case RPT_BOOL:
+                    graphics->SetShaderParameter(param, values[0] != 0.0f);
+                    break;
+                    
+                case RPT_COLOR:
+                    graphics->SetShaderParameter(param, *reinterpret_cast<const Color*>(values));
+                    break;
+                    
+                case RPT_VECTOR2:
+                    graphics->SetShaderParameter(param, *reinterpret_cast<const Vector2*>(values));
+                    break;
+                    
+                case RPT_VECTOR3:
+                    graphics->SetShaderParameter(param, *reinterpret_cast<const Vector3*>(values));
+                    break;
+                    
+                case RPT_VECTOR4:
+                    graphics->SetShaderParameter(param, *reinterpret_cast<const Vector4*>(values));
+                    break;
+                    
+                case RPT_MATRIX3:
+                    graphics->SetShaderParameter(param, *reinterpret_cast<const Matrix3*>(values));
+                    break;
+                    
+                case RPT_MATRIX3X4:
+                    graphics->SetShaderParameter(param, *reinterpret_cast<const Matrix3x4*>(values));
+                    break;
+                    
+                case RPT_MATRIX4:
+                    graphics->SetShaderParameter(param, *reinterpret_cast<const Matrix4*>(values));
+                    break;
+                }
+            }
+            break;
+            
+        case RCMD_TEXTURE:
+            if (graphics->HasTextureUnit((TextureUnit)command.args_[0]))
+                graphics->SetTexture(command.args_[0], (Texture*)command.object_);
+            break;
+            
+        case RCMD_BLENDMODE:
+            graphics->SetBlendMode((BlendMode)command.args_[0]);
+            break;
+            
+        case RCMD_CULLMODE:
+            graphics->SetCullMode((CullMode)command.args_[0]);
+            break;
+            
+        case RCMD_DEPTHBIAS:
+            graphics->SetDepthBias(data[command.args_[0]], data[command.args_[0] + 1]);
+            break;
+            
+        case RCMD_DEPTHTEST:
+            graphics->SetDepthTest((CompareMode)command.args_[0]);
+            break;
+            
+        case RCMD_DEPTHWRITE:
+            graphics->SetDepthWrite(command.args_[0] != 0);
+            break;
+            
+        case RCMD_SCISSORTEST:
+            {
+                const float* values = data + command.args_[2];
+                graphics->SetScissorTest(command.args_[0] != 0, Rect(values[0], values[1], values[2], values[3]),
+                    command.args_[1] != 0);
+            }
+            break;
+            
+        case RCMD_STENCILTEST:
+            {
+                unsigned flags = command.args_[0];
+                graphics->SetStencilTest((flags & 0xff) != 0, (CompareMode)((flags >> 8) & 0xff), (StencilOp)((flags >> 16) & 0xf),
+                    (StencilOp)((flags >> 20) & 0xf), (StencilOp)((flags >> 24) & 0xf), command.args_[1], command.args_[2],
+                    command.args_[3]);
+            }
+            break;
+            
+        case RCMD_DRAW:
+            ((Geometry*)command.object_)->Draw(graphics);
+            ++numDraws;
+            break;
+            
+        case RCMD_DRAWINSTANCES:
+            // Transforms may have been set from the command buffer, so Graphics can not skip them
+            graphics->ClearParameterSource(SP_OBJECTTRANSFORM);
+            ((const BatchGroup*)command.object_)->DrawInstances(graphics, (VertexBuffer*)command.object2_);
+            ++numDraws;
+            break;
+        }
+    }
+    
+    graphics->ClearParameterSources();
+    
+    return numDraws;
+}
+
+RecordedCommand& RenderCommandBuffer::AddCommand(RecordedCommandType type)
+{
+    commands_.Resize(commands_.Size() + 1);
+    RecordedCommand& command = commands_.Back();
+    command.type_ = type;
+    command.object_ = 0;
+    command.object2_ = 0;
+    return command;
+}
+
+void RenderCommandBuffer::AddParameter(StringHash param, RenderParameterType type, const float* data, unsigned count)
+{
+    RecordedCommand& command = AddCommand(RCMD_PARAMETER);
+    command.args_[0] = param.Value();
+    command.args_[1] = type;
+    command.args_[2] = data_.Size();
+    command.args_[3] = count;
+    
+    unsigned start = data_.Size();
+    data_.Resize(start + count);
+    for (unsigned i = 0; i < count; ++i)
+        data_[start + i] = data[i];
+}
+
+void RenderCommandBuffer::ClearParameterSources()
+{
+    for (unsigned i = 0; i < MAX_SHADER_PARAMETER_GROUPS; ++i)
+        parameterSources_[i] = (const void*)M_MAX_UNSIGNED;
+}
+
+}
@@ -0,0 +1,221 @@
+//
+// Copyright (c) 2008-2014 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#pragma once
+
+#include "GraphicsDefs.h"
+#include "Vector.h"
+#include "Rect.h"
+#include "StringHash.h"
+
+namespace Urho3D
+{
+
+class Color;
+struct BatchGroup;
+class Geometry;
+class Graphics;
+class Matrix3;
+class Matrix3x4;
+class Matrix4;
+class ShaderProgram;
+class ShaderVariation;
+class Texture;
+class Variant;
+class Vector2;
+class Vector3;
+class Vector4;
+class VertexBuffer;
+
+/// Recorded render command type.
+enum RecordedCommandType
+{
+    RCMD_VIEWPORT = 0,
+    RCMD_SHADERS,
+    RCMD_PARAMETER,
+    RCMD_TEXTURE,
+    RCMD_BLENDMODE,
+    RCMD_CULLMODE,
+    RCMD_DEPTHBIAS,
+    RCMD_DEPTHTEST,
+    RCMD_DEPTHWRITE,
+    RCMD_SCISSORTEST,
+    RCMD_STENCILTEST,
+    RCMD_DRAW,
+    RCMD_DRAWINSTANCES
+};
+
+/// Recorded shader parameter type, which selects the Graphics function used on replay.
+enum RenderParameterType
+{
+    RPT_FLOATS = 0,
+    RPT_FLOAT,
+    RPT_BOOL,
+    RPT_COLOR,
+    RPT_VECTOR2,
+    RPT_VECTOR3,
+    RPT_VECTOR4,
+    RPT_MATRIX3,
+    RPT_MATRIX3X4,
+    RPT_MATRIX4
+};
+
+/// Recorded render command.
+struct RecordedCommand
+{
+    /// Command type.
+    RecordedCommandType type_;
+    /// Object argument: vertex shader, texture, geometry or batch group.
+    const void* object_;
+    /// Second object argument: pixel shader or instancing vertex buffer.
+    const void* object2_;
+    /// Integer arguments.
+    unsigned args_[4];
+};
+
+/// List of rendering commands that can be recorded in any thread without accessing Graphics, and replayed later in the main thread. Keeps its memory between frames. Mimics the subset of the Graphics API used for drawing batches, including shader parameter source tracking.
+class URHO3D_API RenderCommandBuffer
+{
+public:
+    /// Construct.
+    RenderCommandBuffer();
+    
+    /// Clear the commands and the recorded state. Keeps the allocated memory.
+    void Clear();
+    /// Set the graphics subsystem used to look up linked shader programs. Graphics must not change shaders while recording.
+    void SetGraphics(Graphics* graphics) { graphics_ = graphics; }
+    /// Set viewport.
+    void SetViewport(const IntRect& rect);
+    /// Set shaders.
+    void SetShaders(ShaderVariation* vs, ShaderVariation* ps);
+    /// Set shader float constants.
+    void SetShaderParameter(StringHash param, const float* data, unsigned count);
+    /// Set shader float constant.
+    void SetShaderParameter(StringHash param, float value);
+    /// Set shader boolean constant.
+    void SetShaderParameter(StringHash param, bool value);
+    /// Set shader color constant.
+    void SetShaderParameter(StringHash param, const Color& color);
+    /// Set shader 2D vector constant.
+    void SetShaderParameter(StringHash param, const Vector2& vector);
+    /// Set shader 3x3 matrix constant.
+    void SetShaderParameter(StringHash param, const Matrix3& matrix);
+    /// Set shader 3D vector constant.
+    void SetShaderParameter(StringHash param, const Vector3& vector);
+    /// Set shader 4x4 matrix constant.
+    void SetShaderParameter(StringHash param, const Matrix4& matrix);
+    /// Set shader 4D vector constant.
+    void SetShaderParameter(StringHash param, const Vector4& vector);
+    /// Set shader 3x4 matrix constant.
+    void SetShaderParameter(StringHash param, const Matrix3x4& matrix);
+    /// Set shader constant from a variant. Supported variant types: bool, float, vector2, vector3, vector4, color, matrices.
+    void SetShaderParameter(StringHash param, const Variant& value);
+    /// Check whether a shader parameter group needs update, same as Graphics does. Sources are forgotten when shaders or depth bias change.
+    bool NeedParameterUpdate(ShaderParameterGroup group, const void* source);
+    /// Return whether the recorded shaders have a parameter. On OpenGL, returns true if the shader program has not been linked yet, as unused parameters are ignored on replay.
+    bool HasShaderParameter(ShaderType type, StringHash param) const;
+    /// Return whether the recorded shaders use a texture unit. On OpenGL, returns true if the shader program has not been linked yet, as textures are bound on replay only if the shaders use the unit.
+    bool HasTextureUnit(TextureUnit unit) const;
+    /// Set texture.
+    void SetTexture(unsigned index, Texture* texture);
+    /// Set blending mode.
+    void SetBlendMode(BlendMode mode);
+    /// Set hardware culling mode.
+    void SetCullMode(CullMode mode);
+    /// Set depth bias.
+    void SetDepthBias(float constantBias, float slopeScaledBias);
+    /// Set depth compare.
+    void SetDepthTest(CompareMode mode);
+    /// Set depth write on/off.
+    void SetDepthWrite(bool enable);
+    /// Set scissor test.
+    void SetScissorTest(bool enable, const Rect& rect = Rect::FULL, bool borderInclusive = true);
+    /// Set stencil test.
+    void SetStencilTest(bool enable, CompareMode mode = CMP_ALWAYS, StencilOp pass = OP_KEEP, StencilOp fail = OP_KEEP, StencilOp zFail = OP_KEEP, unsigned stencilRef = 0, unsigned compareMask = M_MAX_UNSIGNED, unsigned writeMask = M_MAX_UNSIGNED);
+    /// Draw a geometry.
+    void Draw(Geometry* geometry);
+    /// Draw the instances of a batch group. The group must stay valid until the commands are executed.
+    void DrawInstances(const BatchGroup* group, VertexBuffer* instanceBuffer);
+    
+    /// Replay the commands and return the number of draw calls. If graphics is null, only walk the commands, which allows measuring the recording cost without a rendering device.
+    unsigned Execute(Graphics* graphics) const;
+    
+    /// Return number of commands.
+    unsigned GetNumCommands() const { return commands_.Size(); }
+    /// Return whether has no commands.
+    bool IsEmpty() const { return commands_.Empty(); }
+    /// Return the last recorded viewport.
+    const IntRect& GetViewport() const { return viewport_; }
+    /// Return the last recorded blending mode.
+    BlendMode GetBlendMode() const { return blendMode_; }
+    /// Return the last recorded constant depth bias.
+    float GetDepthConstantBias() const { return constantDepthBias_; }
+    
+private:
+    /// Add a command and return it.
+    RecordedCommand& AddCommand(RecordedCommandType type);
+    /// Add a shader parameter command with data.
+    void AddParameter(StringHash param, RenderParameterType type, const float* data, unsigned count);
+    /// Forget the parameter sources.
+    void ClearParameterSources();
+    
+    /// Commands.
+    PODVector<RecordedCommand> commands_;
+    /// Shader parameter and scissor rectangle data.
+    PODVector<float> data_;
+    /// Graphics subsystem for shader program lookup.
+    Graphics* graphics_;
+    /// Shader parameter sources.
+    const void* parameterSources_[MAX_SHADER_PARAMETER_GROUPS];
+    /// Textures.
+    Texture* textures_[MAX_TEXTURE_UNITS];
+    /// Viewport.
+    IntRect viewport_;
+    /// Vertex shader.
+    ShaderVariation* vertexShader_;
+    /// Pixel shader.
+    ShaderVariation* pixelShader_;
+    /// Linked shader program of the recorded shaders, or null if not known. Used only on OpenGL.
+    ShaderProgram* shaderProgram_;
+    /// Constant depth bias.
+    float constantDepthBias_;
+    /// Slope-scaled depth bias.
+    float slopeScaledDepthBias_;
+    /// Blending mode.
+    BlendMode blendMode_;
+    /// Culling mode.
+    CullMode cullMode_;
+    /// Depth compare mode.
+    CompareMode depthTestMode_;
+    /// Depth write. 0 = off, 1 = on, other = not recorded yet.
+    unsigned depthWrite_;
+    /// Bitmask of texture units recorded so far.
+    unsigned texturesValid_;
+    /// Shaders recorded flag.
+    bool shadersValid_;
+    /// Viewport recorded flag.
+    bool viewportValid_;
+    /// Depth bias recorded flag.
+    bool depthBiasValid_;
+};
+
+}
@@ -1,519 +1,792 @@
-//
-// Copyright (c) 2008-2014 the Urho3D project.
-//
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-//
-// The above copyright notice and this permission notice shall be included in
-// all copies or substantial portions of the Software.
-//
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
-// THE SOFTWARE.
-//
-
-#include "Precompiled.h"
-#include "File.h"
-#include "FileSystem.h"
-#include "Log.h"
-#include "MemoryBuffer.h"
-#include "PackageFile.h"
-#include "Profiler.h"
-
-#include <cstdio>
-#include <lz4.h>
-
-#include "DebugNew.h"
-
-namespace Urho3D
-{
-
-#ifdef WIN32
-static const wchar_t* openMode[] =
-{
-    L"rb",
-    L"wb",
-    L"r+b",
-    L"w+b"
-};
-#else
-static const char* openMode[] =
-{
-    "rb",
-    "wb",
-    "r+b",
-    "w+b"
-};
-#endif
-
-static const unsigned READ_BUFFER_SIZE = 32768;
-static const unsigned SKIP_BUFFER_SIZE = 1024;
-
-File::File(Context* context) :
-    Object(context),
-    mode_(FILE_READ),
-    handle_(0),
-    #ifdef ANDROID
-    assetHandle_(0),
-    #endif
-    readBufferOffset_(0),
-    readBufferSize_(0),
-    offset_(0),
-    checksum_(0),
-    compressed_(false),
-    readSyncNeeded_(false),
-    writeSyncNeeded_(false)
-{
-}
-
-File::File(Context* context, const String& fileName, FileMode mode) :
-    Object(context),
-    mode_(FILE_READ),
-    handle_(0),
-    #ifdef ANDROID
-    assetHandle_(0),
-    #endif
-    readBufferOffset_(0),
-    readBufferSize_(0),
-    offset_(0),
-    checksum_(0),
-    compressed_(false),
-    readSyncNeeded_(false),
-    writeSyncNeeded_(false)
-{
-    Open(fileName, mode);
-}
-
-File::File(Context* context, PackageFile* package, const String& fileName) :
-    Object(context),
-    mode_(FILE_READ),
-    handle_(0),
-    #ifdef ANDROID
-    assetHandle_(0),
-    #endif
-    readBufferOffset_(0),
-    readBufferSize_(0),
-    offset_(0),
-    checksum_(0),
-    compressed_(false),
-    readSyncNeeded_(false),
-    writeSyncNeeded_(false)
-{
-    Open(package, fileName);
-}
-
-File::~File()
-{
-    Close();
-}
-
-bool File::Open(const String& fileName, FileMode mode)
-{
-    Close();
-
-    FileSystem* fileSystem = GetSubsystem<FileSystem>();
-    if (fileSystem && !fileSystem->CheckAccess(GetPath(fileName)))
-    {
-        LOGERROR("Access denied to " + fileName);
-        return false;
-    }
-
-    #ifdef ANDROID
-    if (fileName.StartsWith("/apk/"))
-    {
-        if (mode != FILE_READ)
-        {
-            LOGERROR("Only read mode is supported for asset files");
-            return false;
-        }
-
-        assetHandle_ = SDL_RWFromFile(fileName.Substring(5).CString(), "rb");
-        if (!assetHandle_)
-        {
-            LOGERROR("Could not open asset file " + fileName);
-            return false;
-        }
-        else
-        {
-            fileName_ = fileName;
-            mode_ = mode;
-            position_ = 0;
-            offset_ = 0;
-            checksum_ = 0;
-            size_ = assetHandle_->hidden.androidio.size;
-            readBuffer_ = new unsigned char[READ_BUFFER_SIZE];
-            readBufferOffset_ = 0;
-            readBufferSize_ = 0;
-            return true;
-        }
-    }
-    #endif
-
-    if (fileName.Empty())
-    {
-        LOGERROR("Could not open file with empty name");
-        return false;
-    }
-    
-    #ifdef WIN32
-    handle_ = _wfopen(GetWideNativePath(fileName).CString(), openMode[mode]);
-    #else
-    handle_ = fopen(GetNativePath(fileName).CString(), openMode[mode]);
-    #endif
-
-    // If file did not exist in readwrite mode, retry with write-update mode
-    if (mode == FILE_READWRITE && !handle_)
-    {
-        #ifdef WIN32
-        handle_ = _wfopen(GetWideNativePath(fileName).CString(), openMode[mode + 1]);
-        #else
-        handle_ = fopen(GetNativePath(fileName).CString(), openMode[mode + 1]);
-        #endif
-    }
-    
-    if (!handle_)
-    {
-        LOGERROR("Could not open file " + fileName);
-        return false;
-    }
-
-    fileName_ = fileName;
-    mode_ = mode;
-    position_ = 0;
-    offset_ = 0;
-    checksum_ = 0;
-    compressed_ = false;
-    readSyncNeeded_ = false;
-    writeSyncNeeded_ = false;
-
-    fseek((FILE*)handle_, 0, SEEK_END);
-    size_ = ftell((FILE*)handle_);
-    fseek((FILE*)handle_, 0, SEEK_SET);
-    return true;
-}
-
-bool File::Open(PackageFile* package, const String& fileName)
-{
-    Close();
-
-    if (!package)
-        return false;
-
-    const PackageEntry* entry = package->GetEntry(fileName);
-    if (!entry)
-        return false;
-
-    #ifdef WIN32
-    handle_ = _wfopen(GetWideNativePath(package->GetName()).CString(), L"rb");
-    #else
-    handle_ = fopen(GetNativePath(package->GetName()).CString(), "rb");
-    #endif
-    if (!handle_)
-    {
-        LOGERROR("Could not open package file " + fileName);
-        return false;
-    }
-
-    fileName_ = fileName;
-    mode_ = FILE_READ;
-    offset_ = entry->offset_;
-    checksum_ = entry->checksum_;
-    position_ = 0;
-    size_ = entry->size_;
-    compressed_ = package->IsCompressed();
-    readSyncNeeded_ = false;
-    writeSyncNeeded_ = false;
-    
-    fseek((FILE*)handle_, offset_, SEEK_SET);
-    return true;
-}
-
-unsigned File::Read(void* dest, unsigned size)
-{
-    #ifdef ANDROID
-    if (!handle_ && !assetHandle_)
-    #else
-    if (!handle_)
-    #endif
-    {
-        // Do not log the error further here to prevent spamming the stderr stream
-        return 0;
-    }
-
-    if (mode_ == FILE_WRITE)
-    {
-        LOGERROR("File not opened for reading");
-        return 0;
-    }
-
-    if (size + position_ > size_)
-        size = size_ - position_;
-    if (!size)
-        return 0;
-
-    #ifdef ANDROID
-    if (assetHandle_)
-    {
-        unsigned sizeLeft = size;
-        unsigned char* destPtr = (unsigned char*)dest;
-
-        while (sizeLeft)
-        {
-            if (readBufferOffset_ >= readBufferSize_)
-            {
-                readBufferSize_ = Min((int)size_ - position_, (int)READ_BUFFER_SIZE);
-                readBufferOffset_ = 0;
-                SDL_RWread(assetHandle_, readBuffer_.Get(), readBufferSize_, 1);
-            }
-
-            unsigned copySize = Min((int)(readBufferSize_ - readBufferOffset_), (int)sizeLeft);
-            memcpy(destPtr, readBuffer_.Get() + readBufferOffset_, copySize);
-            destPtr += copySize;
-            sizeLeft -= copySize;
-            readBufferOffset_ += copySize;
-            position_ += copySize;
-        }
-
-        return size;
-    }
-    #endif
-    if (compressed_)
-    {
-        unsigned sizeLeft = size;
-        unsigned char* destPtr = (unsigned char*)dest;
-
-        while (sizeLeft)
-        {
-            if (!readBuffer_ || readBufferOffset_ >= readBufferSize_)
-            {
-                unsigned char blockHeaderBytes[4];
-                fread(blockHeaderBytes, sizeof blockHeaderBytes, 1, (FILE*)handle_);
-
-                MemoryBuffer blockHeader(&blockHeaderBytes[0], sizeof blockHeaderBytes);
-                unsigned unpackedSize = blockHeader.ReadUShort();
-                unsigned packedSize = blockHeader.ReadUShort();
-
-                if (!readBuffer_)
-                {
-                    readBuffer_ = new unsigned char[unpackedSize];
-                    inputBuffer_ = new unsigned char[LZ4_compressBound(unpackedSize)];
-                }
-
-                /// \todo Handle errors
-                fread(inputBuffer_.Get(), packedSize, 1, (FILE*)handle_);
-                LZ4_decompress_fast((const char*)inputBuffer_.Get(), (char *)readBuffer_.Get(), unpackedSize);
-
-                readBufferSize_ = unpackedSize;
-                readBufferOffset_ = 0;
-            }
-
-            unsigned copySize = Min((int)(readBufferSize_ - readBufferOffset_), (int)sizeLeft);
-            memcpy(destPtr, readBuffer_.Get() + readBufferOffset_, copySize);
-            destPtr += copySize;
-            sizeLeft -= copySize;
-            readBufferOffset_ += copySize;
-            position_ += copySize;
-        }
-
-        return size;
-    }
-
-    // Need to reassign the position due to internal buffering when transitioning from writing to reading
-    if (readSyncNeeded_)
-    {
-        fseek((FILE*)handle_, position_ + offset_, SEEK_SET);
-        readSyncNeeded_ = false;
-    }
-    
-    size_t ret = fread(dest, size, 1, (FILE*)handle_);
-    if (ret != 1)
-    {
-        // Return to the position where the read began
-        fseek((FILE*)handle_, position_ + offset_, SEEK_SET);
-        LOGERROR("Error while reading from file " + GetName());
-        return 0;
-    }
-
-    writeSyncNeeded_ = true;
-    position_ += size;
-    return size;
-}
-
-unsigned File::Seek(unsigned position)
-{
-    #ifdef ANDROID
-    if (!handle_ && !assetHandle_)
-    #else
-    if (!handle_)
-    #endif
-    {
-        // Do not log the error further here to prevent spamming the stderr stream
-        return 0;
-    }
-
-    // Allow sparse seeks if writing
-    if (mode_ == FILE_READ && position > size_)
-        position = size_;
-
-    #ifdef ANDROID
-    if (assetHandle_)
-    {
-        SDL_RWseek(assetHandle_, position, SEEK_SET);
-        position_ = position;
-        readBufferOffset_ = 0;
-        readBufferSize_ = 0;
-        return position_;
-    }
-    #endif
-    if (compressed_)
-    {
-        // Start over from the beginning
-        if (position == 0)
-        {
-            position_ = 0;
-            readBufferOffset_ = 0;
-            readBufferSize_ = 0;
-            fseek((FILE*)handle_, offset_, SEEK_SET);
-        }
-        // Skip bytes
-        else if (position >= position_)
-        {
-            unsigned char skipBuffer[SKIP_BUFFER_SIZE];
-            while (position > position_)
-                Read(skipBuffer, Min((int)position - position_, (int)SKIP_BUFFER_SIZE));
-        }
-        else
-            LOGERROR("Seeking backward in a compressed file is not supported");
-
-        return position_;
-    }
-
-    fseek((FILE*)handle_, position + offset_, SEEK_SET);
-    position_ = position;
-    readSyncNeeded_ = false;
-    writeSyncNeeded_ = false;
-    return position_;
-}
-
-unsigned File::Write(const void* data, unsigned size)
-{
-    if (!handle_)
-    {
-        // Do not log the error further here to prevent spamming the stderr stream
-        return 0;
-    }
-
-    if (mode_ == FILE_READ)
-    {
-        LOGERROR("File not opened for writing");
-        return 0;
-    }
-
-    if (!size)
-        return 0;
-
-    // Need to reassign the position due to internal buffering when transitioning from reading to writing
-    if (writeSyncNeeded_)
-    {
-        fseek((FILE*)handle_, position_ + offset_, SEEK_SET);
-        writeSyncNeeded_ = false;
-    }
-    
-    if (fwrite(data, size, 1, (FILE*)handle_) != 1)
-    {
-        // Return to the position where the write began
-        fseek((FILE*)handle_, position_ + offset_, SEEK_SET);
-        LOGERROR("Error while writing to file " + GetName());
-        return 0;
-    }
-
-    readSyncNeeded_ = true;
-    position_ += size;
-    if (position_ > size_)
-        size_ = position_;
-
-    return size;
-}
-
-unsigned File::GetChecksum()
-{
-    if (offset_ || checksum_)
-        return checksum_;
-    #ifdef ANDROID
-    if ((!handle_ && !assetHandle_) || mode_ == FILE_WRITE)
-    #else
-    if (!handle_ || mode_ == FILE_WRITE)
-    #endif
-        return 0;
-
-    PROFILE(CalculateFileChecksum);
-
-    unsigned oldPos = position_;
-    checksum_ = 0;
-
-    Seek(0);
-    while (!IsEof())
-    {
-        unsigned char block[1024];
-        unsigned readBytes = Read(block, 1024);
-        for (unsigned i = 0; i < readBytes; ++i)
-            checksum_ = SDBMHash(checksum_, block[i]);
-    }
-
-    Seek(oldPos);
-    return checksum_;
-}
-
-void File::Close()
-{
-    #ifdef ANDROID
-    if (assetHandle_)
-    {
-        SDL_RWclose(assetHandle_);
-        assetHandle_ = 0;
-    }
-    #endif
-
-    readBuffer_.Reset();
-    inputBuffer_.Reset();
-
-    if (handle_)
-    {
-        fclose((FILE*)handle_);
-        handle_ = 0;
-        position_ = 0;
-        size_ = 0;
-        offset_ = 0;
-        checksum_ = 0;
-    }
-}
-
-void File::Flush()
-{
-    if (handle_)
-        fflush((FILE*)handle_);
-}
-
-void File::SetName(const String& name)
-{
-    fileName_ = name;
-}
-
-bool File::IsOpen() const
-{
-    #ifdef ANDROID
-        return handle_ != 0 || assetHandle_ != 0;
-    #else
-        return handle_ != 0;
-    #endif
-}
-
-}
+//
+// Copyright (c) 2008-2014 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "Precompiled.h"
+#include "File.h"
+#include "FileSystem.h"
+#include "Log.h"
+#include "MemoryBuffer.h"
+#include "PackageFile.h"
+#include "Profiler.h"
+#include "Thread.h"
+#include "WorkQueue.h"
+
+#include <cstdio>
+#include <lz4.h>
+
+#include "DebugNew.h"
+
+namespace Urho3D
+{
+
+#ifdef WIN32
+static const wchar_t* openMode[] =
+{
+    L"rb",
+    L"wb",
+    L"r+b",
+    L"w+b"
+};
+#else
+static const char* openMode[] =
+{
+    "rb",
+    "wb",
+    "r+b",
+    "w+b"
+};
+#endif
+
+static const unsigned READ_BUFFER_SIZE = 32768;
+static const unsigned SKIP_BUFFER_SIZE = 1024;
+/// Minimum number of compressed blocks in one read to decompress them in parallel.
+static const unsigned MIN_PARALLEL_BLOCKS = 4;
+
+/// Return uncompressed size of a block of a compressed file within a package. Only the last block may be smaller than the block size.
+static unsigned GetBlockDataSize(unsigned block, unsigned blockSize, unsigned fileSize)
+{
+    unsigned remaining = fileSize - block * blockSize;
+    return remaining < blockSize ? remaining : blockSize;
+}
+
+/// Decompress one block of a compressed file within a package. Return true if successful.
+static bool DecompressBlock(const unsigned char* src, unsigned packedSize, unsigned char* dest, unsigned unpackedSize)
+{
+    // Blocks that did not compress are stored as is
+    if (packedSize == unpackedSize)
+    {
+        memcpy(dest, src, unpackedSize);
+        return true;
+    }
+    else
+        return LZ4_decompress_safe((const char*)src, (char*)dest, packedSize, unpackedSize) == (int)unpackedSize;
+}
+
+/// Work for decompressing blocks of a compressed file within a package in parallel.
+struct DecompressBlocksWork
+{
+    /// Decompress a range of blocks.
+    void operator () (unsigned* start, unsigned* end, unsigned threadIndex) const
+    {
+        for (unsigned* i = start; i != end; ++i)
+        {
+            unsigned block = *i;
+            unsigned packedStart = blockOffsets_[block];
+            if (!DecompressBlock(input_ + packedStart - inputStart_, blockOffsets_[block + 1] - packedStart,
+                dest_ + (block - firstBlock_) * blockSize_, GetBlockDataSize(block, blockSize_, size_)))
+                *failed_ = true;
+        }
+    }
+    
+    /// Compressed data of the first block.
+    const unsigned char* input_;
+    /// Offset of the first block's compressed data within the file.
+    unsigned inputStart_;
+    /// Block offsets.
+    const unsigned* blockOffsets_;
+    /// Uncompressed block size.
+    unsigned blockSize_;
+    /// Uncompressed file size.
+    unsigned size_;
+    /// First block to decompress.
+    unsigned firstBlock_;
+    /// Destination of the first block.
+    unsigned char* dest_;
+    /// Failure flag.
+    bool* failed_;
+};
+
+File::File(Context* context) :
+    Object(context),
+    mode_(FILE_READ),
+    handle_(0),
+    #ifdef ANDROID
+    assetHandle_(0),
+    #endif
+    readBufferOffset_(0),
+    readBufferSize_(0),
+    offset_(0),
+    mappedData_(0),
+    mapping_(0),
+    blockSize_(0),
+    blockIndex_(M_MAX_UNSIGNED),
+    checksum_(0),
+    compressed_(false),
+    readSyncNeeded_(false),
+    writeSyncNeeded_(false)
+{
+}
+
+File::File(Context* context, const String& fileName, FileMode mode) :
+    Object(context),
+    mode_(FILE_READ),
+    handle_(0),
+    #ifdef ANDROID
+    assetHandle_(0),
+    #endif
+    readBufferOffset_(0),
+    readBufferSize_(0),
+    offset_(0),
+    mappedData_(0),
+    mapping_(0),
+    blockSize_(0),
+    blockIndex_(M_MAX_UNSIGNED),
+    checksum_(0),
+    compressed_(false),
+    readSyncNeeded_(false),
+    writeSyncNeeded_(false)
+{
+    Open(fileName, mode);
+}
+
+File::File(Context* context, PackageFile* package, const String& fileName) :
+    Object(context),
+    mode_(FILE_READ),
+    handle_(0),
+    #ifdef ANDROID
+    assetHandle_(0),
+    #endif
+    readBufferOffset_(0),
+    readBufferSize_(0),
+    offset_(0),
+    mappedData_(0),
+    mapping_(0),
+    blockSize_(0),
+    blockIndex_(M_MAX_UNSIGNED),
+    checksum_(0),
+    compressed_(false),
+    readSyncNeeded_(false),
+    writeSyncNeeded_(false)
+{
+    Open(package, fileName);
+}
+
+File::~File()
+{
+    Close();
+}
+
+bool File::Open(const String& fileName, FileMode mode)
+{
+    Close();
+
+    FileSystem* fileSystem = GetSubsystem<FileSystem>();
+    if (fileSystem && !fileSystem->CheckAccess(GetPath(fileName)))
+    {
+        LOGERROR("Access denied to " + fileName);
+        return false;
+    }
+
+    #ifdef ANDROID
+    if (fileName.StartsWith("/apk/"))
+    {
+        if (mode != FILE_READ)
+        {
+            LOGERROR("Only read mode is supported for asset files");
+            return false;
+        }
+
+        assetHandle_ = SDL_RWFromFile(fileName.Substring(5).CString(), "rb");
+        if (!assetHandle_)
+        {
+            LOGERROR("Could not open asset file " + fileName);
+            return false;
+        }
+        else
+        {
+            fileName_ = fileName;
+            mode_ = mode;
+            position_ = 0;
+            offset_ = 0;
+            checksum_ = 0;
+            size_ = assetHandle_->hidden.androidio.size;
+            readBuffer_ = new unsigned char[READ_BUFFER_SIZE];
+            readBufferOffset_ = 0;
+            readBufferSize_ = 0;
+            return true;
+        }
+    }
+    #endif
+
+    if (fileName.Empty())
+    {
+        LOGERROR("Could not open file with empty name");
+        return false;
+    }
+    
+    #ifdef WIN32
+    handle_ = _wfopen(GetWideNativePath(fileName).CString(), openMode[mode]);
+    #else
+    handle_ = fopen(GetNativePath(fileName).CString(), openMode[mode]);
+    #endif
+
+    // If file did not exist in readwrite mode, retry with write-update mode
+    if (mode == FILE_READWRITE && !handle_)
+    {
+        #ifdef WIN32
+        handle_ = _wfopen(GetWideNativePath(fileName).CString(), openMode[mode + 1]);
+        #else
+        handle_ = fopen(GetNativePath(fileName).CString(), openMode[mode + 1]);
+        #endif
+    }
+    
+    if (!handle_)
+    {
+        LOGERROR("Could not open file " + fileName);
+        return false;
+    }
+
+    fileName_ = fileName;
+    mode_ = mode;
+    position_ = 0;
+    offset_ = 0;
+    checksum_ = 0;
+    compressed_ = false;
+    readSyncNeeded_ = false;
+    writeSyncNeeded_ = false;
+
+    fseek((FILE*)handle_, 0, SEEK_END);
+    size_ = ftell((FILE*)handle_);
+    fseek((FILE*)handle_, 0, SEEK_SET);
+    return true;
+}
+
+bool File::Open(PackageFile* package, const String& fileName)
+{
+    Close();
+
+    if (!package)
+        return false;
+
+    const PackageEntry* entry = package->GetEntry(fileName);
+    if (!entry)
+        return false;
+
+    bool compressed = package->IsCompressed() && entry->compression_ != PACKAGE_STORE;
+
+    // Read directly from memory if the package is mapped. Compressed files are decompressed from the mapped memory
+    if (package->IsMemoryMapped())
+    {
+        fileName_ = fileName;
+        mode_ = FILE_READ;
+        offset_ = entry->offset_;
+        mapping_ = package->GetMapping();
+        mapping_->AddRef();
+        mappedData_ = mapping_->GetData() + entry->offset_;
+        checksum_ = entry->checksum_;
+        position_ = 0;
+        size_ = entry->size_;
+        compressed_ = compressed;
+        blockSize_ = compressed ? package->GetBlockSize() : 0;
+        readSyncNeeded_ = false;
+        writeSyncNeeded_ = false;
+        if (blockSize_ && !ReadBlockIndex())
+        {
+            Close();
+            return false;
+        }
+        return true;
+    }
+
+    #ifdef WIN32
+    handle_ = _wfopen(GetWideNativePath(package->GetName()).CString(), L"rb");
+    #else
+    handle_ = fopen(GetNativePath(package->GetName()).CString(), "rb");
+    #endif
+    if (!handle_)
+    {
+        LOGERROR("Could not open package file " + fileName);
+        return false;
+    }
+
+    fileName_ = fileName;
+    mode_ = FILE_READ;
+    offset_ = entry->offset_;
+    checksum_ = entry->checksum_;
+    position_ = 0;
+    size_ = entry->size_;
+    compressed_ = compressed;
+    blockSize_ = compressed ? package->GetBlockSize() : 0;
+    readSyncNeeded_ = false;
+    writeSyncNeeded_ = false;
+    
+    if (blockSize_ && !ReadBlockIndex())
+    {
+        Close();
+        return false;
+    }
+    
+    fseek((FILE*)handle_, offset_, SEEK_SET);
+    return true;
+}
+
+unsigned File::Read(void* dest, unsigned size)
+{
+    if (!IsOpen())
+    {
+        // Do not log the error further here to prevent spamming the stderr stream
+        return 0;
+    }
+
+    if (mode_ == FILE_WRITE)
+    {
+        LOGERROR("File not opened for reading");
+        return 0;
+    }
+
+    if (size + position_ > size_)
+        size = size_ - position_;
+    if (!size)
+        return 0;
+
+    if (mappedData_ && !compressed_)
+    {
+        memcpy(dest, mappedData_ + position_, size);
+        position_ += size;
+        return size;
+    }
+    
+    if (blockSize_)
+    {
+        unsigned sizeLeft = size;
+        unsigned char* destPtr = (unsigned char*)dest;
+        
+        while (sizeLeft)
+        {
+            unsigned block = position_ / blockSize_;
+            unsigned blockStart = block * blockSize_;
+            unsigned offsetInBlock = position_ - blockStart;
+            unsigned copySize;
+            
+            // Decompress whole blocks straight to the destination. Otherwise go through the read buffer
+            if (!offsetInBlock && block != blockIndex_ && sizeLeft >= blockSize_)
+            {
+                unsigned numBlocks = sizeLeft / blockSize_;
+                if (!DecompressBlocks(block, numBlocks, destPtr))
+                    break;
+                copySize = numBlocks * blockSize_;
+            }
+            else
+            {
+                if (block != blockIndex_)
+                {
+                    if (!DecompressBlocks(block, 1, readBuffer_.Get()))
+                        break;
+                    blockIndex_ = block;
+                }
+                copySize = Min((int)(GetBlockDataSize(block, blockSize_, size_) - offsetInBlock), (int)sizeLeft);
+                memcpy(destPtr, readBuffer_.Get() + offsetInBlock, copySize);
+            }
+            
+            destPtr += copySize;
+            sizeLeft -= copySize;
+            position_ += copySize;
+        }
+        
+        if (sizeLeft)
+            LOGERROR("Error while decompressing file " + GetName());
+        return size - sizeLeft;
+    }
+
+    #ifdef ANDROID
+    if (assetHandle_)
+    {
+        unsigned sizeLeft = size;
+        unsigned char* destPtr = (unsigned char*)dest;
+
+        while (sizeLeft)
+        {
+            if (readBufferOffset_ >= readBufferSize_)
+            {
+                readBufferSize_ = Min((int)size_ - position_, (int)READ_BUFFER_SIZE);
+                readBufferOffset_ = 0;
+                SDL_RWread(assetHandle_, readBuffer_.Get(), readBufferSize_, 1);
+            }
+
+            unsigned copySize = Min((int)(readBufferSize_ - readBufferOffset_), (int)sizeLeft);
+            memcpy(destPtr, readBuffer_.Get() + readBufferOffset_, copySize);
+            destPtr += copySize;
+            sizeLeft -= copySize;
+            readBufferOffset_ += copySize;
+            position_ += copySize;
+        }
+
+        return size;
+    }
+    #endif
+    if (compressed_)
+    {
+        unsigned sizeLeft = size;
+        unsigned char* destPtr = (unsigned char*)dest;
+
+        while (sizeLeft)
+        {
+            if (!readBuffer_ || readBufferOffset_ >= readBufferSize_)
+            {
+                unsigned char blockHeaderBytes[4];
+                fread(blockHeaderBytes, sizeof blockHeaderBytes, 1, (FILE*)handle_);
+
+                MemoryBuffer blockHeader(&blockHeaderBytes[0], sizeof blockHeaderBytes);
+                unsigned unpackedSize = blockHeader.ReadUShort();
+                unsigned packedSize = blockHeader.ReadUShort();
+
+                if (!readBuffer_)
+                {
+                    readBuffer_ = new unsigned char[unpackedSize];
+                    inputBuffer_ = new unsigned char[LZ4_compressBound(unpackedSize)];
+                }
+
+                /// \todo Handle errors
+                fread(inputBuffer_.Get(), packedSize, 1, (FILE*)handle_);
+                LZ4_decompress_fast((const char*)inputBuffer_.Get(), (char *)readBuffer_.Get(), unpackedSize);
+
+                readBufferSize_ = unpackedSize;
+                readBufferOffset_ = 0;
+            }
+
+            unsigned copySize = Min((int)(readBufferSize_ - readBufferOffset_), (int)sizeLeft);
+            memcpy(destPtr, readBuffer_.Get() + readBufferOffset_, copySize);
+            destPtr += copySize;
+            sizeLeft -= copySize;
+            readBufferOffset_ += copySize;
+            position_ += copySize;
+        }
+
+        return size;
+    }
+
+    // Need to reassign the position due to internal buffering when transitioning from writing to reading
+    if (readSyncNeeded_)
+    {
+        fseek((FILE*)handle_, position_ + offset_, SEEK_SET);
+        readSyncNeeded_ = false;
+    }
+    
+    size_t ret = fread(dest, size, 1, (FILE*)handle_);
+    if (ret != 1)
+    {
+        // Return to the position where the read began
+        fseek((FILE*)handle_, position_ + offset_, SEEK_SET);
+        LOGERROR("Error while reading from file " + GetName());
+        return 0;
+    }
+
+    writeSyncNeeded_ = true;
+    position_ += size;
+    return size;
+}
+
+unsigned File::Seek(unsigned position)
+{
+    if (!IsOpen())
+    {
+        // Do not log the error further here to prevent spamming the stderr stream
+        return 0;
+    }
+
+    // Allow sparse seeks if writing
+    if (mode_ == FILE_READ && position > size_)
+        position = size_;
+
+    // Files with a block index can seek anywhere, the right block is decompressed on the next read
+    if ((mappedData_ && !compressed_) || blockSize_)
+    {
+        position_ = position;
+        return position_;
+    }
+
+    #ifdef ANDROID
+    if (assetHandle_)
+    {
+        SDL_RWseek(assetHandle_, position, SEEK_SET);
+        position_ = position;
+        readBufferOffset_ = 0;
+        readBufferSize_ = 0;
+        return position_;
+    }
+    #endif
+    if (compressed_)
+    {
+        // Start over from the beginning
+        if (position == 0)
+        {
+            position_ = 0;
+            readBufferOffset_ = 0;
+            readBufferSize_ = 0;
+            fseek((FILE*)handle_, offset_, SEEK_SET);
+        }
+        // Skip bytes
+        else if (position >= position_)
+        {
+            unsigned char skipBuffer[SKIP_BUFFER_SIZE];
+            while (position > position_)
+                Read(skipBuffer, Min((int)position - position_, (int)SKIP_BUFFER_SIZE));
+        }
+        else
+            LOGERROR("Seeking backward in a compressed file is not supported");
+
+        return position_;
+    }
+
+    fseek((FILE*)handle_, position + offset_, SEEK_SET);
+    position_ = position;
+    readSyncNeeded_ = false;
+    writeSyncNeeded_ = false;
+    return position_;
+}
+
+unsigned File::Write(const void* data, unsigned size)
+{
+    if (!handle_)
+    {
+        // Do not log the error further here to prevent spamming the stderr stream
+        return 0;
+    }
+
+    if (mode_ == FILE_READ)
+    {
+        LOGERROR("File not opened for writing");
+        return 0;
+    }
+
+    if (!size)
+        return 0;
+
+    // Need to reassign the position due to internal buffering when transitioning from reading to writing
+    if (writeSyncNeeded_)
+    {
+        fseek((FILE*)handle_, position_ + offset_, SEEK_SET);
+        writeSyncNeeded_ = false;
+    }
+    
+    if (fwrite(data, size, 1, (FILE*)handle_) != 1)
+    {
+        // Return to the position where the write began
+        fseek((FILE*)handle_, position_ + offset_, SEEK_SET);
+        LOGERROR("Error while writing to file " + GetName());
+        return 0;
+    }
+
+    readSyncNeeded_ = true;
+    position_ += size;
+    if (position_ > size_)
+        size_ = position_;
+
+    return size;
+}
+
+unsigned File::GetChecksum()
+{
+    if (offset_ || checksum_)
+        return checksum_;
+    #ifdef ANDROID
+    if ((!handle_ && !assetHandle_) || mode_ == FILE_WRITE)
+    #else
+    if (!handle_ || mode_ == FILE_WRITE)
+    #endif
+        return 0;
+
+    PROFILE(CalculateFileChecksum);
+
+    unsigned oldPos = position_;
+    checksum_ = 0;
+
+    Seek(0);
+    while (!IsEof())
+    {
+        unsigned char block[1024];
+        unsigned readBytes = Read(block, 1024);
+        for (unsigned i = 0; i < readBytes; ++i)
+            checksum_ = SDBMHash(checksum_, block[i]);
+    }
+
+    Seek(oldPos);
+    return checksum_;
+}
+
+void File::Close()
+{
+    #ifdef ANDROID
+    if (assetHandle_)
+    {
+        SDL_RWclose(assetHandle_);
+        assetHandle_ = 0;
+    }
+    #endif
+
+    readBuffer_.Reset();
+    inputBuffer_.Reset();
+    blockOffsets_.Clear();
+    blockSize_ = 0;
+    blockIndex_ = M_MAX_UNSIGNED;
+
+    if (mappedData_)
+    {
+        mappedData_ = 0;
+        mapping_->ReleaseRef();
+        mapping_ = 0;
+        position_ = 0;
+        size_ = 0;
+        offset_ = 0;
+        checksum_ = 0;
+    }
+
+    if (handle_)
+    {
+        fclose((FILE*)handle_);
+        handle_ = 0;
+        position_ = 0;
+        size_ = 0;
+        offset_ = 0;
+        checksum_ = 0;
+    }
+}
+
+void File::Flush()
+{
+    if (handle_)
+        fflush((FILE*)handle_);
+}
+
+void File::SetName(const String& name)
+{
+    fileName_ = name;
+}
+
+bool File::ReadBlockIndex()
+{
+    // The index has an offset for the start of each block, and one for the end of the last block
+    unsigned numBlocks = (size_ + blockSize_ - 1) / blockSize_;
+    unsigned indexSize = (numBlocks + 1) * sizeof(unsigned);
+    blockOffsets_.Resize(numBlocks + 1);
+    
+    if (mappedData_)
+    {
+        if (offset_ + indexSize > mapping_->GetSize())
+        {
+            LOGERROR("Block index of file " + fileName_ + " outside package file");
+            return false;
+        }
+        memcpy(&blockOffsets_[0], mappedData_, indexSize);
+    }
+    else
+    {
+        fseek((FILE*)handle_, offset_, SEEK_SET);
+        if (fread(&blockOffsets_[0], indexSize, 1, (FILE*)handle_) != 1)
+        {
+            LOGERROR("Could not read block index of file " + fileName_);
+            return false;
+        }
+    }
+    
+    // Check that the blocks are in order and each fits in the read buffer, so they can be trusted when reading
+    if (blockOffsets_[0] != indexSize)
+    {
+        LOGERROR("Corrupt block index in file " + fileName_);
+        return false;
+    }
+    for (unsigned i = 0; i < numBlocks; ++i)
+    {
+        if (blockOffsets_[i + 1] < blockOffsets_[i] || blockOffsets_[i + 1] - blockOffsets_[i] > GetBlockDataSize(i, blockSize_,
+            size_))
+        {
+            LOGERROR("Corrupt block index in file " + fileName_);
+            return false;
+        }
+    }
+    if (mappedData_ && offset_ + blockOffsets_[numBlocks] > mapping_->GetSize())
+    {
+        LOGERROR("File entry " + fileName_ + " outside package file");
+        return false;
+    }
+    
+    readBuffer_ = new unsigned char[blockSize_];
+    if (!mappedData_)
+        inputBuffer_ = new unsigned char[blockSize_];
+    blockIndex_ = M_MAX_UNSIGNED;
+    return true;
+}
+
+bool File::DecompressBlocks(unsigned firstBlock, unsigned numBlocks, unsigned char* dest)
+{
+    unsigned packedStart = blockOffsets_[firstBlock];
+    unsigned packedSize = blockOffsets_[firstBlock + numBlocks] - packedStart;
+    
+    // Get the compressed data of all the blocks at once, either from mapped memory or with one read
+    const unsigned char* input;
+    SharedArrayPtr<unsigned char> largeInputBuffer;
+    if (mappedData_)
+        input = mappedData_ + packedStart;
+    else
+    {
+        if (packedSize > blockSize_)
+            largeInputBuffer = new unsigned char[packedSize];
+        unsigned char* inputBuffer = largeInputBuffer ? largeInputBuffer.Get() : inputBuffer_.Get();
+        fseek((FILE*)handle_, offset_ + packedStart, SEEK_SET);
+        if (packedSize && fread(inputBuffer, packedSize, 1, (FILE*)handle_) != 1)
+            return false;
+        input = inputBuffer;
+    }
+    
+    bool failed = false;
+    DecompressBlocksWork work;
+    work.input_ = input;
+    work.inputStart_ = packedStart;
+    work.blockOffsets_ = &blockOffsets_[0];
+    work.blockSize_ = blockSize_;
+    work.size_ = size_;
+    work.firstBlock_ = firstBlock;
+    work.dest_ = dest;
+    work.failed_ = &failed;
+    
+    // Work items can only be added from the main thread. Resources being loaded in the background are already spread
+    // over the background loader threads
+    WorkQueue* queue = numBlocks >= MIN_PARALLEL_BLOCKS && Thread::IsMainThread() ? GetSubsystem<WorkQueue>() : 0;
+    if (queue && queue->GetNumThreads())
+    {
+        PODVector<unsigned> blocks(numBlocks);
+        for (unsigned i = 0; i < numBlocks; ++i)
+            blocks[i] = firstBlock + i;
+        queue->ParallelFor(blocks, 1, work);
+    }
+    else
+    {
+        for (unsigned i = 0; i < numBlocks; ++i)
+        {
+            unsigned block = firstBlock + i;
+            work(&block, &block + 1, 0);
+        }
+    }
+    
+    return !failed;
+}
+
+bool File::IsOpen() const
+{
+    #ifdef ANDROID
+        return handle_ != 0 || assetHandle_ != 0 || mappedData_ != 0;
+    #else
+        return handle_ != 0 || mappedData_ != 0;
+    #endif
+}
+
+}
@@ -1,270 +1,817 @@
-//
-// Copyright (c) 2008-2014 the Urho3D project.
-//
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-//
-// The above copyright notice and this permission notice shall be included in
-// all copies or substantial portions of the Software.
-//
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
-// THE SOFTWARE.
-//
-
-#include "Precompiled.h"
-#include "Context.h"
-#include "CoreEvents.h"
-#include "File.h"
-#include "IOEvents.h"
-#include "Log.h"
-#include "Mutex.h"
-#include "ProcessUtils.h"
-#include "Thread.h"
-#include "Timer.h"
-
-#include <cstdio>
-
-#ifdef ANDROID
-#include <android/log.h>
-#endif
-#ifdef IOS
-extern "C" void SDL_IOS_LogMessage(const char* message);
-#endif
-
-#include "DebugNew.h"
-
-namespace Urho3D
-{
-
-const char* logLevelPrefixes[] =
-{
-    "DEBUG",
-    "INFO",
-    "WARNING",
-    "ERROR",
-    0
-};
-
-static Log* logInstance = 0;
-
-Log::Log(Context* context) :
-    Object(context),
-#ifdef _DEBUG
-    level_(LOG_DEBUG),
-#else
-    level_(LOG_INFO),
-#endif
-    timeStamp_(true),
-    inWrite_(false),
-    quiet_(false)
-{
-    logInstance = this;
-    
-    SubscribeToEvent(E_ENDFRAME, HANDLER(Log, HandleEndFrame));
-}
-
-Log::~Log()
-{
-    logInstance = 0;
-}
-
-void Log::Open(const String& fileName)
-{
-    #if !defined(ANDROID) && !defined(IOS)
-    if (fileName.Empty())
-        return;
-    if (logFile_ && logFile_->IsOpen())
-    {
-        if (logFile_->GetName() == fileName)
-            return;
-        else
-            Close();
-    }
-
-    logFile_ = new File(context_);
-    if (logFile_->Open(fileName, FILE_WRITE))
-        Write(LOG_INFO, "Opened log file " + fileName);
-    else
-    {
-        logFile_.Reset();
-        Write(LOG_ERROR, "Failed to create log file " + fileName);
-    }
-    #endif
-}
-
-void Log::Close()
-{
-    #if !defined(ANDROID) && !defined(IOS)
-    if (logFile_ && logFile_->IsOpen())
-    {
-        logFile_->Close();
-        logFile_.Reset();
-    }
-    #endif
-}
-
-void Log::SetLevel(int level)
-{
-    assert(level >= LOG_DEBUG && level < LOG_NONE);
-
-    level_ = level;
-}
-
-void Log::SetTimeStamp(bool enable)
-{
-    timeStamp_ = enable;
-}
-
-void Log::SetQuiet(bool quiet)
-{
-    quiet_ = quiet;
-}
-
-void Log::Write(int level, const String& message)
-{
-    assert(level >= LOG_DEBUG && level < LOG_NONE);
-
-    // If not in the main thread, store message for later processing
-    if (!Thread::IsMainThread())
-    {
-        if (logInstance)
-        {
-            MutexLock lock(logInstance->logMutex_);
-            logInstance->threadMessages_.Push(StoredLogMessage(message, level, false));
-        }
-        
-        return;
-    }
-
-    // Do not log if message level excluded or if currently sending a log event
-    if (!logInstance || logInstance->level_ > level || logInstance->inWrite_)
-        return;
-
-    String formattedMessage = logLevelPrefixes[level];
-    formattedMessage += ": " + message;
-    logInstance->lastMessage_ = message;
-
-    if (logInstance->timeStamp_)
-        formattedMessage = "[" + Time::GetTimeStamp() + "] " + formattedMessage;
-
-    #if defined(ANDROID)
-    int androidLevel = ANDROID_LOG_DEBUG + level;
-    __android_log_print(androidLevel, "Urho3D", "%s", message.CString());
-    #elif defined(IOS)
-    SDL_IOS_LogMessage(message.CString());
-    #else
-    if (logInstance->quiet_)
-    {
-        // If in quiet mode, still print the error message to the standard error stream
-        if (level == LOG_ERROR)
-            PrintUnicodeLine(formattedMessage, true);
-    }
-    else
-        PrintUnicodeLine(formattedMessage, level == LOG_ERROR);
-    #endif
-
-    if (logInstance->logFile_)
-    {
-        logInstance->logFile_->WriteLine(formattedMessage);
-        logInstance->logFile_->Flush();
-    }
-
-    logInstance->inWrite_ = true;
-
-    using namespace LogMessage;
-
-    VariantMap& eventData = logInstance->GetEventDataMap();
-    eventData[P_MESSAGE] = formattedMessage;
-    eventData[P_LEVEL] = level;
-    logInstance->SendEvent(E_LOGMESSAGE, eventData);
-
-    logInstance->inWrite_ = false;
-}
-
-void Log::WriteRaw(const String& message, bool error)
-{
-    // If not in the main thread, store message for later processing
-    if (!Thread::IsMainThread())
-    {
-        if (logInstance)
-        {
-            MutexLock lock(logInstance->logMutex_);
-            logInstance->threadMessages_.Push(StoredLogMessage(message, LOG_RAW, error));
-        }
-        
-        return;
-    }
-    
-    // Prevent recursion during log event
-    if (!logInstance || logInstance->inWrite_)
-        return;
-
-    logInstance->lastMessage_ = message;
-
-    #if defined(ANDROID)
-    if (logInstance->quiet_)
-    {
-        if (error)
-            __android_log_print(ANDROID_LOG_ERROR, "Urho3D", message.CString());
-    }
-    else
-        __android_log_print(error ? ANDROID_LOG_ERROR : ANDROID_LOG_INFO, "Urho3D", message.CString());
-    #elif defined(IOS)
-    SDL_IOS_LogMessage(message.CString());
-    #else
-    if (logInstance->quiet_)
-    {
-        // If in quiet mode, still print the error message to the standard error stream
-        if (error)
-            PrintUnicode(message, true);
-    }
-    else
-        PrintUnicode(message, error);
-    #endif
-
-    if (logInstance->logFile_)
-    {
-        logInstance->logFile_->Write(message.CString(), message.Length());
-        logInstance->logFile_->Flush();
-    }
-
-    logInstance->inWrite_ = true;
-
-    using namespace LogMessage;
-
-    VariantMap& eventData = logInstance->GetEventDataMap();
-    eventData[P_MESSAGE] = message;
-    eventData[P_LEVEL] = error ? LOG_ERROR : LOG_INFO;
-    logInstance->SendEvent(E_LOGMESSAGE, eventData);
-
-    logInstance->inWrite_ = false;
-}
-
-void Log::HandleEndFrame(StringHash eventType, VariantMap& eventData)
-{
-    MutexLock lock(logMutex_);
-    
-    // Process messages accumulated from other threads (if any)
-    while (!threadMessages_.Empty())
-    {
-        const StoredLogMessage& stored = threadMessages_.Front();
-        
-        if (stored.level_ != LOG_RAW)
-            Write(stored.level_, stored.message_);
-        else
-            WriteRaw(stored.message_, stored.error_);
-        
-        threadMessages_.PopFront();
-    }
-}
-
-}
+//
+// Copyright (c) 2008-2014 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "Precompiled.h"
+#include "Atomic.h"
+#include "Context.h"
+#include "CoreEvents.h"
+#include "File.h"
+#include "IOEvents.h"
+#include "Log.h"
+#include "Mutex.h"
+#include "ProcessUtils.h"
+#include "Thread.h"
+#include "Timer.h"
+
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+
+#ifdef ANDROID
+#include <android/log.h>
+#endif
+#ifdef IOS
+extern "C" void SDL_IOS_LogMessage(const char* message);
+#endif
+
+#include "DebugNew.h"
+
+namespace Urho3D
+{
+
+const char* logLevelPrefixes[] =
+{
+    "DEBUG",
+    "INFO",
+    "WARNING",
+    "ERROR",
+    0
+};
+
+static Log* logInstance = 0;
+
+/// Size of the message ring buffer. Must be a power of two.
+static const unsigned LOG_BUFFER_SIZE = 256 * 1024;
+/// Maximum message length stored in the ring buffer. Longer messages are truncated.
+static const unsigned MAX_LOG_MESSAGE_LENGTH = LOG_BUFFER_SIZE / 4;
+/// Maximum number of arguments stored for a message with deferred formatting. Messages with more are formatted by the caller.
+static const unsigned MAX_LOG_FORMAT_ARGS = 16;
+
+static const unsigned RECORD_RAW = 1;
+static const unsigned RECORD_ERROR = 2;
+static const unsigned RECORD_TIMESTAMP = 4;
+static const unsigned RECORD_PADDING = 8;
+static const unsigned RECORD_FORMAT = 16;
+static const unsigned RECORD_MAINTHREAD = 32;
+
+/// Message header in the ring buffer. The message text follows.
+struct LogRecord
+{
+    /// Nonzero when the writing thread has finished copying the record.
+    volatile int committed_;
+    /// Size of the record including the header and alignment, in bytes.
+    unsigned size_;
+    /// Message level.
+    int level_;
+    /// Record flags.
+    unsigned flags_;
+    /// Time of writing in seconds.
+    unsigned time_;
+    /// Length of the message text.
+    unsigned length_;
+};
+
+/// Size of the record header, rounded up to keep the records 8-byte aligned.
+static const unsigned LOG_RECORD_HEADER_SIZE = (sizeof(LogRecord) + 7) & ~7;
+
+/// Format argument captured from the variable argument list.
+union LogFormatArg
+{
+    /// Signed integer or character.
+    int int_;
+    /// Unsigned integer.
+    unsigned uint_;
+    /// Floating point value.
+    double double_;
+    /// C string.
+    const char* string_;
+    /// Pointer.
+    void* ptr_;
+};
+
+static unsigned AlignRecordSize(unsigned size)
+{
+    return (size + 7) & ~7;
+}
+
+/// Return the format specifier characters of a format string in order, in the same way as String::AppendWithFormatArgs() parses them. Return the total count, which may exceed the destination size.
+static unsigned GetFormatSpecifiers(const char* format, char* dest, unsigned maxCount)
+{
+    unsigned count = 0;
+    for (const char* pos = format; *pos; ++pos)
+    {
+        if (*pos != '%')
+            continue;
+        char arg = *++pos;
+        if (!arg)
+            break;
+        if (arg == 'd' || arg == 'i' || arg == 'u' || arg == 'f' || arg == 'c' || arg == 's' || arg == 'x' || arg == 'p')
+        {
+            if (count < maxCount)
+                dest[count] = arg;
+            ++count;
+        }
+    }
+    return count;
+}
+
+/// Store a format string and its arguments into a record.
+static void StoreFormatArgs(unsigned char* dest, const char* format, unsigned formatLength, const char* specifiers,
+    const LogFormatArg* values, unsigned numArgs)
+{
+    memcpy(dest, format, formatLength + 1);
+    dest += AlignRecordSize(formatLength + 1);
+    
+    for (unsigned i = 0; i < numArgs; ++i)
+    {
+        if (specifiers[i] == 's')
+        {
+            // Store strings as a length followed by the characters
+            LogFormatArg length;
+            length.uint_ = strlen(values[i].string_);
+            memcpy(dest, &length, sizeof length);
+            dest += sizeof length;
+            memcpy(dest, values[i].string_, length.uint_);
+            dest += AlignRecordSize(length.uint_);
+        }
+        else
+        {
+            memcpy(dest, &values[i], sizeof(LogFormatArg));
+            dest += sizeof(LogFormatArg);
+        }
+    }
+}
+
+/// Format a message from a format string and the arguments stored after it in a record.
+static void FormatDeferredMessage(String& dest, const char* format, const unsigned char* args)
+{
+    dest.Clear();
+    
+    const char* lastPos = format;
+    const char* pos = format;
+    for (;;)
+    {
+        while (*pos && *pos != '%')
+            ++pos;
+        dest.Append(lastPos, (unsigned)(pos - lastPos));
+        if (!*pos)
+            return;
+        
+        char arg = pos[1];
+        if (!arg)
+            return;
+        pos += 2;
+        lastPos = pos;
+        
+        LogFormatArg value;
+        char buffer[CONVERSION_BUFFER_LENGTH];
+        switch (arg)
+        {
+        case 'd':
+        case 'i':
+            memcpy(&value, args, sizeof value);
+            args += sizeof value;
+            dest.Append(String(value.int_));
+            break;
+            
+        case 'u':
+            memcpy(&value, args, sizeof value);
+            args += sizeof value;
+            dest.Append(String(value.uint_));
+            break;
+            
+        case 'f':
+            memcpy(&value, args, sizeof value);
+            args += sizeof value;
+            dest.Append(String(value.double_));
+            break;
+            
+        case 'c':
+            memcpy(&value, args, sizeof value);
+            args += sizeof value;
+            dest.Append((char)value.int_);
+            break;
+            
+        case 's':
+            memcpy(&value, args, sizeof value);
+            args += sizeof value;
+            dest.Append(reinterpret_cast<const char*>(args), value.uint_);
+            args += AlignRecordSize(value.uint_);
+            break;
+            
+        case 'x':
+            memcpy(&value, args, sizeof value);
+            args += sizeof value;
+            dest.Append(buffer, sprintf(buffer, "%x", value.int_));
+            break;
+            
+        case 'p':
+            memcpy(&value, args, sizeof value);
+            args += sizeof value;
+            dest.Append(buffer, sprintf(buffer, "%p", value.ptr_));
+            break;
+            
+        case '%':
+            dest.Append('%');
+            break;
+        }
+    }
+}
+
+static void AppendTimeStamp(String& dest, unsigned time)
+{
+    static const char* dayNames[] = { "Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat" };
+    static const char* monthNames[] = { "Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov",
+        "Dec" };
+    
+    // Same format as Time::GetTimeStamp(), but using the reentrant conversion, as this runs outside the main thread
+    time_t sysTime = (time_t)time;
+    struct tm local;
+    #ifdef _WIN32
+    localtime_s(&local, &sysTime);
+    #else
+    localtime_r(&sysTime, &local);
+    #endif
+    
+    char buffer[64];
+    int length = sprintf(buffer, "%s %s %2d %02d:%02d:%02d %d", dayNames[local.tm_wday], monthNames[local.tm_mon], local.tm_mday,
+        local.tm_hour, local.tm_min, local.tm_sec, local.tm_year + 1900);
+    dest.Append(buffer, length);
+}
+
+static void FormatMessage(String& dest, int level, bool timeStamp, unsigned time, const char* message, unsigned length)
+{
+    dest.Clear();
+    if (timeStamp)
+    {
+        dest += '[';
+        AppendTimeStamp(dest, time);
+        dest += "] ";
+    }
+    dest += logLevelPrefixes[level];
+    dest += ": ";
+    dest.Append(message, length);
+}
+
+/// Log output thread.
+class LogThread : public Thread, public RefCounted
+{
+public:
+    /// Construct.
+    LogThread(Log* owner) :
+        owner_(owner)
+    {
+    }
+    
+    /// Write out queued messages until stopped.
+    virtual void ThreadFunction()
+    {
+        while (shouldRun_)
+        {
+            if (!owner_->ProcessQueue())
+                owner_->WaitForMessages();
+        }
+    }
+    
+    /// Wake up and stop the thread.
+    void Shutdown()
+    {
+        shouldRun_ = false;
+        owner_->outputCondition_.Set();
+        Stop();
+    }
+    
+private:
+    /// Log subsystem.
+    Log* owner_;
+};
+
+Log::Log(Context* context) :
+    Object(context),
+    buffer_(new unsigned char[LOG_BUFFER_SIZE]),
+    writePos_(0),
+    readPos_(0),
+    outputWaiting_(0),
+#ifdef _DEBUG
+    level_(LOG_DEBUG),
+#else
+    level_(LOG_INFO),
+#endif
+    timeStamp_(true),
+    inWrite_(false),
+    hasMessageReceivers_(false),
+    quiet_(false)
+{
+    memset(buffer_.Get(), 0, LOG_BUFFER_SIZE);
+    logInstance = this;
+    
+    thread_ = new LogThread(this);
+    thread_->Run();
+    
+    SubscribeToEvent(E_BEGINFRAME, HANDLER(Log, HandleBeginFrame));
+}
+
+Log::~Log()
+{
+    // Stop the output thread, then write out whatever remains
+    thread_->Shutdown();
+    logInstance = 0;
+    ProcessQueue();
+    thread_.Reset();
+}
+
+void Log::Open(const String& fileName)
+{
+    #if !defined(ANDROID) && !defined(IOS)
+    if (fileName.Empty())
+        return;
+    if (logFile_ && logFile_->IsOpen())
+    {
+        if (logFile_->GetName() == fileName)
+            return;
+        else
+            Close();
+    }
+
+    SharedPtr<File> newFile(new File(context_));
+    if (newFile->Open(fileName, FILE_WRITE))
+    {
+        {
+            MutexLock lock(logMutex_);
+            logFile_ = newFile;
+        }
+        Write(LOG_INFO, "Opened log file " + fileName);
+    }
+    else
+        Write(LOG_ERROR, "Failed to create log file " + fileName);
+    #endif
+}
+
+void Log::Close()
+{
+    #if !defined(ANDROID) && !defined(IOS)
+    if (logFile_ && logFile_->IsOpen())
+    {
+        // Write queued messages to the file before closing it
+        Flush();
+        
+        MutexLock lock(logMutex_);
+        logFile_->Close();
+        logFile_.Reset();
+    }
+    #endif
+}
+
+void Log::SetLevel(int level)
+{
+    assert(level >= LOG_DEBUG && level < LOG_NONE);
+
+    level_ = level;
+}
+
+void Log::SetTimeStamp(bool enable)
+{
+    timeStamp_ = enable;
+}
+
+void Log::SetQuiet(bool quiet)
+{
+    quiet_ = quiet;
+}
+
+String Log::GetLastMessage() const
+{
+    // The output thread sets the last message, so make sure it has caught up
+    const_cast<Log*>(this)->Flush();
+    
+    MutexLock lock(logMutex_);
+    return lastMessage_;
+}
+
+void Log::Flush()
+{
+    // Write out the queue in the calling thread. The log mutex serializes this with the output thread
+    while (readPos_ != writePos_)
+    {
+        // A record may still be being copied by another thread
+        if (!ProcessQueue())
+            Time::Sleep(0);
+    }
+}
+
+void Log::Write(int level, const String& message)
+{
+    assert(level >= LOG_DEBUG && level < LOG_NONE);
+
+    // Do not log if message level excluded
+    if (!logInstance || logInstance->level_ > level)
+        return;
+    
+    logInstance->WriteInternal(level, false, message);
+}
+
+void Log::WriteFormat(int level, const char* format, ...)
+{
+    assert(level >= LOG_DEBUG && level < LOG_NONE);
+    
+    if (!logInstance || logInstance->level_ > level)
+        return;
+    
+    va_list args;
+    va_start(args, format);
+    logInstance->WriteFormatInternal(level, format, args);
+    va_end(args);
+}
+
+void Log::WriteRaw(const String& message, bool error)
+{
+    if (!logInstance)
+        return;
+    
+    logInstance->WriteInternal(LOG_RAW, error, message);
+}
+
+void Log::WriteLimited(int level, const String& message, LogRateLimit& limit)
+{
+    int suppressed = AtomicAdd(&limit.suppressed_, 0);
+    if (suppressed)
+    {
+        AtomicAdd(&limit.suppressed_, -suppressed);
+        Write(level, message + " (" + String(suppressed) + " similar messages suppressed)");
+    }
+    else
+        Write(level, message);
+}
+
+bool Log::IsEnabled(int level)
+{
+    return logInstance && logInstance->level_ <= level;
+}
+
+bool Log::CheckRateLimit(LogRateLimit& limit, unsigned intervalMs)
+{
+    // Zero means no message written yet
+    unsigned now = Time::GetSystemTime();
+    if (!now)
+        now = 1;
+    
+    int last = limit.lastTime_;
+    if ((!last || now - (unsigned)last >= intervalMs) && AtomicCompareExchange(&limit.lastTime_, last, (int)now))
+        return true;
+    
+    AtomicIncrement(&limit.suppressed_);
+    return false;
+}
+
+void Log::WriteInternal(int level, bool error, const String& message)
+{
+    bool mainThread = Thread::IsMainThread();
+    
+    // Do not log if currently sending a log event
+    if (mainThread && inWrite_)
+        return;
+    
+    unsigned now = (unsigned)time(0);
+    Enqueue(level, error, now, message);
+    
+    using namespace LogMessage;
+    
+    if (mainThread)
+    {
+        // Format the message for the event only if someone is listening
+        if (!HasMessageReceivers())
+            return;
+        
+        inWrite_ = true;
+        
+        VariantMap& eventData = GetEventDataMap();
+        if (level != LOG_RAW)
+        {
+            String formattedMessage;
+            FormatMessage(formattedMessage, level, timeStamp_, now, message.CString(), message.Length());
+            eventData[P_MESSAGE] = formattedMessage;
+            eventData[P_LEVEL] = level;
+        }
+        else
+        {
+            eventData[P_MESSAGE] = message;
+            eventData[P_LEVEL] = error ? LOG_ERROR : LOG_INFO;
+        }
+        SendEvent(E_LOGMESSAGE, eventData);
+        
+        inWrite_ = false;
+    }
+    else
+    {
+        // The event receivers can not be inspected outside the main thread, so rely on the main thread's last check
+        if (!hasMessageReceivers_)
+            return;
+        
+        VariantMap eventData;
+        if (level != LOG_RAW)
+        {
+            String formattedMessage;
+            FormatMessage(formattedMessage, level, timeStamp_, now, message.CString(), message.Length());
+            eventData[P_MESSAGE] = formattedMessage;
+            eventData[P_LEVEL] = level;
+        }
+        else
+        {
+            eventData[P_MESSAGE] = message;
+            eventData[P_LEVEL] = error ? LOG_ERROR : LOG_INFO;
+        }
+        PostEvent(E_LOGMESSAGE, eventData);
+    }
+}
+
+void Log::WriteFormatInternal(int level, const char* format, va_list args)
+{
+    bool mainThread = Thread::IsMainThread();
+    
+    // Do not log if currently sending a log event
+    if (mainThread && inWrite_)
+        return;
+    
+    // The log message event needs the formatted text right away. So do messages with too many arguments
+    char specifiers[MAX_LOG_FORMAT_ARGS];
+    unsigned numArgs = GetFormatSpecifiers(format, specifiers, MAX_LOG_FORMAT_ARGS);
+    if ((mainThread ? HasMessageReceivers() : hasMessageReceivers_) || numArgs > MAX_LOG_FORMAT_ARGS)
+    {
+        String message;
+        message.AppendWithFormatArgs(format, args);
+        WriteInternal(level, false, message);
+        return;
+    }
+    
+    // Copy the arguments and measure the record: the format string is followed by 8 bytes per argument, plus the characters of strings
+    LogFormatArg values[MAX_LOG_FORMAT_ARGS];
+    unsigned formatLength = strlen(format);
+    unsigned size = LOG_RECORD_HEADER_SIZE + AlignRecordSize(formatLength + 1);
+    for (unsigned i = 0; i < numArgs; ++i)
+    {
+        switch (specifiers[i])
+        {
+        case 'u':
+            values[i].uint_ = va_arg(args, unsigned);
+            break;
+            
+        case 'f':
+            values[i].double_ = va_arg(args, double);
+            break;
+            
+        case 's':
+            values[i].string_ = va_arg(args, const char*);
+            if (!values[i].string_)
+                values[i].string_ = "";
+            size += AlignRecordSize(strlen(values[i].string_));
+            break;
+            
+        case 'p':
+            values[i].ptr_ = va_arg(args, void*);
+            break;
+            
+        default:
+            values[i].int_ = va_arg(args, int);
+            break;
+        }
+        size += sizeof(LogFormatArg);
+    }
+    
+    if (size - LOG_RECORD_HEADER_SIZE > MAX_LOG_MESSAGE_LENGTH)
+    {
+        // Too long for the ring buffer. The argument list has been consumed, so format from the copied arguments
+        SharedArrayPtr<unsigned char> args(new unsigned char[size - LOG_RECORD_HEADER_SIZE]);
+        StoreFormatArgs(args.Get(), format, formatLength, specifiers, values, numArgs);
+        String message;
+        FormatDeferredMessage(message, reinterpret_cast<const char*>(args.Get()), args.Get() +
+            AlignRecordSize(formatLength + 1));
+        WriteInternal(level, false, message);
+        return;
+    }
+    
+    unsigned char* dest = Reserve(size);
+    LogRecord* record = reinterpret_cast<LogRecord*>(dest);
+    record->size_ = size;
+    record->level_ = level;
+    record->flags_ = RECORD_FORMAT | (timeStamp_ ? RECORD_TIMESTAMP : 0) | (mainThread ? RECORD_MAINTHREAD : 0);
+    record->time_ = (unsigned)time(0);
+    record->length_ = formatLength;
+    StoreFormatArgs(dest + LOG_RECORD_HEADER_SIZE, format, formatLength, specifiers, values, numArgs);
+    
+    Commit(dest);
+}
+
+void Log::Enqueue(int level, bool error, unsigned time, const String& message)
+{
+    unsigned length = message.Length() < MAX_LOG_MESSAGE_LENGTH ? message.Length() : MAX_LOG_MESSAGE_LENGTH;
+    unsigned size = AlignRecordSize(LOG_RECORD_HEADER_SIZE + length);
+    
+    unsigned char* dest = Reserve(size);
+    LogRecord* record = reinterpret_cast<LogRecord*>(dest);
+    record->size_ = size;
+    record->level_ = level;
+    record->flags_ = (level == LOG_RAW ? RECORD_RAW : 0) | (error ? RECORD_ERROR : 0) | (timeStamp_ ? RECORD_TIMESTAMP : 0) |
+        (Thread::IsMainThread() ? RECORD_MAINTHREAD : 0);
+    record->time_ = time;
+    record->length_ = length;
+    memcpy(dest + LOG_RECORD_HEADER_SIZE, message.CString(), length);
+    
+    Commit(dest);
+}
+
+unsigned char* Log::Reserve(unsigned size)
+{
+    unsigned char* buffer = buffer_.Get();
+    
+    for (;;)
+    {
+        unsigned head = (unsigned)writePos_;
+        unsigned tail = (unsigned)readPos_;
+        unsigned offset = head & (LOG_BUFFER_SIZE - 1);
+        unsigned contiguous = LOG_BUFFER_SIZE - offset;
+        // Records do not wrap around: skip the end of the buffer if the record does not fit there
+        unsigned needed = size <= contiguous ? size : contiguous + size;
+        
+        if (head - tail + needed > LOG_BUFFER_SIZE)
+        {
+            // Buffer full, help the output thread to catch up
+            if (!ProcessQueue())
+                Time::Sleep(0);
+            continue;
+        }
+        
+        if (!AtomicCompareExchange(&writePos_, (int)head, (int)(head + needed)))
+            continue;
+        
+        if (needed != size)
+        {
+            // If there is room for a header, mark the skipped space as padding. Otherwise the reader skips it implicitly
+            if (contiguous >= LOG_RECORD_HEADER_SIZE)
+            {
+                LogRecord* padding = reinterpret_cast<LogRecord*>(buffer + offset);
+                padding->size_ = contiguous;
+                padding->flags_ = RECORD_PADDING;
+                AtomicStoreRelease(&padding->committed_, 1);
+            }
+            offset = 0;
+        }
+        
+        return buffer + offset;
+    }
+}
+
+void Log::Commit(unsigned char* record)
+{
+    // Publish the record. The reserved space was zeroed by the output thread, so nothing else writes the flag. Then make
+    // sure the waiting flag is read only after the record is visible
+    AtomicStoreRelease(&reinterpret_cast<LogRecord*>(record)->committed_, 1);
+    AtomicMemoryBarrier();
+    if (outputWaiting_ && AtomicCompareExchange(&outputWaiting_, 1, 0))
+        outputCondition_.Set();
+}
+
+void Log::WaitForMessages()
+{
+    // Announce the wait before checking the queue once more. A writer committing in between either sees the flag and
+    // sets the condition, or its record is written out here
+    AtomicCompareExchange(&outputWaiting_, 0, 1);
+    if (!ProcessQueue())
+        outputCondition_.Wait();
+    outputWaiting_ = 0;
+}
+
+unsigned Log::ProcessQueue()
+{
+    MutexLock lock(logMutex_);
+    
+    unsigned char* buffer = buffer_.Get();
+    unsigned count = 0;
+    
+    for (;;)
+    {
+        unsigned tail = (unsigned)readPos_;
+        if (tail == (unsigned)writePos_)
+            break;
+        
+        unsigned offset = tail & (LOG_BUFFER_SIZE - 1);
+        unsigned contiguous = LOG_BUFFER_SIZE - offset;
+        if (contiguous < LOG_RECORD_HEADER_SIZE)
+        {
+            memset(buffer + offset, 0, contiguous);
+            AtomicAdd(&readPos_, (int)contiguous);
+            continue;
+        }
+        
+        // Stop at a record that is still being written
+        LogRecord* record = reinterpret_cast<LogRecord*>(buffer + offset);
+        if (!AtomicAdd(&record->committed_, 0))
+            break;
+        
+        if (!(record->flags_ & RECORD_PADDING))
+        {
+            const char* message = reinterpret_cast<const char*>(buffer + offset + LOG_RECORD_HEADER_SIZE);
+            unsigned length = record->length_;
+            bool raw = (record->flags_ & RECORD_RAW) != 0;
+            bool error = raw ? (record->flags_ & RECORD_ERROR) != 0 : record->level_ == LOG_ERROR;
+            
+            if (record->flags_ & RECORD_FORMAT)
+            {
+                FormatDeferredMessage(outputMessage_, message, reinterpret_cast<const unsigned char*>(message) +
+                    AlignRecordSize(length + 1));
+                message = outputMessage_.CString();
+                length = outputMessage_.Length();
+            }
+            if (record->flags_ & RECORD_MAINTHREAD)
+            {
+                lastMessage_.Clear();
+                lastMessage_.Append(message, length);
+            }
+            
+            if (raw)
+                outputLine_.Clear();
+            else
+                FormatMessage(outputLine_, record->level_, (record->flags_ & RECORD_TIMESTAMP) != 0, record->time_, message,
+                    length);
+            
+            #if defined(ANDROID)
+            String text(message, length);
+            if (raw)
+            {
+                if (!quiet_ || error)
+                    __android_log_print(error ? ANDROID_LOG_ERROR : ANDROID_LOG_INFO, "Urho3D", "%s", text.CString());
+            }
+            else
+                __android_log_print(ANDROID_LOG_DEBUG + record->level_, "Urho3D", "%s", text.CString());
+            #elif defined(IOS)
+            String text(message, length);
+            SDL_IOS_LogMessage(text.CString());
+            #else
+            // If in quiet mode, still print the error message to the standard error stream
+            if (!quiet_ || error)
+            {
+                if (raw)
+                    PrintUnicode(String(message, length), error);
+                else
+                    PrintUnicodeLine(outputLine_, error);
+            }
+            #endif
+            
+            if (logFile_)
+            {
+                if (raw)
+                    logFile_->Write(message, length);
+                else
+                    logFile_->WriteLine(outputLine_);
+            }
+            
+            ++count;
+        }
+        
+        // Release the space for writing. Zero all of it, as a later record or padding header may start anywhere within it
+        // and must not be seen as committed before its writer commits it
+        unsigned size = record->size_;
+        memset(record, 0, size);
+        AtomicAdd(&readPos_, (int)size);
+    }
+    
+    if (count && logFile_)
+        logFile_->Flush();
+    
+    return count;
+}
+
+bool Log::HasMessageReceivers()
+{
+    EventReceiverGroup* group = context_->GetEventReceivers(this, E_LOGMESSAGE);
+    if (!group || group->Empty())
+        group = context_->GetEventReceivers(E_LOGMESSAGE);
+    
+    hasMessageReceivers_ = group && !group->Empty();
+    return hasMessageReceivers_;
+}
+
+void Log::HandleBeginFrame(StringHash eventType, VariantMap& eventData)
+{
+    HasMessageReceivers();
+}
+
+}
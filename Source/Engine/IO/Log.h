@@ -1,153 +1,212 @@
-//
-// Copyright (c) 2008-2014 the Urho3D project.
-//
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-//
-// The above copyright notice and this permission notice shall be included in
-// all copies or substantial portions of the Software.
-//
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
-// THE SOFTWARE.
-//
-
-#pragma once
-
-#include "List.h"
-#include "Mutex.h"
-#include "Object.h"
-#include "StringUtils.h"
-
-namespace Urho3D
-{
-
-/// Fictional message level to indicate a stored raw message.
-static const int LOG_RAW = -1;
-/// Debug message level. By default only shown in debug mode.
-static const int LOG_DEBUG = 0;
-/// Informative message level.
-static const int LOG_INFO = 1;
-/// Warning message level.
-static const int LOG_WARNING = 2;
-/// Error message level.
-static const int LOG_ERROR = 3;
-/// Disable all log messages.
-static const int LOG_NONE = 4;
-
-class File;
-
-/// Stored log message from another thread.
-struct StoredLogMessage
-{
-    /// Construct undefined.
-    StoredLogMessage()
-    {
-    }
-    
-    /// Construct with parameters.
-    StoredLogMessage(const String& message, int level, bool error) :
-        message_(message),
-        level_(level),
-        error_(error)
-    {
-    }
-    
-    /// Message text.
-    String message_;
-    /// Message level. -1 for raw messages.
-    int level_;
-    /// Error flag for raw messages.
-    bool error_;
-};
-
-/// Logging subsystem.
-class URHO3D_API Log : public Object
-{
-    OBJECT(Log);
-
-public:
-    /// Construct.
-    Log(Context* context);
-    /// Destruct. Close the log file if open.
-    virtual ~Log();
-
-    /// Open the log file.
-    void Open(const String& fileName);
-    /// Close the log file.
-    void Close();
-    /// Set logging level.
-    void SetLevel(int level);
-    /// Set whether to timestamp log messages.
-    void SetTimeStamp(bool enable);
-    /// Set quiet mode ie. only print error entries to standard error stream (which is normally redirected to console also). Output to log file is not affected by this mode.
-    void SetQuiet(bool quiet);
-
-    /// Return logging level.
-    int GetLevel() const { return level_; }
-    /// Return whether log messages are timestamped.
-    bool GetTimeStamp() const { return timeStamp_; }
-    /// Return last log message.
-    String GetLastMessage() const { return lastMessage_; }
-    /// Return whether log is in quiet mode (only errors printed to standard error stream).
-    bool IsQuiet() const { return quiet_; }
-
-    /// Write to the log. If logging level is higher than the level of the message, the message is ignored.
-    static void Write(int level, const String& message);
-    /// Write raw output to the log.
-    static void WriteRaw(const String& message, bool error = false);
-
-private:
-    /// Handle end of frame. Process the threaded log messages.
-    void HandleEndFrame(StringHash eventType, VariantMap& eventData);
-    
-    /// Mutex for threaded operation.
-    Mutex logMutex_;
-    /// Log messages from other threads.
-    List<StoredLogMessage> threadMessages_;
-    /// Log file.
-    SharedPtr<File> logFile_;
-    /// Last log message.
-    String lastMessage_;
-    /// Logging level.
-    int level_;
-    /// Timestamp log messages flag.
-    bool timeStamp_;
-    /// In write flag to prevent recursion.
-    bool inWrite_;
-    /// Quiet mode flag.
-    bool quiet_;
-};
-
-#ifdef URHO3D_LOGGING
-#define LOGDEBUG(message) Urho3D::Log::Write(Urho3D::LOG_DEBUG, message)
-#define LOGINFO(message) Urho3D::Log::Write(Urho3D::LOG_INFO, message)
-#define LOGWARNING(message) Urho3D::Log::Write(Urho3D::LOG_WARNING, message)
-#define LOGERROR(message) Urho3D::Log::Write(Urho3D::LOG_ERROR, message)
-#define LOGRAW(message) Urho3D::Log::WriteRaw(message)
-#define LOGDEBUGF(format, ...) Urho3D::Log::Write(Urho3D::LOG_DEBUG, ToString(format, ##__VA_ARGS__))
-#define LOGINFOF(format, ...) Urho3D::Log::Write(Urho3D::LOG_INFO, ToString(format, ##__VA_ARGS__))
-#define LOGWARNINGF(format, ...) Urho3D::Log::Write(Urho3D::LOG_WARNING, ToString(format, ##__VA_ARGS__))
-#define LOGERRORF(format, ...) Urho3D::Log::Write(Urho3D::LOG_ERROR, ToString(format, ##__VA_ARGS__))
-#define LOGRAWF(format, ...) Urho3D::Log::WriteRaw(ToString(format, ##__VA_ARGS__))
-#else
-#define LOGDEBUG(message)
-#define LOGINFO(message)
-#define LOGWARNING(message)
-#define LOGERROR(message)
-#define LOGRAW(message)
-#define LOGDEBUGF(...)
-#define LOGINFOF(...)
-#define LOGWARNINGF(...)
-#define LOGERRORF(...)
-#define LOGRAWF(...)
-#endif
-}
+//
+// Copyright (c) 2008-2014 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#pragma once
+
+#include "ArrayPtr.h"
+#include "Condition.h"
+#include "List.h"
+#include "Mutex.h"
+#include "Object.h"
+#include "StringUtils.h"
+
+#include <cstdarg>
+
+/// Lowest message level compiled in. Logging macros below it expand to nothing.
+#ifndef URHO3D_LOG_MIN_LEVEL
+#define URHO3D_LOG_MIN_LEVEL 0
+#endif
+
+namespace Urho3D
+{
+
+/// Fictional message level to indicate a stored raw message.
+static const int LOG_RAW = -1;
+/// Debug message level. By default only shown in debug mode.
+static const int LOG_DEBUG = 0;
+/// Informative message level.
+static const int LOG_INFO = 1;
+/// Warning message level.
+static const int LOG_WARNING = 2;
+/// Error message level.
+static const int LOG_ERROR = 3;
+/// Disable all log messages.
+static const int LOG_NONE = 4;
+
+class File;
+class LogThread;
+
+/// Per call site state for rate limited log messages. Zero-initialize as a static variable.
+struct LogRateLimit
+{
+    /// System time in milliseconds of the last written message. Zero if none yet.
+    volatile int lastTime_;
+    /// Number of messages suppressed since the last written one.
+    volatile int suppressed_;
+};
+
+/// Logging subsystem.
+class URHO3D_API Log : public Object
+{
+    OBJECT(Log);
+
+public:
+    /// Construct.
+    Log(Context* context);
+    /// Destruct. Close the log file if open.
+    virtual ~Log();
+
+    /// Open the log file.
+    void Open(const String& fileName);
+    /// Close the log file.
+    void Close();
+    /// Set logging level.
+    void SetLevel(int level);
+    /// Set whether to timestamp log messages.
+    void SetTimeStamp(bool enable);
+    /// Set quiet mode ie. only print error entries to standard error stream (which is normally redirected to console also). Output to log file is not affected by this mode.
+    void SetQuiet(bool quiet);
+
+    /// Return logging level.
+    int GetLevel() const { return level_; }
+    /// Return whether log messages are timestamped.
+    bool GetTimeStamp() const { return timeStamp_; }
+    /// Return last log message written from the main thread. Waits until the output thread has written it.
+    String GetLastMessage() const;
+    /// Return whether log is in quiet mode (only errors printed to standard error stream).
+    bool IsQuiet() const { return quiet_; }
+
+    /// Wait until the output thread has written all queued messages.
+    void Flush();
+
+    /// Write to the log. If logging level is higher than the level of the message, the message is ignored. Can be called from any thread. Output happens in the background; the log message event is sent immediately in the main thread, and posted to the main thread from other threads.
+    static void Write(int level, const String& message);
+    /// Write a message given as a format string and arguments, with the same format specifiers as ToString(). If nobody is subscribed to the log message event, the arguments are copied as they are and formatted by the output thread.
+    static void WriteFormat(int level, const char* format, ...);
+    /// Write raw output to the log.
+    static void WriteRaw(const String& message, bool error = false);
+    /// Write a message unless another message from the same call site was written less than the interval ago. Report the number of suppressed messages with the next written one.
+    static void WriteLimited(int level, const String& message, LogRateLimit& limit);
+    /// Return whether a message of the level would be written. Used by the logging macros to skip formatting.
+    static bool IsEnabled(int level);
+    /// Return whether a rate limited message should be written now, and count it as suppressed if not.
+    static bool CheckRateLimit(LogRateLimit& limit, unsigned intervalMs);
+
+private:
+    friend class LogThread;
+    
+    /// Queue a message for output and send the log message event.
+    void WriteInternal(int level, bool error, const String& message);
+    /// Queue a formatted message for output, deferring the formatting if there is no log message event to send.
+    void WriteFormatInternal(int level, const char* format, va_list args);
+    /// Copy a message into the ring buffer. Wait for the output thread if the buffer is full.
+    void Enqueue(int level, bool error, unsigned time, const String& message);
+    /// Reserve space for a record in the ring buffer and return a pointer to it. Wait for the output thread if the buffer is full.
+    unsigned char* Reserve(unsigned size);
+    /// Publish a record written to reserved space and wake up the output thread if it is waiting.
+    void Commit(unsigned char* record);
+    /// Write out queued messages. Return number of messages written.
+    unsigned ProcessQueue();
+    /// Wait until messages have been queued. Called by the output thread.
+    void WaitForMessages();
+    /// Return whether anyone is subscribed to the log message event, and remember it for the other threads.
+    bool HasMessageReceivers();
+    /// Handle frame begin event. Check the log message event receivers for the messages written outside the main thread.
+    void HandleBeginFrame(StringHash eventType, VariantMap& eventData);
+    
+    /// Mutex for the log file, the last message and the output side of the ring buffer.
+    mutable Mutex logMutex_;
+    /// Message ring buffer. Space not reserved by a writing thread is kept zeroed.
+    SharedArrayPtr<unsigned char> buffer_;
+    /// Ring buffer write position. Reserved with compare-exchange by the writing threads.
+    volatile int writePos_;
+    /// Ring buffer read position. Advanced by the output thread.
+    volatile int readPos_;
+    /// Output thread.
+    SharedPtr<LogThread> thread_;
+    /// Condition for waking up the output thread.
+    Condition outputCondition_;
+    /// Nonzero when the output thread is about to wait or waiting for messages.
+    volatile int outputWaiting_;
+    /// Line formatting buffer for the output.
+    String outputLine_;
+    /// Formatting buffer for the messages with deferred formatting.
+    String outputMessage_;
+    /// Log file.
+    SharedPtr<File> logFile_;
+    /// Last log message.
+    String lastMessage_;
+    /// Logging level.
+    int level_;
+    /// Timestamp log messages flag.
+    bool timeStamp_;
+    /// In write flag to prevent recursion.
+    bool inWrite_;
+    /// Log message event receivers exist flag, as last checked in the main thread.
+    volatile bool hasMessageReceivers_;
+    /// Quiet mode flag.
+    bool quiet_;
+};
+
+#ifdef URHO3D_LOGGING
+#define LOGRAW(message) Urho3D::Log::WriteRaw(message)
+#define LOGRAWF(format, ...) Urho3D::Log::WriteRaw(ToString(format, ##__VA_ARGS__))
+#define LOGLIMITED(level, intervalMs, message) do { static Urho3D::LogRateLimit rateLimit_ = { 0, 0 }; if (Urho3D::Log::IsEnabled(level) && Urho3D::Log::CheckRateLimit(rateLimit_, intervalMs)) Urho3D::Log::WriteLimited(level, message, rateLimit_); } while (0)
+#else
+#define LOGRAW(message)
+#define LOGRAWF(...)
+#define LOGLIMITED(level, intervalMs, message)
+#endif
+
+#if defined(URHO3D_LOGGING) && URHO3D_LOG_MIN_LEVEL <= 0
+#define LOGDEBUG(message) (Urho3D::Log::IsEnabled(Urho3D::LOG_DEBUG) ? Urho3D::Log::Write(Urho3D::LOG_DEBUG, message) : (void)0)
+#define LOGDEBUGF(format, ...) (Urho3D::Log::IsEnabled(Urho3D::LOG_DEBUG) ? Urho3D::Log::WriteFormat(Urho3D::LOG_DEBUG, format, ##__VA_ARGS__) : (void)0)
+#else
+#define LOGDEBUG(message)
+#define LOGDEBUGF(...)
+#endif
+
+#if defined(URHO3D_LOGGING) && URHO3D_LOG_MIN_LEVEL <= 1
+#define LOGINFO(message) (Urho3D::Log::IsEnabled(Urho3D::LOG_INFO) ? Urho3D::Log::Write(Urho3D::LOG_INFO, message) : (void)0)
+#define LOGINFOF(format, ...) (Urho3D::Log::IsEnabled(Urho3D::LOG_INFO) ? Urho3D::Log::WriteFormat(Urho3D::LOG_INFO, format, ##__VA_ARGS__) : (void)0)
+#else
+#define LOGINFO(message)
+#define LOGINFOF(...)
+#endif
+
+#if defined(URHO3D_LOGGING) && URHO3D_LOG_MIN_LEVEL <= 2
+#define LOGWARNING(message) (Urho3D::Log::IsEnabled(Urho3D::LOG_WARNING) ? Urho3D::Log::Write(Urho3D::LOG_WARNING, message) : (void)0)
+#define LOGWARNINGF(format, ...) (Urho3D::Log::IsEnabled(Urho3D::LOG_WARNING) ? Urho3D::Log::WriteFormat(Urho3D::LOG_WARNING, format, ##__VA_ARGS__) : (void)0)
+#else
+#define LOGWARNING(message)
+#define LOGWARNINGF(...)
+#endif
+
+#if defined(URHO3D_LOGGING) && URHO3D_LOG_MIN_LEVEL <= 3
+#define LOGERROR(message) (Urho3D::Log::IsEnabled(Urho3D::LOG_ERROR) ? Urho3D::Log::Write(Urho3D::LOG_ERROR, message) : (void)0)
+#define LOGERRORF(format, ...) (Urho3D::Log::IsEnabled(Urho3D::LOG_ERROR) ? Urho3D::Log::WriteFormat(Urho3D::LOG_ERROR, format, ##__VA_ARGS__) : (void)0)
+#else
+#define LOGERROR(message)
+#define LOGERRORF(...)
+#endif
+
+}
@@ -1,131 +1,253 @@
-//
-// Copyright (c) 2008-2014 the Urho3D project.
-//
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-//
-// The above copyright notice and this permission notice shall be included in
-// all copies or substantial portions of the Software.
-//
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
-// THE SOFTWARE.
-//
-
-#include "Precompiled.h"
-#include "File.h"
-#include "Log.h"
-#include "PackageFile.h"
-
-namespace Urho3D
-{
-
-PackageFile::PackageFile(Context* context) :
-    Object(context),
-    totalSize_(0),
-    checksum_(0),
-    compressed_(false)
-{
-}
-
-PackageFile::PackageFile(Context* context, const String& fileName, unsigned startOffset) :
-    Object(context),
-    totalSize_(0),
-    checksum_(0),
-    compressed_(false)
-{
-    Open(fileName, startOffset);
-}
-
-PackageFile::~PackageFile()
-{
-}
-
-bool PackageFile::Open(const String& fileName, unsigned startOffset)
-{
-    #ifdef ANDROID
-    if (fileName.StartsWith("/apk/"))
-    {
-        LOGERROR("Package files within the apk are not supported on Android");
-        return false;
-    }
-    #endif
-    
-    SharedPtr<File> file(new File(context_, fileName));
-    if (!file->IsOpen())
-        return false;
-    
-    // Check ID, then read the directory
-    file->Seek(startOffset);
-    String id = file->ReadFileID();
-    if (id != "UPAK" && id != "ULZ4")
-    {
-        // If start offset has not been explicitly specified, also try to read package size from the end of file
-        // to know how much we must rewind to find the package start
-        if (!startOffset)
-        {
-            unsigned fileSize = file->GetSize();
-            file->Seek(fileSize - sizeof(unsigned));
-            unsigned newStartOffset = fileSize - file->ReadUInt();
-            if (newStartOffset < fileSize)
-            {
-                startOffset = newStartOffset;
-                file->Seek(startOffset);
-                id = file->ReadFileID();
-            }
-        }
-        
-        if (id != "UPAK" && id != "ULZ4")
-        {
-            LOGERROR(fileName + " is not a valid package file");
-            return false;
-        }
-    }
-    
-    fileName_ = fileName;
-    nameHash_ = fileName_;
-    totalSize_ = file->GetSize();
-    compressed_ = id == "ULZ4";
-    
-    unsigned numFiles = file->ReadUInt();
-    checksum_ = file->ReadUInt();
-    
-    for (unsigned i = 0; i < numFiles; ++i)
-    {
-        String entryName = file->ReadString();
-        PackageEntry newEntry;
-        newEntry.offset_ = file->ReadUInt() + startOffset;
-        newEntry.size_ = file->ReadUInt();
-        newEntry.checksum_ = file->ReadUInt();
-        if (!compressed_ && newEntry.offset_ + newEntry.size_ > totalSize_)
-            LOGERROR("File entry " + entryName + " outside package file");
-        else
-            entries_[entryName.ToLower()] = newEntry;
-    }
-    
-    return true;
-}
-
-bool PackageFile::Exists(const String& fileName) const
-{
-    return entries_.Find(fileName.ToLower()) != entries_.End();
-}
-
-const PackageEntry* PackageFile::GetEntry(const String& fileName) const
-{
-    HashMap<String, PackageEntry>::ConstIterator i = entries_.Find(fileName.ToLower());
-    if (i != entries_.End())
-        return &i->second_;
-    else
-        return 0;
-}
-
-}
+//
+// Copyright (c) 2008-2014 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "Precompiled.h"
+#include "File.h"
+#include "FileSystem.h"
+#include "Log.h"
+#include "PackageFile.h"
+
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace Urho3D
+{
+
+PackageFile::PackageFile(Context* context) :
+    Object(context),
+    totalSize_(0),
+    checksum_(0),
+    blockSize_(0),
+    mapping_(0),
+    compressed_(false)
+{
+}
+
+PackageFile::PackageFile(Context* context, const String& fileName, unsigned startOffset) :
+    Object(context),
+    totalSize_(0),
+    checksum_(0),
+    blockSize_(0),
+    mapping_(0),
+    compressed_(false)
+{
+    Open(fileName, startOffset);
+}
+
+PackageFile::~PackageFile()
+{
+    // Files still open from the mapping keep it alive until they are closed
+    if (mapping_)
+    {
+        mapping_->ReleaseRef();
+        mapping_ = 0;
+    }
+}
+
+bool PackageFile::Open(const String& fileName, unsigned startOffset)
+{
+    #ifdef ANDROID
+    if (fileName.StartsWith("/apk/"))
+    {
+        LOGERROR("Package files within the apk are not supported on Android");
+        return false;
+    }
+    #endif
+    
+    SharedPtr<File> file(new File(context_, fileName));
+    if (!file->IsOpen())
+        return false;
+    
+    // Check ID, then read the directory
+    file->Seek(startOffset);
+    String id = file->ReadFileID();
+    if (id != "UPAK" && id != "ULZ4" && id != "ULZB")
+    {
+        // If start offset has not been explicitly specified, also try to read package size from the end of file
+        // to know how much we must rewind to find the package start
+        if (!startOffset)
+        {
+            unsigned fileSize = file->GetSize();
+            file->Seek(fileSize - sizeof(unsigned));
+            unsigned newStartOffset = fileSize - file->ReadUInt();
+            if (newStartOffset < fileSize)
+            {
+                startOffset = newStartOffset;
+                file->Seek(startOffset);
+                id = file->ReadFileID();
+            }
+        }
+        
+        if (id != "UPAK" && id != "ULZ4" && id != "ULZB")
+        {
+            LOGERROR(fileName + " is not a valid package file");
+            return false;
+        }
+    }
+    
+    if (!SetMemoryMapped(false))
+        return false;
+    
+    fileName_ = fileName;
+    nameHash_ = fileName_;
+    totalSize_ = file->GetSize();
+    compressed_ = id != "UPAK";
+    
+    unsigned numFiles = file->ReadUInt();
+    checksum_ = file->ReadUInt();
+    // The block indexed format has a per-file compression mode. In the legacy compressed format all files are compressed
+    // as one stream of blocks
+    blockSize_ = id == "ULZB" ? file->ReadUInt() : 0;
+    if (id == "ULZB" && !blockSize_)
+    {
+        LOGERROR(fileName + " has zero compressed block size");
+        return false;
+    }
+    
+    for (unsigned i = 0; i < numFiles; ++i)
+    {
+        String entryName = file->ReadString();
+        PackageEntry newEntry;
+        newEntry.offset_ = file->ReadUInt() + startOffset;
+        newEntry.size_ = file->ReadUInt();
+        newEntry.checksum_ = file->ReadUInt();
+        if (blockSize_)
+        {
+            unsigned char compression = file->ReadUByte();
+            if (compression > PACKAGE_LZ4HC)
+            {
+                LOGERROR("Unknown compression mode " + String((unsigned)compression) + " for file entry " + entryName +
+                    " in " + fileName);
+                return false;
+            }
+            newEntry.compression_ = (PackageCompression)compression;
+        }
+        else
+            newEntry.compression_ = compressed_ ? PACKAGE_LZ4HC : PACKAGE_STORE;
+        if (newEntry.compression_ == PACKAGE_STORE && newEntry.offset_ + newEntry.size_ > totalSize_)
+            LOGERROR("File entry " + entryName + " outside package file");
+        else
+            entries_[entryName.ToLower()] = newEntry;
+    }
+    
+    return true;
+}
+
+PackageMapping::~PackageMapping()
+{
+    #ifdef WIN32
+    UnmapViewOfFile(data_);
+    #else
+    munmap((void*)data_, size_);
+    #endif
+}
+
+void PackageMapping::ReleaseRef()
+{
+    if (!AtomicDecrement(&refs_))
+        delete this;
+}
+
+bool PackageFile::SetMemoryMapped(bool enable)
+{
+    if (!enable)
+    {
+        if (mapping_)
+        {
+            if (GetNumOpenFiles())
+            {
+                LOGERROR("Can not unmap package file " + fileName_ + " while files are open from it");
+                return false;
+            }
+            
+            mapping_->ReleaseRef();
+            mapping_ = 0;
+        }
+        return true;
+    }
+    
+    if (mapping_)
+        return true;
+    if (fileName_.Empty() || !totalSize_)
+        return false;
+    if (compressed_ && !blockSize_)
+    {
+        LOGERROR("Can not map legacy compressed package file " + fileName_ + " to memory");
+        return false;
+    }
+    
+    const unsigned char* mappedData = 0;
+    #ifdef WIN32
+    HANDLE fileHandle = CreateFileW(GetWideNativePath(fileName_).CString(), GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL, 0);
+    if (fileHandle != INVALID_HANDLE_VALUE)
+    {
+        HANDLE mappingHandle = CreateFileMappingW(fileHandle, 0, PAGE_READONLY, 0, 0, 0);
+        if (mappingHandle)
+        {
+            // The view keeps the mapping alive after the handles are closed
+            mappedData = (const unsigned char*)MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, totalSize_);
+            CloseHandle(mappingHandle);
+        }
+        CloseHandle(fileHandle);
+    }
+    #else
+    int fd = open(GetNativePath(fileName_).CString(), O_RDONLY);
+    if (fd != -1)
+    {
+        void* data = mmap(0, totalSize_, PROT_READ, MAP_SHARED, fd, 0);
+        if (data != MAP_FAILED)
+            mappedData = (const unsigned char*)data;
+        close(fd);
+    }
+    #endif
+    
+    if (!mappedData)
+    {
+        LOGERROR("Could not map package file " + fileName_ + " to memory");
+        return false;
+    }
+    
+    mapping_ = new PackageMapping(mappedData, totalSize_);
+    return true;
+}
+
+bool PackageFile::Exists(const String& fileName) const
+{
+    return entries_.Find(fileName.ToLower()) != entries_.End();
+}
+
+const PackageEntry* PackageFile::GetEntry(const String& fileName) const
+{
+    HashMap<String, PackageEntry>::ConstIterator i = entries_.Find(fileName.ToLower());
+    if (i != entries_.End())
+        return &i->second_;
+    else
+        return 0;
+}
+
+}
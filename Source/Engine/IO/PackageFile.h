@@ -1,92 +1,156 @@
-//
-// Copyright (c) 2008-2014 the Urho3D project.
-//
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-//
-// The above copyright notice and this permission notice shall be included in
-// all copies or substantial portions of the Software.
-//
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
-// THE SOFTWARE.
-//
-
-#pragma once
-
-#include "Object.h"
-
-namespace Urho3D
-{
-
-/// %File entry within the package file.
-struct PackageEntry
-{
-    /// Offset from the beginning.
-    unsigned offset_;
-    /// File size.
-    unsigned size_;
-    /// File checksum.
-    unsigned checksum_;
-};
-
-/// Stores files of a directory tree sequentially for convenient access.
-class URHO3D_API PackageFile : public Object
-{
-    OBJECT(PackageFile);
-    
-public:
-    /// Construct.
-    PackageFile(Context* context);
-    /// Construct and open.
-    PackageFile(Context* context, const String& fileName, unsigned startOffset = 0);
-    /// Destruct.
-    virtual ~PackageFile();
-    
-    /// Open the package file. Return true if successful.
-    bool Open(const String& fileName, unsigned startOffset = 0);
-    /// Check if a file exists within the package file.
-    bool Exists(const String& fileName) const;
-    /// Return the file entry corresponding to the name, or null if not found.
-    const PackageEntry* GetEntry(const String& fileName) const;
-    /// Return all file entries.
-    const HashMap<String, PackageEntry>& GetEntries() const { return entries_; }
-    /// Return the package file name.
-    const String& GetName() const { return fileName_; }
-    /// Return hash of the package file name.
-    StringHash GetNameHash() const { return nameHash_; }
-    /// Return number of files.
-    unsigned GetNumFiles() const { return entries_.Size(); }
-    /// Return total size of the package file.
-    unsigned GetTotalSize() const { return totalSize_; }
-    /// Return checksum of the package file contents.
-    unsigned GetChecksum() const { return checksum_; }
-    /// Return whether the files are compressed.
-    bool IsCompressed() const { return compressed_; }
-    /// Return list of entry names
-    const Vector<String> GetEntryNames() const { return entries_.Keys(); }
-    
-private:
-    /// File entries.
-    HashMap<String, PackageEntry> entries_;
-    /// File name.
-    String fileName_;
-    /// Package file name hash.
-    StringHash nameHash_;
-    /// Package file total size.
-    unsigned totalSize_;
-    /// Package file checksum.
-    unsigned checksum_;
-    /// Compressed flag.
-    bool compressed_;
-};
-
-}
+//
+// Copyright (c) 2008-2014 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#pragma once
+
+#include "Atomic.h"
+#include "Object.h"
+
+namespace Urho3D
+{
+
+/// Compression of a file within a package file.
+enum PackageCompression
+{
+    /// Stored uncompressed.
+    PACKAGE_STORE = 0,
+    /// LZ4 compressed.
+    PACKAGE_LZ4,
+    /// LZ4 compressed using the high compression mode. Decompresses the same as LZ4.
+    PACKAGE_LZ4HC
+};
+
+/// %File entry within the package file.
+struct PackageEntry
+{
+    /// Offset from the beginning.
+    unsigned offset_;
+    /// File size.
+    unsigned size_;
+    /// File checksum.
+    unsigned checksum_;
+    /// Compression mode.
+    PackageCompression compression_;
+};
+
+/// Memory mapping of a package file, shared by the package file and the files opened from it. Unmapped when the last reference is released. The reference count is thread-safe.
+class URHO3D_API PackageMapping
+{
+public:
+    /// Construct with one reference.
+    PackageMapping(const unsigned char* data, unsigned size) :
+        data_(data),
+        size_(size),
+        refs_(1)
+    {
+    }
+    
+    /// Add a reference.
+    void AddRef() { AtomicIncrement(&refs_); }
+    /// Release a reference. Unmap and delete if it was the last.
+    void ReleaseRef();
+    
+    /// Return the mapped package file contents.
+    const unsigned char* GetData() const { return data_; }
+    /// Return the mapped size.
+    unsigned GetSize() const { return size_; }
+    /// Return number of references.
+    unsigned GetRefs() const { return (unsigned)refs_; }
+    
+private:
+    /// Destruct. Unmap the memory.
+    ~PackageMapping();
+    
+    /// Mapped package file contents.
+    const unsigned char* data_;
+    /// Mapped size.
+    unsigned size_;
+    /// Reference count.
+    volatile int refs_;
+};
+
+/// Stores files of a directory tree sequentially for convenient access.
+class URHO3D_API PackageFile : public Object
+{
+    OBJECT(PackageFile);
+    
+public:
+    /// Construct.
+    PackageFile(Context* context);
+    /// Construct and open.
+    PackageFile(Context* context, const String& fileName, unsigned startOffset = 0);
+    /// Destruct.
+    virtual ~PackageFile();
+    
+    /// Open the package file. Return true if successful.
+    bool Open(const String& fileName, unsigned startOffset = 0);
+    /// Map the whole package file to memory so that files within it can be read without copying, or unmap it. Packages in the legacy compressed format without block indices can not be mapped, and the package can not be unmapped while files are open from it. Return true if successful.
+    bool SetMemoryMapped(bool enable);
+    /// Check if a file exists within the package file.
+    bool Exists(const String& fileName) const;
+    /// Return the file entry corresponding to the name, or null if not found.
+    const PackageEntry* GetEntry(const String& fileName) const;
+    /// Return all file entries.
+    const HashMap<String, PackageEntry>& GetEntries() const { return entries_; }
+    /// Return the package file name.
+    const String& GetName() const { return fileName_; }
+    /// Return hash of the package file name.
+    StringHash GetNameHash() const { return nameHash_; }
+    /// Return number of files.
+    unsigned GetNumFiles() const { return entries_.Size(); }
+    /// Return total size of the package file.
+    unsigned GetTotalSize() const { return totalSize_; }
+    /// Return checksum of the package file contents.
+    unsigned GetChecksum() const { return checksum_; }
+    /// Return whether the files are compressed.
+    bool IsCompressed() const { return compressed_; }
+    /// Return the uncompressed size of the blocks that compressed files are split into, if the files have block indices for random access. Return 0 for the legacy compressed format and for uncompressed packages.
+    unsigned GetBlockSize() const { return blockSize_; }
+    /// Return list of entry names
+    const Vector<String> GetEntryNames() const { return entries_.Keys(); }
+    /// Return whether the package file is mapped to memory.
+    bool IsMemoryMapped() const { return mapping_ != 0; }
+    /// Return the memory mapping, or null if not mapped. Entry offsets are relative to its data.
+    PackageMapping* GetMapping() const { return mapping_; }
+    /// Return number of files open from the memory-mapped package file.
+    unsigned GetNumOpenFiles() const { return mapping_ ? mapping_->GetRefs() - 1 : 0; }
+    
+private:
+    /// File entries.
+    HashMap<String, PackageEntry> entries_;
+    /// File name.
+    String fileName_;
+    /// Package file name hash.
+    StringHash nameHash_;
+    /// Package file total size.
+    unsigned totalSize_;
+    /// Package file checksum.
+    unsigned checksum_;
+    /// Compressed block size.
+    unsigned blockSize_;
+    /// Memory mapping. Files opened from it hold a reference of their own, as they may outlive the package file.
+    PackageMapping* mapping_;
+    /// Compressed flag.
+    bool compressed_;
+};
+
+}
@@ -1,102 +1,186 @@
-//
-// Copyright (c) 2008-2014 the Urho3D project.
-//
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-//
-// The above copyright notice and this permission notice shall be included in
-// all copies or substantial portions of the Software.
-//
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
-// THE SOFTWARE.
-//
-
-#include "Precompiled.h"
-#include "Matrix3x4.h"
-
-#include <cstdio>
-
-#include "DebugNew.h"
-
-namespace Urho3D
-{
-
-const Matrix3x4 Matrix3x4::ZERO(
-    0.0f, 0.0f, 0.0f, 0.0f,
-    0.0f, 0.0f, 0.0f, 0.0f,
-    0.0f, 0.0f, 0.0f, 0.0f);
-
-const Matrix3x4 Matrix3x4::IDENTITY;
-
-Matrix3x4::Matrix3x4(const Vector3& translation, const Quaternion& rotation, float scale)
-{
-    SetRotation(rotation.RotationMatrix() * scale);
-    SetTranslation(translation);
-}
-
-Matrix3x4::Matrix3x4(const Vector3& translation, const Quaternion& rotation, const Vector3& scale)
-{
-    SetRotation(rotation.RotationMatrix().Scaled(scale));
-    SetTranslation(translation);
-}
-
-void Matrix3x4::Decompose(Vector3& translation, Quaternion& rotation, Vector3& scale) const
-{
-    translation.x_ = m03_;
-    translation.y_ = m13_;
-    translation.z_ = m23_;
-    
-    scale.x_ = sqrtf(m00_ * m00_ + m10_ * m10_ + m20_ * m20_);
-    scale.y_ = sqrtf(m01_ * m01_ + m11_ * m11_ + m21_ * m21_);
-    scale.z_ = sqrtf(m02_ * m02_ + m12_ * m12_ + m22_ * m22_);
-    
-    Vector3 invScale(1.0f / scale.x_, 1.0f / scale.y_, 1.0f / scale.z_);
-    rotation = Quaternion(ToMatrix3().Scaled(invScale));
-}
-
-Matrix3x4 Matrix3x4::Inverse() const
-{
-    float det = m00_ * m11_ * m22_ +
-        m10_ * m21_ * m02_ +
-        m20_ * m01_ * m12_ -
-        m20_ * m11_ * m02_ -
-        m10_ * m01_ * m22_ -
-        m00_ * m21_ * m12_;
-    
-    float invDet = 1.0f / det;
-    Matrix3x4 ret;
-    
-    ret.m00_ = (m11_ * m22_ - m21_ * m12_) * invDet;
-    ret.m01_ = -(m01_ * m22_ - m21_ * m02_) * invDet;
-    ret.m02_ = (m01_ * m12_ - m11_ * m02_) * invDet;
-    ret.m03_ = -(m03_ * ret.m00_ + m13_ * ret.m01_ + m23_ * ret.m02_);
-    ret.m10_ = -(m10_ * m22_ - m20_ * m12_) * invDet;
-    ret.m11_ = (m00_ * m22_ - m20_ * m02_) * invDet;
-    ret.m12_ = -(m00_ * m12_ - m10_ * m02_) * invDet;
-    ret.m13_ = -(m03_ * ret.m10_ + m13_ * ret.m11_ + m23_ * ret.m12_);
-    ret.m20_ = (m10_ * m21_ - m20_ * m11_) * invDet;
-    ret.m21_ = -(m00_ * m21_ - m20_ * m01_) * invDet;
-    ret.m22_ = (m00_ * m11_ - m10_ * m01_) * invDet;
-    ret.m23_ = -(m03_ * ret.m20_ + m13_ * ret.m21_ + m23_ * ret.m22_);
-    
-    return ret;
-}
-
-String Matrix3x4::ToString() const
-{
-    char tempBuffer[MATRIX_CONVERSION_BUFFER_LENGTH];
-    sprintf(tempBuffer, "%g %g %g %g %g %g %g %g %g %g %g %g", m00_, m01_, m02_, m03_, m10_, m11_, m12_, m13_, m20_, m21_, m22_,
-        m23_);
-    return String(tempBuffer);
-}
-
-}
+//
+// Copyright (c) 2008-2014 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "Precompiled.h"
+#include "Matrix3x4.h"
+
+#include <cstdio>
+
+#include "DebugNew.h"
+
+namespace Urho3D
+{
+
+const Matrix3x4 Matrix3x4::ZERO(
+    0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f);
+
+const Matrix3x4 Matrix3x4::IDENTITY;
+
+#if defined(URHO3D_MATH_SSE)
+/// Return the cross product of the first three elements of two vectors. The fourth element is zero.
+static inline __m128 CrossProduct(__m128 lhs, __m128 rhs)
+{
+    __m128 lhsYZX = _mm_shuffle_ps(lhs, lhs, _MM_SHUFFLE(3, 0, 2, 1));
+    __m128 lhsZXY = _mm_shuffle_ps(lhs, lhs, _MM_SHUFFLE(3, 1, 0, 2));
+    __m128 rhsYZX = _mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(3, 0, 2, 1));
+    __m128 rhsZXY = _mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(3, 1, 0, 2));
+    return _mm_sub_ps(_mm_mul_ps(lhsYZX, rhsZXY), _mm_mul_ps(lhsZXY, rhsYZX));
+}
+#elif defined(URHO3D_MATH_NEON)
+/// Return the first three elements of a vector in y, z, x order. The fourth element is undefined.
+static inline float32x4_t SwizzleYZX(float32x4_t v)
+{
+    return vsetq_lane_f32(vgetq_lane_f32(v, 0), vextq_f32(v, v, 1), 2);
+}
+
+/// Return the first three elements of a vector in z, x, y order. The fourth element is undefined.
+static inline float32x4_t SwizzleZXY(float32x4_t v)
+{
+    return vsetq_lane_f32(vgetq_lane_f32(v, 2), vextq_f32(v, v, 3), 0);
+}
+
+/// Return the cross product of the first three elements of two vectors. The fourth element is undefined.
+static inline float32x4_t CrossProduct(float32x4_t lhs, float32x4_t rhs)
+{
+    return vsubq_f32(vmulq_f32(SwizzleYZX(lhs), SwizzleZXY(rhs)), vmulq_f32(SwizzleZXY(lhs), SwizzleYZX(rhs)));
+}
+#endif
+
+Matrix3x4::Matrix3x4(const Vector3& translation, const Quaternion& rotation, float scale)
+{
+    SetRotation(rotation.RotationMatrix() * scale);
+    SetTranslation(translation);
+}
+
+Matrix3x4::Matrix3x4(const Vector3& translation, const Quaternion& rotation, const Vector3& scale)
+{
+    SetRotation(rotation.RotationMatrix().Scaled(scale));
+    SetTranslation(translation);
+}
+
+void Matrix3x4::Decompose(Vector3& translation, Quaternion& rotation, Vector3& scale) const
+{
+    translation.x_ = m03_;
+    translation.y_ = m13_;
+    translation.z_ = m23_;
+    
+    scale.x_ = sqrtf(m00_ * m00_ + m10_ * m10_ + m20_ * m20_);
+    scale.y_ = sqrtf(m01_ * m01_ + m11_ * m11_ + m21_ * m21_);
+    scale.z_ = sqrtf(m02_ * m02_ + m12_ * m12_ + m22_ * m22_);
+    
+    Vector3 invScale(1.0f / scale.x_, 1.0f / scale.y_, 1.0f / scale.z_);
+    rotation = Quaternion(ToMatrix3().Scaled(invScale));
+}
+
+Matrix3x4 Matrix3x4::Inverse() const
+{
+#if defined(URHO3D_MATH_SSE)
+    // The columns of the inverted rotation part are the cross products of the rows divided by the determinant
+    __m128 row0 = _mm_loadu_ps(&m00_);
+    __m128 row1 = _mm_loadu_ps(&m10_);
+    __m128 row2 = _mm_loadu_ps(&m20_);
+    __m128 col0 = CrossProduct(row1, row2);
+    __m128 col1 = CrossProduct(row2, row0);
+    __m128 col2 = CrossProduct(row0, row1);
+    
+    __m128 det = _mm_mul_ps(row0, col0);
+    det = _mm_add_ps(det, _mm_movehl_ps(det, det));
+    det = _mm_add_ss(det, _mm_shuffle_ps(det, det, _MM_SHUFFLE(1, 1, 1, 1)));
+    __m128 invDet = _mm_div_ps(_mm_set1_ps(1.0f), _mm_shuffle_ps(det, det, _MM_SHUFFLE(0, 0, 0, 0)));
+    col0 = _mm_mul_ps(col0, invDet);
+    col1 = _mm_mul_ps(col1, invDet);
+    col2 = _mm_mul_ps(col2, invDet);
+    
+    // The translation is the negated original translation transformed by the inverted rotation part
+    __m128 translation = _mm_sub_ps(_mm_setzero_ps(), _mm_add_ps(_mm_add_ps(_mm_mul_ps(col0, _mm_set1_ps(m03_)),
+        _mm_mul_ps(col1, _mm_set1_ps(m13_))), _mm_mul_ps(col2, _mm_set1_ps(m23_))));
+    _MM_TRANSPOSE4_PS(col0, col1, col2, translation);
+    
+    Matrix3x4 ret;
+    _mm_storeu_ps(&ret.m00_, col0);
+    _mm_storeu_ps(&ret.m10_, col1);
+    _mm_storeu_ps(&ret.m20_, col2);
+    return ret;
+#elif defined(URHO3D_MATH_NEON)
+    // Same as the SSE path. The fourth elements of the columns are undefined and end up in the discarded fourth row
+    float32x4_t row0 = vld1q_f32(&m00_);
+    float32x4_t row1 = vld1q_f32(&m10_);
+    float32x4_t row2 = vld1q_f32(&m20_);
+    float32x4_t col0 = CrossProduct(row1, row2);
+    float32x4_t col1 = CrossProduct(row2, row0);
+    float32x4_t col2 = CrossProduct(row0, row1);
+    
+    float32x4_t det = vmulq_f32(row0, col0);
+    float invDet = 1.0f / (vgetq_lane_f32(det, 0) + vgetq_lane_f32(det, 1) + vgetq_lane_f32(det, 2));
+    col0 = vmulq_n_f32(col0, invDet);
+    col1 = vmulq_n_f32(col1, invDet);
+    col2 = vmulq_n_f32(col2, invDet);
+    
+    float32x4_t translation = vnegq_f32(vaddq_f32(vaddq_f32(vmulq_n_f32(col0, m03_), vmulq_n_f32(col1, m13_)),
+        vmulq_n_f32(col2, m23_)));
+    float32x4x2_t t01 = vtrnq_f32(col0, col1);
+    float32x4x2_t t23 = vtrnq_f32(col2, translation);
+    
+    Matrix3x4 ret;
+    vst1q_f32(&ret.m00_, vcombine_f32(vget_low_f32(t01.val[0]), vget_low_f32(t23.val[0])));
+    vst1q_f32(&ret.m10_, vcombine_f32(vget_low_f32(t01.val[1]), vget_low_f32(t23.val[1])));
+    vst1q_f32(&ret.m20_, vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0])));
+    return ret;
+#else
+    float det = m00_ * m11_ * m22_ +
+        m10_ * m21_ * m02_ +
+        m20_ * m01_ * m12_ -
+        m20_ * m11_ * m02_ -
+        m10_ * m01_ * m22_ -
+        m00_ * m21_ * m12_;
+    
+    float invDet = 1.0f / det;
+    Matrix3x4 ret;
+    
+    ret.m00_ = (m11_ * m22_ - m21_ * m12_) * invDet;
+    ret.m01_ = -(m01_ * m22_ - m21_ * m02_) * invDet;
+    ret.m02_ = (m01_ * m12_ - m11_ * m02_) * invDet;
+    ret.m03_ = -(m03_ * ret.m00_ + m13_ * ret.m01_ + m23_ * ret.m02_);
+    ret.m10_ = -(m10_ * m22_ - m20_ * m12_) * invDet;
+    ret.m11_ = (m00_ * m22_ - m20_ * m02_) * invDet;
+    ret.m12_ = -(m00_ * m12_ - m10_ * m02_) * invDet;
+    ret.m13_ = -(m03_ * ret.m10_ + m13_ * ret.m11_ + m23_ * ret.m12_);
+    ret.m20_ = (m10_ * m21_ - m20_ * m11_) * invDet;
+    ret.m21_ = -(m00_ * m21_ - m20_ * m01_) * invDet;
+    ret.m22_ = (m00_ * m11_ - m10_ * m01_) * invDet;
+    ret.m23_ = -(m03_ * ret.m20_ + m13_ * ret.m21_ + m23_ * ret.m22_);
+    
+    return ret;
+#endif
+}
+
+String Matrix3x4::ToString() const
+{
+    char tempBuffer[MATRIX_CONVERSION_BUFFER_LENGTH];
+    sprintf(tempBuffer, "%g %g %g %g %g %g %g %g %g %g %g %g", m00_, m01_, m02_, m03_, m10_, m11_, m12_, m13_, m20_, m21_, m22_,
+        m23_);
+    return String(tempBuffer);
+}
+
+}
@@ -1,271 +1,334 @@
-//
-// Copyright (c) 2008-2014 the Urho3D project.
-//
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-//
-// The above copyright notice and this permission notice shall be included in
-// all copies or substantial portions of the Software.
-//
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
-// THE SOFTWARE.
-//
-
-#pragma once
-
-#include "Controls.h"
-#include "HashSet.h"
-#include "Object.h"
-#include "ReplicationState.h"
-#include "Timer.h"
-#include "VectorBuffer.h"
-
-#include <kNetFwd.h>
-#include <kNet/SharedPtr.h>
-
-#ifdef SendMessage
-#undef SendMessage
-#endif
-
-namespace Urho3D
-{
-
-class File;
-class MemoryBuffer;
-class Node;
-class Scene;
-class Serializable;
-
-/// Queued remote event.
-struct RemoteEvent
-{
-    /// Remote sender node ID (0 if not a remote node event.)
-    unsigned senderID_;
-    /// Event type.
-    StringHash eventType_;
-    /// Event data.
-    VariantMap eventData_;
-    /// In order flag.
-    bool inOrder_;
-};
-
-/// Package file receive transfer.
-struct PackageDownload
-{
-    /// Construct with defaults.
-    PackageDownload();
-    
-    /// Destination file.
-    SharedPtr<File> file_;
-    /// Already received fragments.
-    HashSet<unsigned> receivedFragments_;
-    /// Package name.
-    String name_;
-    /// Total number of fragments.
-    unsigned totalFragments_;
-    /// Checksum.
-    unsigned checksum_;
-    /// Download initiated flag.
-    bool initiated_;
-};
-
-/// Package file send transfer.
-struct PackageUpload
-{
-    /// Construct with defaults.
-    PackageUpload();
-    
-    /// Source file.
-    SharedPtr<File> file_;
-    /// Current fragment index.
-    unsigned fragment_;
-    /// Total number of fragments
-    unsigned totalFragments_;
-};
-
-/// Send modes for observer position/rotation. Activated by the client setting either position or rotation.
-enum ObserverPositionSendMode
-{
-    OPSM_NONE = 0,
-    OPSM_POSITION,
-    OPSM_POSITION_ROTATION
-};
-
-/// %Connection to a remote network host.
-class URHO3D_API Connection : public Object
-{
-    OBJECT(Connection);
-    
-public:
-    /// Construct with context and kNet message connection pointers.
-    Connection(Context* context, bool isClient, kNet::SharedPtr<kNet::MessageConnection> connection);
-    /// Destruct.
-    ~Connection();
-    
-    /// Send a message.
-    void SendMessage(int msgID, bool reliable, bool inOrder, const VectorBuffer& msg, unsigned contentID = 0);
-    /// Send a message.
-    void SendMessage(int msgID, bool reliable, bool inOrder, const unsigned char* data, unsigned numBytes, unsigned contentID = 0);
-    /// Send a remote event.
-    void SendRemoteEvent(StringHash eventType, bool inOrder, const VariantMap& eventData = Variant::emptyVariantMap);
-    /// Send a remote event with the specified node as sender.
-    void SendRemoteEvent(Node* node, StringHash eventType, bool inOrder, const VariantMap& eventData = Variant::emptyVariantMap);
-    /// Assign scene. On the server, this will cause the client to load it.
-    void SetScene(Scene* newScene);
-    /// Assign identity. Called by Network.
-    void SetIdentity(const VariantMap& identity);
-    /// Set new controls.
-    void SetControls(const Controls& newControls);
-    /// Set the observer position for interest management, to be sent to the server.
-    void SetPosition(const Vector3& position);
-    /// Set the observer rotation for interest management, to be sent to the server. Note: not used by the NetworkPriority component.
-    void SetRotation(const Quaternion& rotation);
-    /// Set the connection pending status. Called by Network.
-    void SetConnectPending(bool connectPending);
-    /// Set whether to log data in/out statistics.
-    void SetLogStatistics(bool enable);
-    /// Disconnect. If wait time is non-zero, will block while waiting for disconnect to finish.
-    void Disconnect(int waitMSec = 0);
-    /// Send scene update messages. Called by Network.
-    void SendServerUpdate();
-    /// Send latest controls from the client. Called by Network.
-    void SendClientUpdate();
-    /// Send queued remote events. Called by Network.
-    void SendRemoteEvents();
-    /// Send package files to client. Called by network.
-    void SendPackages();
-    /// Process pending latest data for nodes and components.
-    void ProcessPendingLatestData();
-    /// Process a message from the server or client. Called by Network.
-    bool ProcessMessage(int msgID, MemoryBuffer& msg);
-    
-    /// Return the kNet message connection.
-    kNet::MessageConnection* GetMessageConnection() const;
-    /// Return client identity.
-    VariantMap& GetIdentity() { return identity_; }
-    /// Return the scene used by this connection.
-    Scene* GetScene() const;
-    /// Return the client controls of this connection.
-    const Controls& GetControls() const { return controls_; }
-    /// Return the observer position sent by the client for interest management.
-    const Vector3& GetPosition() const { return position_; }
-    /// Return the observer rotation sent by the client for interest management.
-    const Quaternion& GetRotation() const { return rotation_; }
-    /// Return whether is a client connection.
-    bool IsClient() const { return isClient_; }
-    /// Return whether is fully connected.
-    bool IsConnected() const;
-    /// Return whether connection is pending.
-    bool IsConnectPending() const { return connectPending_; }
-    /// Return whether the scene is loaded and ready to receive server updates.
-    bool IsSceneLoaded() const { return sceneLoaded_; }
-    /// Return whether to log data in/out statistics.
-    bool GetLogStatistics() const { return logStatistics_; }
-    /// Return remote address.
-    String GetAddress() const { return address_; }
-    /// Return remote port.
-    unsigned short GetPort() const { return port_; }
-    /// Return an address:port string.
-    String ToString() const;
-    /// Return number of package downloads remaining.
-    unsigned GetNumDownloads() const;
-    /// Return name of current package download, or empty if no downloads.
-    const String& GetDownloadName() const;
-    /// Return progress of current package download, or 1.0 if no downloads.
-    float GetDownloadProgress() const;
-    
-    /// Current controls.
-    Controls controls_;
-    /// Identity map.
-    VariantMap identity_;
-    
-private:
-    /// Handle scene loaded event.
-    void HandleAsyncLoadFinished(StringHash eventType, VariantMap& eventData);
-    /// Process a LoadScene message from the server. Called by Network.
-    void ProcessLoadScene(int msgID, MemoryBuffer& msg);
-    /// Process a SceneChecksumError message from the server. Called by Network.
-    void ProcessSceneChecksumError(int msgID, MemoryBuffer& msg);
-    /// Process a scene update message from the server. Called by Network.
-    void ProcessSceneUpdate(int msgID, MemoryBuffer& msg);
-    /// Process package download related messages. Called by Network.
-    void ProcessPackageDownload(int msgID, MemoryBuffer& msg);
-    /// Process an Identity message from the client. Called by Network.
-    void ProcessIdentity(int msgID, MemoryBuffer& msg);
-    /// Process a Controls message from the client. Called by Network.
-    void ProcessControls(int msgID, MemoryBuffer& msg);
-    /// Process a SceneLoaded message from the client. Called by Network.
-    void ProcessSceneLoaded(int msgID, MemoryBuffer& msg);
-    /// Process a remote event message from the client or server. Called by Network.
-    void ProcessRemoteEvent(int msgID, MemoryBuffer& msg);
-    /// Process a node for sending a network update. Recurses to process depended on node(s) first.
-    void ProcessNode(unsigned nodeID);
-    /// Process a node that the client has not yet received.
-    void ProcessNewNode(Node* node);
-    /// Process a node that the client has already received.
-    void ProcessExistingNode(Node* node, NodeReplicationState& nodeState);
-    /// Initiate a package download.
-    void RequestPackage(const String& name, unsigned fileSize, unsigned checksum);
-    /// Send an error reply for a package download.
-    void SendPackageError(const String& name);
-    /// Handle scene load failure on the server or client.
-    void OnSceneLoadFailed();
-    /// Handle a package download failure on the client.
-    void OnPackageDownloadFailed(const String& name);
-    /// Handle all packages loaded successfully. Also called directly on MSG_LOADSCENE if there are none.
-    void OnPackagesReady();
-    
-    /// kNet message connection.
-    kNet::SharedPtr<kNet::MessageConnection> connection_;
-    /// Scene.
-    WeakPtr<Scene> scene_;
-    /// Network replication state of the scene.
-    SceneReplicationState sceneState_;
-    /// Waiting or ongoing package file receive transfers.
-    HashMap<StringHash, PackageDownload> downloads_;
-    /// Ongoing package send transfers.
-    HashMap<StringHash, PackageUpload> uploads_;
-    /// Pending latest data for not yet received nodes.
-    HashMap<unsigned, PODVector<unsigned char> > nodeLatestData_;
-    /// Pending latest data for not yet received components.
-    HashMap<unsigned, PODVector<unsigned char> > componentLatestData_;
-    /// Node ID's to process during a replication update.
-    HashSet<unsigned> nodesToProcess_;
-    /// Reusable message buffer.
-    VectorBuffer msg_;
-    /// Queued remote events.
-    Vector<RemoteEvent> remoteEvents_;
-    /// Scene file to load once all packages (if any) have been downloaded.
-    String sceneFileName_;
-    /// Statistics timer.
-    Timer statsTimer_;
-    /// Remote endpoint address.
-    String address_;
-    /// Remote endpoint port.
-    unsigned short port_;
-    /// Observer position for interest management.
-    Vector3 position_;
-    /// Observer rotation for interest management.
-    Quaternion rotation_;
-    /// Send mode for the observer position & rotation.
-    ObserverPositionSendMode sendMode_;
-    /// Client connection flag.
-    bool isClient_;
-    /// Connection pending flag.
-    bool connectPending_;
-    /// Scene loaded flag.
-    bool sceneLoaded_;
-    /// Show statistics flag.
-    bool logStatistics_;
-};
-
-}
+//
+// Copyright (c) 2008-2014 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#pragma once
+
+#include "Controls.h"
+#include "FlatHashMap.h"
+#include "FlatHashSet.h"
+#include "HashSet.h"
+#include "Object.h"
+#include "ReplicationState.h"
+#include "Timer.h"
+#include "VectorBuffer.h"
+
+#include <kNetFwd.h>
+#include <kNet/SharedPtr.h>
+
+#ifdef SendMessage
+#undef SendMessage
+#endif
+
+namespace Urho3D
+{
+
+class File;
+class MemoryBuffer;
+class NetworkInterestGrid;
+class Node;
+class Scene;
+class Serializable;
+
+/// Queued remote event.
+struct RemoteEvent
+{
+    /// Remote sender node ID (0 if not a remote node event.)
+    unsigned senderID_;
+    /// Event type.
+    StringHash eventType_;
+    /// Event data.
+    VariantMap eventData_;
+    /// In order flag.
+    bool inOrder_;
+};
+
+/// Package file receive transfer.
+struct PackageDownload
+{
+    /// Construct with defaults.
+    PackageDownload();
+    
+    /// Destination file.
+    SharedPtr<File> file_;
+    /// Already received fragments.
+    HashSet<unsigned> receivedFragments_;
+    /// Package name.
+    String name_;
+    /// Total number of fragments.
+    unsigned totalFragments_;
+    /// Checksum.
+    unsigned checksum_;
+    /// Download initiated flag.
+    bool initiated_;
+};
+
+/// Package file send transfer.
+struct PackageUpload
+{
+    /// Construct with defaults.
+    PackageUpload();
+    
+    /// Source file.
+    SharedPtr<File> file_;
+    /// Current fragment index.
+    unsigned fragment_;
+    /// Total number of fragments
+    unsigned totalFragments_;
+};
+
+/// Send modes for observer position/rotation. Activated by the client setting either position or rotation.
+enum ObserverPositionSendMode
+{
+    OPSM_NONE = 0,
+    OPSM_POSITION,
+    OPSM_POSITION_ROTATION
+};
+
+/// %Connection to a remote network host.
+class URHO3D_API Connection : public Object
+{
+    OBJECT(Connection);
+    
+public:
+    /// Construct with context and kNet message connection pointers.
+    Connection(Context* context, bool isClient, kNet::SharedPtr<kNet::MessageConnection> connection);
+    /// Destruct.
+    ~Connection();
+    
+    /// Send a message.
+    void SendMessage(int msgID, bool reliable, bool inOrder, const VectorBuffer& msg, unsigned contentID = 0);
+    /// Send a message.
+    void SendMessage(int msgID, bool reliable, bool inOrder, const unsigned char* data, unsigned numBytes, unsigned contentID = 0);
+    /// Send a remote event.
+    void SendRemoteEvent(StringHash eventType, bool inOrder, const VariantMap& eventData = Variant::emptyVariantMap);
+    /// Send a remote event with the specified node as sender.
+    void SendRemoteEvent(Node* node, StringHash eventType, bool inOrder, const VariantMap& eventData = Variant::emptyVariantMap);
+    /// Assign scene. On the server, this will cause the client to load it.
+    void SetScene(Scene* newScene);
+    /// Assign identity. Called by Network.
+    void SetIdentity(const VariantMap& identity);
+    /// Set new controls.
+    void SetControls(const Controls& newControls);
+    /// Set the observer position for interest management, to be sent to the server.
+    void SetPosition(const Vector3& position);
+    /// Set the observer rotation for interest management, to be sent to the server. Note: not used by the NetworkPriority component.
+    void SetRotation(const Quaternion& rotation);
+    /// Set the area of interest radius around the observer position on the server. Nodes with a NetworkPriority component outside it are not updated until they enter it again. Default 0 (no limit.)
+    void SetInterestRadius(float radius);
+    /// Set the connection pending status. Called by Network.
+    void SetConnectPending(bool connectPending);
+    /// Set whether to log data in/out statistics.
+    void SetLogStatistics(bool enable);
+    /// Disconnect. If wait time is non-zero, will block while waiting for disconnect to finish.
+    void Disconnect(int waitMSec = 0);
+    /// Encode scene update messages without sending them. Can be called from a worker thread, as long as each connection is only processed by one thread. Called by Network.
+    void PrepareServerUpdate();
+    /// Send the scene update messages encoded by PrepareServerUpdate(). Called by Network.
+    void SendServerUpdate();
+    /// Send latest controls from the client. Called by Network.
+    void SendClientUpdate();
+    /// Send queued remote events. Called by Network.
+    void SendRemoteEvents();
+    /// Send package files to client. Called by network.
+    void SendPackages();
+    /// Process pending latest data for nodes and components.
+    void ProcessPendingLatestData();
+    /// Process a message from the server or client. Called by Network.
+    bool ProcessMessage(int msgID, MemoryBuffer& msg);
+    
+    /// Return the kNet message connection.
+    kNet::MessageConnection* GetMessageConnection() const;
+    /// Return client identity.
+    VariantMap& GetIdentity() { return identity_; }
+    /// Return the scene used by this connection.
+    Scene* GetScene() const;
+    /// Return the client controls of this connection.
+    const Controls& GetControls() const { return controls_; }
+    /// Return the observer position sent by the client for interest management.
+    const Vector3& GetPosition() const { return position_; }
+    /// Return the observer rotation sent by the client for interest management.
+    const Quaternion& GetRotation() const { return rotation_; }
+    /// Return the area of interest radius.
+    float GetInterestRadius() const { return interestRadius_; }
+    /// Return whether a node is inside the area of interest. Always true for nodes without a NetworkPriority component, or when the radius is not limited.
+    bool IsInInterest(Node* node) const;
+    /// Return whether is a client connection.
+    bool IsClient() const { return isClient_; }
+    /// Return whether is fully connected.
+    bool IsConnected() const;
+    /// Return whether connection is pending.
+    bool IsConnectPending() const { return connectPending_; }
+    /// Return whether the scene is loaded and ready to receive server updates.
+    bool IsSceneLoaded() const { return sceneLoaded_; }
+    /// Return whether to log data in/out statistics.
+    bool GetLogStatistics() const { return logStatistics_; }
+    /// Return remote address.
+    String GetAddress() const { return address_; }
+    /// Return remote port.
+    unsigned short GetPort() const { return port_; }
+    /// Return an address:port string.
+    String ToString() const;
+    /// Return number of package downloads remaining.
+    unsigned GetNumDownloads() const;
+    /// Return name of current package download, or empty if no downloads.
+    const String& GetDownloadName() const;
+    /// Return progress of current package download, or 1.0 if no downloads.
+    float GetDownloadProgress() const;
+    
+    /// Current controls.
+    Controls controls_;
+    /// Identity map.
+    VariantMap identity_;
+    
+private:
+    /// Handle scene loaded event.
+    void HandleAsyncLoadFinished(StringHash eventType, VariantMap& eventData);
+    /// Process a LoadScene message from the server. Called by Network.
+    void ProcessLoadScene(int msgID, MemoryBuffer& msg);
+    /// Process a SceneChecksumError message from the server. Called by Network.
+    void ProcessSceneChecksumError(int msgID, MemoryBuffer& msg);
+    /// Process a scene update message from the server. Called by Network.
+    void ProcessSceneUpdate(int msgID, MemoryBuffer& msg);
+    /// Process package download related messages. Called by Network.
+    void ProcessPackageDownload(int msgID, MemoryBuffer& msg);
+    /// Process an Identity message from the client. Called by Network.
+    void ProcessIdentity(int msgID, MemoryBuffer& msg);
+    /// Process a Controls message from the client. Called by Network.
+    void ProcessControls(int msgID, MemoryBuffer& msg);
+    /// Process a SceneLoaded message from the client. Called by Network.
+    void ProcessSceneLoaded(int msgID, MemoryBuffer& msg);
+    /// Process a remote event message from the client or server. Called by Network.
+    void ProcessRemoteEvent(int msgID, MemoryBuffer& msg);
+    /// Process a batched scene update or latest data message from the server. Called by Network.
+    void ProcessSceneUpdateBatch(int msgID, MemoryBuffer& msg);
+    /// Process a node for sending a network update. Recurses to process depended on node(s) first.
+    void ProcessNode(unsigned nodeID);
+    /// Query the nodes inside the area of interest from the interest grid and record the nodes that entered or left it.
+    void UpdateInterest();
+    /// Send the area of interest enter and leave events.
+    void SendInterestEvents();
+    /// Process a node that the client has not yet received.
+    void ProcessNewNode(Node* node);
+    /// Process a node that the client has already received.
+    void ProcessExistingNode(Node* node, NodeReplicationState& nodeState);
+    /// Add a reliable in-order scene update message to the current batch.
+    void QueueSceneUpdate(int msgID, const VectorBuffer& msg);
+    /// Add a latest data message to the current batch.
+    void QueueLatestData(int msgID, const VectorBuffer& msg);
+    /// Finish the current scene update batch if not empty.
+    void FinishSceneUpdateBatch();
+    /// Finish the current latest data batch if not empty.
+    void FinishLatestDataBatch();
+    /// Send finished batches reliably as messages, optionally in order, and clear them.
+    void SendBatches(int msgID, bool inOrder, VectorBuffer& batches, PODVector<unsigned>& batchEnds);
+    /// Initiate a package download.
+    void RequestPackage(const String& name, unsigned fileSize, unsigned checksum);
+    /// Send an error reply for a package download.
+    void SendPackageError(const String& name);
+    /// Handle scene load failure on the server or client.
+    void OnSceneLoadFailed();
+    /// Handle a package download failure on the client.
+    void OnPackageDownloadFailed(const String& name);
+    /// Handle all packages loaded successfully. Also called directly on MSG_LOADSCENE if there are none.
+    void OnPackagesReady();
+    
+    /// kNet message connection.
+    kNet::SharedPtr<kNet::MessageConnection> connection_;
+    /// Scene.
+    WeakPtr<Scene> scene_;
+    /// Network replication state of the scene.
+    SceneReplicationState sceneState_;
+    /// Waiting or ongoing package file receive transfers.
+    HashMap<StringHash, PackageDownload> downloads_;
+    /// Ongoing package send transfers.
+    HashMap<StringHash, PackageUpload> uploads_;
+    /// Pending latest data for not yet received nodes.
+    FlatHashMap<unsigned, PODVector<unsigned char> > nodeLatestData_;
+    /// Pending latest data for not yet received components.
+    FlatHashMap<unsigned, PODVector<unsigned char> > componentLatestData_;
+    /// Server update number of the latest data received for each node and component. Component IDs have the high bit set.
+    FlatHashMap<unsigned, unsigned> latestDataUpdates_;
+    /// Node ID's to process during a replication update.
+    HashSet<unsigned> nodesToProcess_;
+    /// Reusable message buffer.
+    VectorBuffer msg_;
+    /// Batched scene update messages.
+    VectorBuffer sceneUpdateBatch_;
+    /// Batched latest data messages.
+    VectorBuffer latestDataBatch_;
+    /// End offsets of finished scene update batches.
+    PODVector<unsigned> sceneUpdateBatchEnds_;
+    /// End offsets of finished latest data batches.
+    PODVector<unsigned> latestDataBatchEnds_;
+    /// New node replication states to link to their nodes in the main thread.
+    PODVector<Pair<NodeReplicationState*, Node*> > newNodeStates_;
+    /// New component replication states to link to their components in the main thread.
+    PODVector<Pair<ComponentReplicationState*, Component*> > newComponentStates_;
+    /// Replication states of removed nodes to erase in the main thread.
+    PODVector<unsigned> removedNodeStates_;
+    /// Replication states of removed components to erase in the main thread.
+    PODVector<Pair<NodeReplicationState*, unsigned> > removedComponentStates_;
+    /// Server update number.
+    unsigned updateNumber_;
+    /// Queued remote events.
+    Vector<RemoteEvent> remoteEvents_;
+    /// Scene file to load once all packages (if any) have been downloaded.
+    String sceneFileName_;
+    /// Statistics timer.
+    Timer statsTimer_;
+    /// Remote endpoint address.
+    String address_;
+    /// Remote endpoint port.
+    unsigned short port_;
+    /// Observer position for interest management.
+    Vector3 position_;
+    /// Observer rotation for interest management.
+    Quaternion rotation_;
+    /// Interest grid of the scene during a server update.
+    NetworkInterestGrid* interestGrid_;
+    /// Nodes with interest management inside the area of interest.
+    FlatHashSet<unsigned> interestNodes_;
+    /// Nodes inside the area of interest on the previous server update.
+    FlatHashSet<unsigned> previousInterestNodes_;
+    /// Dirty nodes outside the area of interest. Not processed until they enter it again.
+    FlatHashSet<unsigned> outOfInterestNodes_;
+    /// Interest grid query result.
+    PODVector<unsigned> interestQuery_;
+    /// Nodes that entered the area of interest, for sending events in the main thread.
+    PODVector<unsigned> enteredInterestNodes_;
+    /// Nodes that left the area of interest, for sending events in the main thread.
+    PODVector<unsigned> leftInterestNodes_;
+    /// Area of interest radius.
+    float interestRadius_;
+    /// Send mode for the observer position & rotation.
+    ObserverPositionSendMode sendMode_;
+    /// Client connection flag.
+    bool isClient_;
+    /// Connection pending flag.
+    bool connectPending_;
+    /// Scene loaded flag.
+    bool sceneLoaded_;
+    /// Show statistics flag.
+    bool logStatistics_;
+};
+
+}
@@ -0,0 +1,254 @@
+//
+// Copyright (c) 2008-2014 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "Precompiled.h"
+#include "Context.h"
+#include "NetworkInterestGrid.h"
+#include "NetworkPriority.h"
+#include "Node.h"
+#include "Scene.h"
+
+#include "DebugNew.h"
+
+namespace Urho3D
+{
+
+extern const char* NETWORK_CATEGORY;
+
+static const float DEFAULT_CELL_SIZE = 50.0f;
+/// Cell coordinates are clamped to 10 bits per axis to fit the cell key. Nodes beyond are placed to the outermost cells.
+static const int MAX_CELL_COORDINATE = 511;
+
+NetworkInterestGrid::NetworkInterestGrid(Context* context) :
+    Component(context),
+    cellSize_(DEFAULT_CELL_SIZE)
+{
+}
+
+NetworkInterestGrid::~NetworkInterestGrid()
+{
+}
+
+void NetworkInterestGrid::RegisterObject(Context* context)
+{
+    context->RegisterFactory<NetworkInterestGrid>(NETWORK_CATEGORY);
+    
+    ACCESSOR_ATTRIBUTE(NetworkInterestGrid, VAR_FLOAT, "Cell Size", GetCellSize, SetCellSize, float, DEFAULT_CELL_SIZE, AM_DEFAULT);
+}
+
+void NetworkInterestGrid::SetCellSize(float size)
+{
+    size = Max(size, M_EPSILON);
+    if (size != cellSize_)
+    {
+        cellSize_ = size;
+        RebuildCells();
+    }
+}
+
+void NetworkInterestGrid::AddPriority(NetworkPriority* priority)
+{
+    Node* node = priority ? priority->GetNode() : 0;
+    if (!node)
+        return;
+    
+    unsigned nodeID = node->GetID();
+    FlatHashMap<unsigned, InterestGridEntry>::Iterator i = entries_.Find(nodeID);
+    if (i != entries_.End())
+    {
+        i->second_.priority_ = priority;
+        return;
+    }
+    
+    InterestGridEntry& entry = entries_[nodeID];
+    entry.priority_ = priority;
+    entry.position_ = node->GetWorldPosition();
+    entry.cell_ = GetCellKey(entry.position_);
+    AddToCell(entry.cell_, nodeID);
+}
+
+void NetworkInterestGrid::RemovePriority(NetworkPriority* priority, unsigned nodeID)
+{
+    FlatHashMap<unsigned, InterestGridEntry>::Iterator i = entries_.Find(nodeID);
+    if (i == entries_.End() || i->second_.priority_.Get() != priority)
+        return;
+    
+    RemoveFromCell(i->second_.cell_, nodeID);
+    entries_.Erase(i);
+    pendingRemovedNodes_.Push(nodeID);
+}
+
+void NetworkInterestGrid::OnNodeSet(Node* node)
+{
+    // Collect the interest management settings that existed before the grid
+    Scene* scene = GetScene();
+    if (scene)
+    {
+        PODVector<NetworkPriority*> priorities;
+        scene->GetComponents<NetworkPriority>(priorities, true);
+        for (PODVector<NetworkPriority*>::ConstIterator i = priorities.Begin(); i != priorities.End(); ++i)
+            (*i)->AddToGrid(scene);
+    }
+}
+
+void NetworkInterestGrid::Update()
+{
+    Scene* scene = GetScene();
+    
+    // Let the connections see the removals since the last update during this update
+    removedNodes_.Clear();
+    removedNodes_.Swap(pendingRemovedNodes_);
+    
+    for (FlatHashMap<unsigned, InterestGridEntry>::Iterator i = entries_.Begin(); i != entries_.End();)
+    {
+        InterestGridEntry& entry = i->second_;
+        Node* node = entry.priority_ ? entry.priority_->GetNode() : 0;
+        
+        // Drop the entry if the component or node has been removed, or the ID no longer refers to the node
+        if (!node || node->GetScene() != scene || node->GetID() != i->first_)
+        {
+            RemoveFromCell(entry.cell_, i->first_);
+            removedNodes_.Push(i->first_);
+            i = entries_.Erase(i);
+            continue;
+        }
+        
+        entry.position_ = node->GetWorldPosition();
+        unsigned cell = GetCellKey(entry.position_);
+        if (cell != entry.cell_)
+        {
+            RemoveFromCell(entry.cell_, i->first_);
+            AddToCell(cell, i->first_);
+            entry.cell_ = cell;
+        }
+        
+        ++i;
+    }
+}
+
+void NetworkInterestGrid::GetNodes(PODVector<unsigned>& dest, const Vector3& position, float radius) const
+{
+    int minX = GetCellCoordinate(position.x_ - radius);
+    int maxX = GetCellCoordinate(position.x_ + radius);
+    int minY = GetCellCoordinate(position.y_ - radius);
+    int maxY = GetCellCoordinate(position.y_ + radius);
+    int minZ = GetCellCoordinate(position.z_ - radius);
+    int maxZ = GetCellCoordinate(position.z_ + radius);
+    float radiusSquared = radius * radius;
+    
+    // If the query covers more cells than are occupied, go through the occupied cells instead
+    unsigned numQueryCells = (unsigned)((maxX - minX + 1) * (maxY - minY + 1) * (maxZ - minZ + 1));
+    if (numQueryCells > cells_.Size())
+    {
+        for (FlatHashMap<unsigned, PODVector<unsigned> >::ConstIterator i = cells_.Begin(); i != cells_.End(); ++i)
+        {
+            const PODVector<unsigned>& nodeIDs = i->second_;
+            for (unsigned j = 0; j < nodeIDs.Size(); ++j)
+            {
+                const InterestGridEntry* entry = GetEntry(nodeIDs[j]);
+                if (entry && (entry->position_ - position).LengthSquared() <= radiusSquared)
+                    dest.Push(nodeIDs[j]);
+            }
+        }
+        return;
+    }
+    
+    for (int z = minZ; z <= maxZ; ++z)
+    {
+        for (int y = minY; y <= maxY; ++y)
+        {
+            for (int x = minX; x <= maxX; ++x)
+            {
+                unsigned key = (unsigned)(x + MAX_CELL_COORDINATE + 1) | ((unsigned)(y + MAX_CELL_COORDINATE + 1) << 10) |
+                    ((unsigned)(z + MAX_CELL_COORDINATE + 1) << 20);
+                FlatHashMap<unsigned, PODVector<unsigned> >::ConstIterator i = cells_.Find(key);
+                if (i == cells_.End())
+                    continue;
+                
+                const PODVector<unsigned>& nodeIDs = i->second_;
+                for (unsigned j = 0; j < nodeIDs.Size(); ++j)
+                {
+                    const InterestGridEntry* entry = GetEntry(nodeIDs[j]);
+                    if (entry && (entry->position_ - position).LengthSquared() <= radiusSquared)
+                        dest.Push(nodeIDs[j]);
+                }
+            }
+        }
+    }
+}
+
+int NetworkInterestGrid::GetCellCoordinate(float value) const
+{
+    float coordinate = floorf(value / cellSize_);
+    if (coordinate < -(float)(MAX_CELL_COORDINATE + 1))
+        return -(MAX_CELL_COORDINATE + 1);
+    else if (coordinate > (float)MAX_CELL_COORDINATE)
+        return MAX_CELL_COORDINATE;
+    else
+        return (int)coordinate;
+}
+
+unsigned NetworkInterestGrid::GetCellKey(const Vector3& position) const
+{
+    return (unsigned)(GetCellCoordinate(position.x_) + MAX_CELL_COORDINATE + 1) |
+        ((unsigned)(GetCellCoordinate(position.y_) + MAX_CELL_COORDINATE + 1) << 10) |
+        ((unsigned)(GetCellCoordinate(position.z_) + MAX_CELL_COORDINATE + 1) << 20);
+}
+
+void NetworkInterestGrid::AddToCell(unsigned cell, unsigned nodeID)
+{
+    cells_[cell].Push(nodeID);
+}
+
+void NetworkInterestGrid::RemoveFromCell(unsigned cell, unsigned nodeID)
+{
+    FlatHashMap<unsigned, PODVector<unsigned> >::Iterator i = cells_.Find(cell);
+    if (i == cells_.End())
+        return;
+    
+    PODVector<unsigned>& nodeIDs = i->second_;
+    for (unsigned j = 0; j < nodeIDs.Size(); ++j)
+    {
+        if (nodeIDs[j] == nodeID)
+        {
+            nodeIDs[j] = nodeIDs.Back();
+            nodeIDs.Pop();
+            break;
+        }
+    }
+    
+    if (nodeIDs.Empty())
+        cells_.Erase(i);
+}
+
+void NetworkInterestGrid::RebuildCells()
+{
+    cells_.Clear();
+    
+    for (FlatHashMap<unsigned, InterestGridEntry>::Iterator i = entries_.Begin(); i != entries_.End(); ++i)
+    {
+        i->second_.cell_ = GetCellKey(i->second_.position_);
+        AddToCell(i->second_.cell_, i->first_);
+    }
+}
+
+}
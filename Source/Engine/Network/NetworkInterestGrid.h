@@ -0,0 +1,110 @@
+//
+// Copyright (c) 2008-2014 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#pragma once
+
+#include "Component.h"
+#include "FlatHashMap.h"
+#include "Vector3.h"
+
+namespace Urho3D
+{
+
+class NetworkPriority;
+
+/// Cached interest management state of a node in the grid.
+struct URHO3D_API InterestGridEntry
+{
+    /// Interest management settings component.
+    WeakPtr<NetworkPriority> priority_;
+    /// World position at the last grid update.
+    Vector3 position_;
+    /// Grid cell key.
+    unsigned cell_;
+};
+
+/// Scene-level spatial grid of the nodes that have a NetworkPriority component. Lets the server connections find the interest management settings and the nodes near the observer without going through the whole scene. Created automatically as local and temporary by the server to the scenes it replicates.
+class URHO3D_API NetworkInterestGrid : public Component
+{
+    OBJECT(NetworkInterestGrid);
+    
+public:
+    /// Construct.
+    NetworkInterestGrid(Context* context);
+    /// Destruct.
+    virtual ~NetworkInterestGrid();
+    /// Register object factory.
+    static void RegisterObject(Context* context);
+    
+    /// Set grid cell size. Should be in the same order as the connections' interest radius.
+    void SetCellSize(float size);
+    /// Add a node's interest management settings. Called by NetworkPriority.
+    void AddPriority(NetworkPriority* priority);
+    /// Remove a node's interest management settings. Called by NetworkPriority.
+    void RemovePriority(NetworkPriority* priority, unsigned nodeID);
+    /// Update node positions and grid cells. Called by Network before the server update.
+    void Update();
+    /// Return node IDs within distance of a position.
+    void GetNodes(PODVector<unsigned>& dest, const Vector3& position, float radius) const;
+    
+    /// Return grid cell size.
+    float GetCellSize() const { return cellSize_; }
+    /// Return the entry of a node, or null if the node has no interest management settings.
+    const InterestGridEntry* GetEntry(unsigned nodeID) const
+    {
+        FlatHashMap<unsigned, InterestGridEntry>::ConstIterator i = entries_.Find(nodeID);
+        return i != entries_.End() ? &i->second_ : 0;
+    }
+    /// Return number of nodes in the grid.
+    unsigned GetNumNodes() const { return entries_.Size(); }
+    /// Return IDs of the nodes removed from the grid since the update before the last.
+    const PODVector<unsigned>& GetRemovedNodes() const { return removedNodes_; }
+    
+protected:
+    /// Handle node being assigned.
+    virtual void OnNodeSet(Node* node);
+    
+private:
+    /// Return cell coordinate for a position component.
+    int GetCellCoordinate(float value) const;
+    /// Return cell key for a world position.
+    unsigned GetCellKey(const Vector3& position) const;
+    /// Add a node ID to a cell.
+    void AddToCell(unsigned cell, unsigned nodeID);
+    /// Remove a node ID from a cell.
+    void RemoveFromCell(unsigned cell, unsigned nodeID);
+    /// Place all nodes in the cells again.
+    void RebuildCells();
+    
+    /// Entries by node ID.
+    FlatHashMap<unsigned, InterestGridEntry> entries_;
+    /// Node IDs by cell key.
+    FlatHashMap<unsigned, PODVector<unsigned> > cells_;
+    /// IDs of the nodes removed before or during the last update.
+    PODVector<unsigned> removedNodes_;
+    /// IDs of the nodes removed since the last update.
+    PODVector<unsigned> pendingRemovedNodes_;
+    /// Cell size.
+    float cellSize_;
+};
+
+}
@@ -1,99 +1,141 @@
-//
-// Copyright (c) 2008-2014 the Urho3D project.
-//
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-//
-// The above copyright notice and this permission notice shall be included in
-// all copies or substantial portions of the Software.
-//
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
-// THE SOFTWARE.
-//
-
-#include "Precompiled.h"
-#include "Context.h"
-#include "NetworkPriority.h"
-
-#include "DebugNew.h"
-
-namespace Urho3D
-{
-
-const char* NETWORK_CATEGORY = "Network";
-
-static const float DEFAULT_BASE_PRIORITY = 100.0f;
-static const float DEFAULT_DISTANCE_FACTOR = 0.0f;
-static const float DEFAULT_MIN_PRIORITY = 0.0f;
-static const float UPDATE_THRESHOLD = 100.0f;
-
-NetworkPriority::NetworkPriority(Context* context) :
-    Component(context),
-    basePriority_(DEFAULT_BASE_PRIORITY),
-    distanceFactor_(DEFAULT_DISTANCE_FACTOR),
-    minPriority_(DEFAULT_MIN_PRIORITY),
-    alwaysUpdateOwner_(true)
-{
-}
-
-NetworkPriority::~NetworkPriority()
-{
-}
-
-void NetworkPriority::RegisterObject(Context* context)
-{
-    context->RegisterFactory<NetworkPriority>(NETWORK_CATEGORY);
-    
-    ATTRIBUTE(NetworkPriority, VAR_FLOAT, "Base Priority", basePriority_, DEFAULT_BASE_PRIORITY, AM_DEFAULT);
-    ATTRIBUTE(NetworkPriority, VAR_FLOAT, "Distance Factor", distanceFactor_, DEFAULT_DISTANCE_FACTOR, AM_DEFAULT);
-    ATTRIBUTE(NetworkPriority, VAR_FLOAT, "Minimum Priority", minPriority_, DEFAULT_MIN_PRIORITY, AM_DEFAULT);
-    ATTRIBUTE(NetworkPriority, VAR_BOOL, "Always Update Owner", alwaysUpdateOwner_, true, AM_DEFAULT);
-}
-
-void NetworkPriority::SetBasePriority(float priority)
-{
-    basePriority_ = Max(priority, 0.0f);
-    MarkNetworkUpdate();
-}
-
-void NetworkPriority::SetDistanceFactor(float factor)
-{
-    distanceFactor_ = Max(factor, 0.0f);
-    MarkNetworkUpdate();
-}
-
-void NetworkPriority::SetMinPriority(float priority)
-{
-    minPriority_ = Max(priority, 0.0f);
-    MarkNetworkUpdate();
-}
-
-void NetworkPriority::SetAlwaysUpdateOwner(bool enable)
-{
-    alwaysUpdateOwner_ = enable;
-    MarkNetworkUpdate();
-}
-
-bool NetworkPriority::CheckUpdate(float distance, float& accumulator)
-{
-    float currentPriority = Max(basePriority_ - distanceFactor_ * distance, minPriority_);
-    accumulator += currentPriority;
-    if (accumulator >= UPDATE_THRESHOLD)
-    {
-        accumulator = fmodf(accumulator, UPDATE_THRESHOLD);
-        return true;
-    }
-    else
-        return false;
-}
-
-}
+//
+// Copyright (c) 2008-2014 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "Precompiled.h"
+#include "Context.h"
+#include "NetworkInterestGrid.h"
+#include "NetworkPriority.h"
+#include "Scene.h"
+
+#include "DebugNew.h"
+
+namespace Urho3D
+{
+
+const char* NETWORK_CATEGORY = "Network";
+
+static const float DEFAULT_BASE_PRIORITY = 100.0f;
+static const float DEFAULT_DISTANCE_FACTOR = 0.0f;
+static const float DEFAULT_MIN_PRIORITY = 0.0f;
+static const float UPDATE_THRESHOLD = 100.0f;
+
+NetworkPriority::NetworkPriority(Context* context) :
+    Component(context),
+    basePriority_(DEFAULT_BASE_PRIORITY),
+    distanceFactor_(DEFAULT_DISTANCE_FACTOR),
+    minPriority_(DEFAULT_MIN_PRIORITY),
+    alwaysUpdateOwner_(true),
+    gridNodeID_(0)
+{
+}
+
+NetworkPriority::~NetworkPriority()
+{
+    RemoveFromGrid();
+}
+
+void NetworkPriority::RegisterObject(Context* context)
+{
+    context->RegisterFactory<NetworkPriority>(NETWORK_CATEGORY);
+    
+    ATTRIBUTE(NetworkPriority, VAR_FLOAT, "Base Priority", basePriority_, DEFAULT_BASE_PRIORITY, AM_DEFAULT);
+    ATTRIBUTE(NetworkPriority, VAR_FLOAT, "Distance Factor", distanceFactor_, DEFAULT_DISTANCE_FACTOR, AM_DEFAULT);
+    ATTRIBUTE(NetworkPriority, VAR_FLOAT, "Minimum Priority", minPriority_, DEFAULT_MIN_PRIORITY, AM_DEFAULT);
+    ATTRIBUTE(NetworkPriority, VAR_BOOL, "Always Update Owner", alwaysUpdateOwner_, true, AM_DEFAULT);
+}
+
+void NetworkPriority::SetBasePriority(float priority)
+{
+    basePriority_ = Max(priority, 0.0f);
+    MarkNetworkUpdate();
+}
+
+void NetworkPriority::SetDistanceFactor(float factor)
+{
+    distanceFactor_ = Max(factor, 0.0f);
+    MarkNetworkUpdate();
+}
+
+void NetworkPriority::SetMinPriority(float priority)
+{
+    minPriority_ = Max(priority, 0.0f);
+    MarkNetworkUpdate();
+}
+
+void NetworkPriority::SetAlwaysUpdateOwner(bool enable)
+{
+    alwaysUpdateOwner_ = enable;
+    MarkNetworkUpdate();
+}
+
+bool NetworkPriority::CheckUpdate(float distance, float& accumulator)
+{
+    float currentPriority = Max(basePriority_ - distanceFactor_ * distance, minPriority_);
+    accumulator += currentPriority;
+    if (accumulator >= UPDATE_THRESHOLD)
+    {
+        accumulator = fmodf(accumulator, UPDATE_THRESHOLD);
+        return true;
+    }
+    else
+        return false;
+}
+
+void NetworkPriority::OnNodeSet(Node* node)
+{
+    // If the node is detached, registration happens when it is added to a scene
+    if (node)
+        AddToGrid(GetScene());
+    else
+        RemoveFromGrid();
+}
+
+void NetworkPriority::OnSceneSet(Scene* scene)
+{
+    AddToGrid(scene);
+}
+
+void NetworkPriority::AddToGrid(Scene* scene)
+{
+    RemoveFromGrid();
+    
+    // Register to the scene's interest grid, which the server connections use to find the settings. The server creates
+    // the grid when it starts replicating the scene, after which the grid collects the already existing components
+    NetworkInterestGrid* grid = scene && node_ ? scene->GetComponent<NetworkInterestGrid>() : 0;
+    if (grid)
+    {
+        grid_ = grid;
+        gridNodeID_ = node_->GetID();
+        grid->AddPriority(this);
+    }
+}
+
+void NetworkPriority::RemoveFromGrid()
+{
+    if (grid_)
+        grid_->RemovePriority(this, gridNodeID_);
+    
+    grid_.Reset();
+    gridNodeID_ = 0;
+}
+
+}
@@ -24,6 +24,7 @@
 #include "BackgroundLoader.h"
 #include "Context.h"
 #include "Log.h"
+#include "ProcessUtils.h"
 #include "Profiler.h"
 #include "ResourceCache.h"
 #include "ResourceEvents.h"
@@ -34,86 +35,148 @@
 namespace Urho3D
 {
 
+/// Default maximum number of loader threads. More than this tends to only contend for file access.
+static const int DEFAULT_MAX_LOADER_THREADS = 4;
+
+/// Loader thread managed by the background loader.
+class BackgroundLoaderThread : public Thread, public RefCounted
+{
+public:
+    /// Construct.
+    BackgroundLoaderThread(BackgroundLoader* owner) :
+        owner_(owner)
+    {
+    }
+    
+    /// Load resources until stopped. Sleep on the queue condition while there is nothing to load.
+    virtual void ThreadFunction()
+    {
+        while (shouldRun_)
+        {
+            if (!owner_->ProcessItem())
+                owner_->queueCondition_.Wait();
+        }
+        
+        // The threads are stopped together, so pass the wakeup on to the next waiting thread
+        owner_->queueCondition_.Set();
+    }
+    
+    /// Request the thread to stop after its current resource. Does not wait for it.
+    void RequestStop() { shouldRun_ = false; }
+    
+private:
+    /// Background loader.
+    BackgroundLoader* owner_;
+};
+
 BackgroundLoader::BackgroundLoader(ResourceCache* owner) :
-    owner_(owner)
+    owner_(owner),
+    numThreads_(Clamp((int)GetNumPhysicalCPUs() - 1, 1, DEFAULT_MAX_LOADER_THREADS))
+{
+}
+
+BackgroundLoader::~BackgroundLoader()
 {
+    StopThreads();
 }
 
-void BackgroundLoader::ThreadFunction()
+void BackgroundLoader::SetNumThreads(unsigned num)
 {
-    while (shouldRun_)
+    num = Max((int)num, 1);
+    if (num == numThreads_)
+        return;
+    
+    StopThreads();
+    
+    MutexLock lock(backgroundLoadMutex_);
+    numThreads_ = num;
+    StartThreads();
+}
+
+bool BackgroundLoader::ProcessItem()
+{
+    backgroundLoadMutex_.Acquire();
+    BackgroundLoadItem* item = TakeItem();
+    // If more resources are waiting, let another thread load them in parallel
+    if (item)
+        SignalQueuedItems();
+    // We can be sure that the item is not removed from the queue as long as it is in the "loading" state
+    backgroundLoadMutex_.Release();
+    
+    if (!item)
+        return false;
+    
+    Resource* resource = item->resource_;
+    bool success = false;
+    SharedPtr<File> file = owner_->GetFile(resource->GetName(), item->sendEventOnFailure_);
+    if (file)
+        success = resource->BeginLoad(*file);
+    
+    // Process dependencies now
+    // Need to lock the queue again when manipulating other entries
+    Pair<StringHash, StringHash> key = MakePair(resource->GetType(), resource->GetNameHash());
+    MutexLock lock(backgroundLoadMutex_);
+    if (item->dependents_.Size())
     {
-        backgroundLoadMutex_.Acquire();
-        
-        // Search for a queued resource that has not been loaded yet
-        HashMap<Pair<StringHash, StringHash>, BackgroundLoadItem>::Iterator i = backgroundLoadQueue_.Begin();
-        while (i != backgroundLoadQueue_.End())
+        for (HashSet<Pair<StringHash, StringHash> >::Iterator i = item->dependents_.Begin(); i != item->dependents_.End(); ++i)
         {
-            if (i->second_.resource_->GetAsyncLoadState() == ASYNC_QUEUED)
-                break;
-            else
-                ++i;
+            HashMap<Pair<StringHash, StringHash>, BackgroundLoadItem>::Iterator j = backgroundLoadQueue_.Find(*i);
+            if (j != backgroundLoadQueue_.End())
+                j->second_.dependencies_.Erase(key);
         }
         
-        if (i == backgroundLoadQueue_.End())
-        {
-            // No resources to load found
-            backgroundLoadMutex_.Release();
-            Time::Sleep(5);
-        }
-        else
-        {
-            BackgroundLoadItem& item = i->second_;
-            Resource* resource = item.resource_;
-            // We can be sure that the item is not removed from the queue as long as it is in the
-            // "queued" or "loading" state
-            backgroundLoadMutex_.Release();
-            
-            bool success = false;
-            SharedPtr<File> file = owner_->GetFile(resource->GetName(), item.sendEventOnFailure_);
-            if (file)
-            {
-                resource->SetAsyncLoadState(ASYNC_LOADING);
-                success = resource->BeginLoad(*file);
-            }
-            
-            // Process dependencies now
-            // Need to lock the queue again when manipulating other entries
-            Pair<StringHash, StringHash> key = MakePair(resource->GetType(), resource->GetNameHash());
-            backgroundLoadMutex_.Acquire();
-            if (item.dependents_.Size())
-            {
-                for (HashSet<Pair<StringHash, StringHash> >::Iterator i = item.dependents_.Begin(); i != item.dependents_.End();
-                    ++i)
-                {
-                    HashMap<Pair<StringHash, StringHash>, BackgroundLoadItem>::Iterator j =
-                        backgroundLoadQueue_.Find(*i);
-                    if (j != backgroundLoadQueue_.End())
-                        j->second_.dependencies_.Erase(key);
-                }
-                
-                item.dependents_.Clear();
-            }
-            
-            resource->SetAsyncLoadState(success ? ASYNC_SUCCESS : ASYNC_FAIL);
-            backgroundLoadMutex_.Release();
-        }
+        item->dependents_.Clear();
     }
+    
+    resource->SetAsyncLoadState(success ? ASYNC_SUCCESS : ASYNC_FAIL);
+    return true;
 }
 
-bool BackgroundLoader::QueueResource(StringHash type, const String& name, bool sendEventOnFailure, Resource* caller)
+bool BackgroundLoader::QueueResource(StringHash type, const String& name, bool sendEventOnFailure, Resource* caller,
+    ResourceLoadPriority priority)
 {
     StringHash nameHash(name);
     Pair<StringHash, StringHash> key = MakePair(type, nameHash);
     
     MutexLock lock(backgroundLoadMutex_);
     
-    // Check if already exists in the queue
-    if (backgroundLoadQueue_.Find(key) != backgroundLoadQueue_.End())
+    // If this is a resource calling for the background load of more resources, find the caller to mark the dependency.
+    // The dependency is needed at least as urgently as the caller
+    HashMap<Pair<StringHash, StringHash>, BackgroundLoadItem>::Iterator j = backgroundLoadQueue_.End();
+    if (caller)
+    {
+        Pair<StringHash, StringHash> callerKey = MakePair(caller->GetType(), caller->GetNameHash());
+        j = backgroundLoadQueue_.Find(callerKey);
+        if (j != backgroundLoadQueue_.End())
+        {
+            if (j->second_.priority_ < priority)
+                priority = j->second_.priority_;
+        }
+        else
+            LOGWARNING("Resource " + caller->GetName() + " requested for a background loaded resource but was not in the background load queue");
+    }
+    
+    // Check if already exists in the queue. If so, it may need to be loaded sooner, and the caller needs to wait for it
+    // unless it has already been loaded by another thread
+    HashMap<Pair<StringHash, StringHash>, BackgroundLoadItem>::Iterator i = backgroundLoadQueue_.Find(key);
+    if (i != backgroundLoadQueue_.End())
+    {
+        BackgroundLoadItem& item = i->second_;
+        item.cancelled_ = false;
+        PromoteItem(key, item, priority);
+        
+        AsyncLoadState state = item.resource_->GetAsyncLoadState();
+        if (j != backgroundLoadQueue_.End() && (state == ASYNC_QUEUED || state == ASYNC_LOADING))
+        {
+            item.dependents_.Insert(j->first_);
+            j->second_.dependencies_.Insert(key);
+        }
         return false;
+    }
     
     BackgroundLoadItem& item = backgroundLoadQueue_[key];
     item.sendEventOnFailure_ = sendEventOnFailure;
+    item.priority_ = priority;
     
     // Make sure the pointer is non-null and is a Resource subclass
     item.resource_ = DynamicCast<Resource>(owner_->GetContext()->CreateObject(type));
@@ -139,28 +202,34 @@ bool BackgroundLoader::QueueResource(StringHash type, const String& name, bool s
     item.resource_->SetName(name);
     item.resource_->SetAsyncLoadState(ASYNC_QUEUED);
     
-    // If this is a resource calling for the background load of more resources, mark the dependency as necessary
-    if (caller)
+    if (j != backgroundLoadQueue_.End())
     {
-        Pair<StringHash, StringHash> callerKey = MakePair(caller->GetType(), caller->GetNameHash());
-        HashMap<Pair<StringHash, StringHash>, BackgroundLoadItem>::Iterator j = backgroundLoadQueue_.Find(callerKey);
-        if (j != backgroundLoadQueue_.End())
-        {
-            BackgroundLoadItem& callerItem = j->second_;
-            item.dependents_.Insert(callerKey);
-            callerItem.dependencies_.Insert(key);
-        }
-        else
-            LOGWARNING("Resource " + caller->GetName() + " requested for a background loaded resource but was not in the background load queue");
+        item.dependents_.Insert(j->first_);
+        j->second_.dependencies_.Insert(key);
     }
     
-    // Start the background loader thread now
-    if (!IsStarted())
-        Run();
+    lanes_[priority].Push(key);
+    
+    // Start more loader threads now if necessary, and wake up a waiting one
+    StartThreads();
+    queueCondition_.Set();
     
     return true;
 }
 
+bool BackgroundLoader::CancelResource(StringHash type, StringHash nameHash)
+{
+    MutexLock lock(backgroundLoadMutex_);
+    
+    HashMap<Pair<StringHash, StringHash>, BackgroundLoadItem>::Iterator i = backgroundLoadQueue_.Find(MakePair(type, nameHash));
+    // Can not cancel if another resource is waiting for this one
+    if (i == backgroundLoadQueue_.End() || i->second_.dependents_.Size())
+        return false;
+    
+    CancelItem(i);
+    return true;
+}
+
 void BackgroundLoader::WaitForResource(StringHash type, StringHash nameHash)
 {
     backgroundLoadMutex_.Acquire();
@@ -170,6 +239,9 @@ void BackgroundLoader::WaitForResource(StringHash type, StringHash nameHash)
     HashMap<Pair<StringHash, StringHash>, BackgroundLoadItem>::Iterator i = backgroundLoadQueue_.Find(key);
     if (i != backgroundLoadQueue_.End())
     {
+        // The resource is needed now, so make sure it and its dependencies are loaded first
+        i->second_.cancelled_ = false;
+        PromoteItem(key, i->second_, LOAD_PRIORITY_IMMEDIATE);
         backgroundLoadMutex_.Release();
         
         {
@@ -179,7 +251,10 @@ void BackgroundLoader::WaitForResource(StringHash type, StringHash nameHash)
             
             for (;;)
             {
+                // The loader threads erase finished dependencies, so read them with the mutex held
+                backgroundLoadMutex_.Acquire();
                 unsigned numDeps = i->second_.dependencies_.Size();
+                backgroundLoadMutex_.Release();
                 AsyncLoadState state = resource->GetAsyncLoadState();
                 if (numDeps > 0 || state == ASYNC_QUEUED || state == ASYNC_LOADING)
                 {
@@ -207,43 +282,162 @@ void BackgroundLoader::WaitForResource(StringHash type, StringHash nameHash)
 
 void BackgroundLoader::FinishResources(int maxMs)
 {
-    if (IsStarted())
+    HiresTimer timer;
+
+    backgroundLoadMutex_.Acquire();
+    
+    for (HashMap<Pair<StringHash, StringHash>, BackgroundLoadItem>::Iterator i = backgroundLoadQueue_.Begin();
+        i != backgroundLoadQueue_.End();)
     {
-        HiresTimer timer;
+        Resource* resource = i->second_.resource_;
+        unsigned numDeps = i->second_.dependencies_.Size();
+        AsyncLoadState state = resource->GetAsyncLoadState();
+        if (numDeps > 0 || state == ASYNC_QUEUED || state == ASYNC_LOADING)
+            ++i;
+        else if (i->second_.cancelled_)
+        {
+            // Discard the result of a resource that was cancelled during loading
+            resource->SetAsyncLoadState(ASYNC_DONE);
+            i = backgroundLoadQueue_.Erase(i);
+        }
+        else
+        {
+            // Finishing a resource may need it to wait for other resources to load, in which case we can not
+            // hold on to the mutex
+            backgroundLoadMutex_.Release();
+            FinishBackgroundLoading(i->second_);
+            backgroundLoadMutex_.Acquire();
+            i = backgroundLoadQueue_.Erase(i);
+        }
+        
+        // Break when the time limit passed so that we keep sufficient FPS
+        if (timer.GetUSec(false) >= maxMs * 1000)
+            break;
+    }
+    
+    backgroundLoadMutex_.Release();
+}
 
-        backgroundLoadMutex_.Acquire();
+unsigned BackgroundLoader::GetNumQueuedResources() const
+{
+    MutexLock lock(backgroundLoadMutex_);
+    return backgroundLoadQueue_.Size();
+}
+
+BackgroundLoadItem* BackgroundLoader::TakeItem()
+{
+    for (unsigned i = 0; i < MAX_LOAD_PRIORITIES; ++i)
+    {
+        List<Pair<StringHash, StringHash> >& lane = lanes_[i];
         
-        for (HashMap<Pair<StringHash, StringHash>, BackgroundLoadItem>::Iterator i = backgroundLoadQueue_.Begin();
-            i != backgroundLoadQueue_.End();)
+        while (!lane.Empty())
         {
-            Resource* resource = i->second_.resource_;
-            unsigned numDeps = i->second_.dependencies_.Size();
-            AsyncLoadState state = resource->GetAsyncLoadState();
-            if (numDeps > 0 || state == ASYNC_QUEUED || state == ASYNC_LOADING)
-                ++i;
-            else
+            HashMap<Pair<StringHash, StringHash>, BackgroundLoadItem>::Iterator j = backgroundLoadQueue_.Find(lane.Front());
+            lane.PopFront();
+            
+            // Skip keys of resources that have been cancelled, taken by another thread or moved to another lane
+            if (j != backgroundLoadQueue_.End() && j->second_.priority_ == i &&
+                j->second_.resource_->GetAsyncLoadState() == ASYNC_QUEUED)
             {
-                // Finishing a resource may need it to wait for other resources to load, in which case we can not
-                // hold on to the mutex
-                backgroundLoadMutex_.Release();
-                FinishBackgroundLoading(i->second_);
-                backgroundLoadMutex_.Acquire();
-                i = backgroundLoadQueue_.Erase(i);
+                j->second_.resource_->SetAsyncLoadState(ASYNC_LOADING);
+                return &j->second_;
             }
-            
-            // Break when the time limit passed so that we keep sufficient FPS
-            if (timer.GetUSec(false) >= maxMs * 1000)
-                break;
         }
+    }
+    
+    return 0;
+}
+
+void BackgroundLoader::SignalQueuedItems()
+{
+    // The lanes may also contain stale keys, which only cause a thread to wake up without finding anything to load
+    for (unsigned i = 0; i < MAX_LOAD_PRIORITIES; ++i)
+    {
+        if (!lanes_[i].Empty())
+        {
+            queueCondition_.Set();
+            return;
+        }
+    }
+}
+
+void BackgroundLoader::PromoteItem(const Pair<StringHash, StringHash>& key, BackgroundLoadItem& item, ResourceLoadPriority priority)
+{
+    if (priority >= item.priority_)
+        return;
+    
+    item.priority_ = priority;
+    if (item.resource_->GetAsyncLoadState() == ASYNC_QUEUED)
+    {
+        lanes_[priority].Push(key);
+        queueCondition_.Set();
+    }
+    
+    for (HashSet<Pair<StringHash, StringHash> >::Iterator i = item.dependencies_.Begin(); i != item.dependencies_.End(); ++i)
+    {
+        HashMap<Pair<StringHash, StringHash>, BackgroundLoadItem>::Iterator j = backgroundLoadQueue_.Find(*i);
+        if (j != backgroundLoadQueue_.End())
+            PromoteItem(j->first_, j->second_, priority);
+    }
+}
+
+void BackgroundLoader::CancelItem(HashMap<Pair<StringHash, StringHash>, BackgroundLoadItem>::Iterator i)
+{
+    BackgroundLoadItem& item = i->second_;
+    bool queued = item.resource_->GetAsyncLoadState() == ASYNC_QUEUED;
+    // A resource that has not started loading can be removed right away. Otherwise the loader thread still refers to it,
+    // so let FinishResources() discard it
+    if (queued)
+        item.resource_->SetAsyncLoadState(ASYNC_DONE);
+    else
+        item.cancelled_ = true;
+    
+    // Also cancel dependencies that no other resource is waiting for, and which have not started loading yet
+    for (HashSet<Pair<StringHash, StringHash> >::Iterator j = item.dependencies_.Begin(); j != item.dependencies_.End(); ++j)
+    {
+        HashMap<Pair<StringHash, StringHash>, BackgroundLoadItem>::Iterator k = backgroundLoadQueue_.Find(*j);
+        if (k == backgroundLoadQueue_.End())
+            continue;
         
-        backgroundLoadMutex_.Release();
+        k->second_.dependents_.Erase(i->first_);
+        if (k->second_.dependents_.Empty() && k->second_.resource_->GetAsyncLoadState() == ASYNC_QUEUED)
+            CancelItem(k);
     }
+    item.dependencies_.Clear();
+    
+    LOGDEBUG("Cancelled background loading of resource " + item.resource_->GetName());
+    
+    if (queued)
+        backgroundLoadQueue_.Erase(i);
 }
 
-unsigned BackgroundLoader::GetNumQueuedResources() const
+void BackgroundLoader::StartThreads()
 {
-    MutexLock lock(backgroundLoadMutex_);
-    return backgroundLoadQueue_.Size();
+    while (threads_.Size() < numThreads_ && threads_.Size() < backgroundLoadQueue_.Size())
+    {
+        SharedPtr<BackgroundLoaderThread> thread(new BackgroundLoaderThread(this));
+        if (!thread->Run())
+            break;
+        threads_.Push(thread);
+    }
+}
+
+void BackgroundLoader::StopThreads()
+{
+    // Threads may need the mutex to finish their current resource, so do not hold it while waiting for them
+    backgroundLoadMutex_.Acquire();
+    Vector<SharedPtr<BackgroundLoaderThread> > threads = threads_;
+    threads_.Clear();
+    backgroundLoadMutex_.Release();
+    
+    // Request all threads to stop before waking them up. Each stopping thread wakes up the next
+    for (unsigned i = 0; i < threads.Size(); ++i)
+        threads[i]->RequestStop();
+    if (threads.Size())
+        queueCondition_.Set();
+    
+    for (unsigned i = 0; i < threads.Size(); ++i)
+        threads[i]->Stop();
 }
 
 void BackgroundLoader::FinishBackgroundLoading(BackgroundLoadItem& item)
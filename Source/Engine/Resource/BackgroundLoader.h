@@ -22,63 +22,107 @@
 
 #pragma once
 
+#include "Condition.h"
 #include "HashMap.h"
 #include "HashSet.h"
+#include "List.h"
 #include "Mutex.h"
 #include "Ptr.h"
 #include "RefCounted.h"
+#include "Resource.h"
 #include "StringHash.h"
 #include "Thread.h"
 
 namespace Urho3D
 {
 
-class Resource;
+class BackgroundLoaderThread;
 class ResourceCache;
 
 /// Queue item for background loading of a resource.
 struct BackgroundLoadItem
 {
+    /// Construct.
+    BackgroundLoadItem() :
+        priority_(LOAD_PRIORITY_IMMEDIATE),
+        sendEventOnFailure_(true),
+        cancelled_(false)
+    {
+    }
+    
     /// Resource.
     SharedPtr<Resource> resource_;
     /// Resources depended on for loading.
     HashSet<Pair<StringHash, StringHash> > dependencies_;
     /// Resources that depend on this resource's loading.
     HashSet<Pair<StringHash, StringHash> > dependents_;
+    /// Priority lane.
+    ResourceLoadPriority priority_;
     /// Whether to send failure event.
     bool sendEventOnFailure_;
+    /// Whether was cancelled while already loading. The result will be discarded.
+    bool cancelled_;
 };
 
-/// Background loader of resources. Owned by the ResourceCache.
-class BackgroundLoader : public RefCounted, public Thread
+/// Background loader of resources using a pool of loader threads. Owned by the ResourceCache.
+class BackgroundLoader : public RefCounted
 {
+    friend class BackgroundLoaderThread;
+    
 public:
     /// Construct.
     BackgroundLoader(ResourceCache* owner);
+    /// Destruct. Stop the loader threads.
+    ~BackgroundLoader();
     
-    /// Resource background loading loop.
-    virtual void ThreadFunction();
-    
-    /// Queue loading of a resource. The name must be sanitated to ensure consistent format. Return true if queued (not a duplicate and resource was a known type).
-    bool QueueResource(StringHash type, const String& name, bool sendEventOnFailure, Resource* caller);
+    /// Set maximum number of loader threads. Threads that are running finish their current resource first.
+    void SetNumThreads(unsigned num);
+    /// Queue loading of a resource. The name must be sanitated to ensure consistent format. Return true if queued (not a duplicate and resource was a known type). A duplicate is moved to a more urgent priority lane if necessary.
+    bool QueueResource(StringHash type, const String& name, bool sendEventOnFailure, Resource* caller, ResourceLoadPriority priority);
+    /// Cancel loading of a resource. Return true if cancelled, false if not queued or another queued resource depends on it.
+    bool CancelResource(StringHash type, StringHash nameHash);
     /// Wait and finish possible loading of a resource when being requested from the cache.
     void WaitForResource(StringHash type, StringHash nameHash);
     /// Process resources that are ready to finish.
     void FinishResources(int maxMs);
     
+    /// Return maximum number of loader threads.
+    unsigned GetNumThreads() const { return numThreads_; }
     /// Return amount of resources in the load queue.
     unsigned GetNumQueuedResources() const;
     
 private:
+    /// Load one queued resource in a loader thread. Return false if there was nothing to load.
+    bool ProcessItem();
+    /// Take the most urgent queued resource and mark it loading. Return null if none. Called with the mutex held.
+    BackgroundLoadItem* TakeItem();
+    /// Wake up a loader thread if resources are waiting in the priority lanes. Called with the mutex held.
+    void SignalQueuedItems();
+    /// Move a queued resource and its dependencies to a more urgent priority lane. Called with the mutex held.
+    void PromoteItem(const Pair<StringHash, StringHash>& key, BackgroundLoadItem& item, ResourceLoadPriority priority);
+    /// Cancel a queued resource and the dependencies only it needs. Called with the mutex held.
+    void CancelItem(HashMap<Pair<StringHash, StringHash>, BackgroundLoadItem>::Iterator i);
+    /// Start loader threads as needed for the queued resources. Called with the mutex held.
+    void StartThreads();
+    /// Stop all loader threads.
+    void StopThreads();
     /// Finish one background loaded resource.
     void FinishBackgroundLoading(BackgroundLoadItem& item);
     
     /// Resource cache.
     ResourceCache* owner_;
+    /// Loader threads.
+    Vector<SharedPtr<BackgroundLoaderThread> > threads_;
+    /// Maximum number of loader threads.
+    unsigned numThreads_;
     /// Mutex for thread-safe access to the background load queue.
     mutable Mutex backgroundLoadMutex_;
+    /// Condition for waking up a loader thread when resources are queued or promoted.
+    Condition queueCondition_;
     /// Resources that are queued for background loading.
     HashMap<Pair<StringHash, StringHash>, BackgroundLoadItem> backgroundLoadQueue_;
+    /// Keys of queued resources in each priority lane. May contain stale keys of promoted, cancelled or taken resources, which are skipped.
+    List<Pair<StringHash, StringHash> > lanes_[MAX_LOAD_PRIORITIES];
 };
 
 }
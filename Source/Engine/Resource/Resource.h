@@ -1,130 +1,168 @@
-//
-// Copyright (c) 2008-2014 the Urho3D project.
-//
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-//
-// The above copyright notice and this permission notice shall be included in
-// all copies or substantial portions of the Software.
-//
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
-// THE SOFTWARE.
-//
-
-#pragma once
-
-#include "Object.h"
-#include "Timer.h"
-
-namespace Urho3D
-{
-
-class Deserializer;
-class Serializer;
-
-/// Asynchronous loading state of a resource.
-enum AsyncLoadState
-{
-    /// No async operation in progress.
-    ASYNC_DONE = 0,
-    /// Queued for asynchronous loading.
-    ASYNC_QUEUED = 1,
-    /// In progress of calling BeginLoad() in a worker thread.
-    ASYNC_LOADING = 2,
-    /// BeginLoad() succeeded. EndLoad() can be called in the main thread.
-    ASYNC_SUCCESS = 3,
-    /// BeginLoad() failed.
-    ASYNC_FAIL = 4
-};
-
-/// Base class for resources.
-class URHO3D_API Resource : public Object
-{
-    OBJECT(Resource);
-    BASEOBJECT(Resource);
-    
-public:
-    /// Construct.
-    Resource(Context* context);
-    
-    /// Load resource synchronously. Call both BeginLoad() & EndLoad() and return true if both succeeded.
-    bool Load(Deserializer& source);
-    /// Load resource from stream. May be called from a worker thread. Return true if successful.
-    virtual bool BeginLoad(Deserializer& source);
-    /// Finish resource loading. Always called from the main thread. Return true if successful.
-    virtual bool EndLoad();
-    /// Save resource. Return true if successful.
-    virtual bool Save(Serializer& dest) const;
-    
-    /// Set name.
-    void SetName(const String& name);
-    /// Set memory use in bytes, possibly approximate.
-    void SetMemoryUse(unsigned size);
-    /// Reset last used timer.
-    void ResetUseTimer();
-    /// Set the asynchronous loading state. Called by ResourceCache. Resources in the middle of asynchronous loading are not normally returned to user.
-    void SetAsyncLoadState(AsyncLoadState newState);
-    
-    /// Return name.
-    const String& GetName() const { return name_; }
-    /// Return name hash.
-    StringHash GetNameHash() const { return nameHash_; }
-    /// Return memory use in bytes, possibly approximate.
-    unsigned GetMemoryUse() const { return memoryUse_; }
-    /// Return time since last use in milliseconds. If referred to elsewhere than in the resource cache, returns always zero.
-    unsigned GetUseTimer();
-    /// Return the asynchronous loading state.
-    AsyncLoadState GetAsyncLoadState() const { return asyncLoadState_; }
-    
-private:
-    /// Name.
-    String name_;
-    /// Name hash.
-    StringHash nameHash_;
-    /// Last used timer.
-    Timer useTimer_;
-    /// Memory use in bytes.
-    unsigned memoryUse_;
-    /// Asynchronous loading state.
-    AsyncLoadState asyncLoadState_;
-};
-
-inline const String& GetResourceName(Resource* resource)
-{
-    return resource ? resource->GetName() : String::EMPTY;
-}
-
-inline StringHash GetResourceType(Resource* resource, StringHash defaultType)
-{
-    return resource ? resource->GetType() : defaultType;
-}
-
-inline ResourceRef GetResourceRef(Resource* resource, StringHash defaultType)
-{
-    return ResourceRef(GetResourceType(resource, defaultType), GetResourceName(resource));
-}
-
-template <class T> Vector<String> GetResourceNames(const Vector<SharedPtr<T> >& resources)
-{
-    Vector<String> ret(resources.Size());
-    for (unsigned i = 0; i < resources.Size(); ++i)
-        ret[i] = GetResourceName(resources[i]);
-    
-    return ret;
-}
-
-template <class T> ResourceRefList GetResourceRefList(const Vector<SharedPtr<T> >& resources)
-{
-    return ResourceRefList(T::GetTypeStatic(), GetResourceNames(resources));
-}
-
-}
+//
+// Copyright (c) 2008-2014 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#pragma once
+
+#include "Object.h"
+#include "Timer.h"
+
+namespace Urho3D
+{
+
+class Deserializer;
+class Resource;
+class Serializer;
+struct ResourceGroup;
+
+/// Asynchronous loading state of a resource.
+enum AsyncLoadState
+{
+    /// No async operation in progress.
+    ASYNC_DONE = 0,
+    /// Queued for asynchronous loading.
+    ASYNC_QUEUED = 1,
+    /// In progress of calling BeginLoad() in a worker thread.
+    ASYNC_LOADING = 2,
+    /// BeginLoad() succeeded. EndLoad() can be called in the main thread.
+    ASYNC_SUCCESS = 3,
+    /// BeginLoad() failed.
+    ASYNC_FAIL = 4
+};
+
+/// Background loading priority lane of a resource.
+enum ResourceLoadPriority
+{
+    /// Needed as soon as possible, for example for currently visible objects.
+    LOAD_PRIORITY_IMMEDIATE = 0,
+    /// Likely to be needed soon, for example for the next streamed area.
+    LOAD_PRIORITY_PREFETCH,
+    /// Loaded only when no more urgent resources are queued.
+    LOAD_PRIORITY_IDLE,
+    MAX_LOAD_PRIORITIES
+};
+
+/// Links of a resource in a least recently used list of the resource cache.
+struct ResourceLRULink
+{
+    /// Construct unlinked.
+    ResourceLRULink() :
+        prev_(0),
+        next_(0)
+    {
+    }
+    
+    /// More recently used resource.
+    Resource* prev_;
+    /// Less recently used resource.
+    Resource* next_;
+};
+
+/// Base class for resources.
+class URHO3D_API Resource : public Object
+{
+    OBJECT(Resource);
+    BASEOBJECT(Resource);
+    
+    friend class ResourceCache;
+    
+public:
+    /// Construct.
+    Resource(Context* context);
+    
+    /// Load resource synchronously. Call both BeginLoad() & EndLoad() and return true if both succeeded.
+    bool Load(Deserializer& source);
+    /// Load resource from stream. May be called from a worker thread. Return true if successful.
+    virtual bool BeginLoad(Deserializer& source);
+    /// Finish resource loading. Always called from the main thread. Return true if successful.
+    virtual bool EndLoad();
+    /// Save resource. Return true if successful.
+    virtual bool Save(Serializer& dest) const;
+    
+    /// Set name.
+    void SetName(const String& name);
+    /// Set memory use in bytes, possibly approximate. If the resource is stored in the resource cache, must be called from the main thread.
+    void SetMemoryUse(unsigned size);
+    /// Reset last used timer.
+    void ResetUseTimer();
+    /// Set the asynchronous loading state. Called by ResourceCache. Resources in the middle of asynchronous loading are not normally returned to user.
+    void SetAsyncLoadState(AsyncLoadState newState);
+    
+    /// Return name.
+    const String& GetName() const { return name_; }
+    /// Return name hash.
+    StringHash GetNameHash() const { return nameHash_; }
+    /// Return memory use in bytes, possibly approximate.
+    unsigned GetMemoryUse() const { return memoryUse_; }
+    /// Return time since last use in milliseconds. If referred to elsewhere than in the resource cache, returns always zero.
+    unsigned GetUseTimer();
+    /// Return the asynchronous loading state.
+    AsyncLoadState GetAsyncLoadState() const { return asyncLoadState_; }
+    
+private:
+    /// Name.
+    String name_;
+    /// Name hash.
+    StringHash nameHash_;
+    /// Last used timer.
+    Timer useTimer_;
+    /// Memory use in bytes.
+    unsigned memoryUse_;
+    /// Asynchronous loading state.
+    AsyncLoadState asyncLoadState_;
+    /// Resource cache group that accounts for the memory use, or null if not stored in the resource cache.
+    ResourceGroup* group_;
+    /// Link in the least recently used list of the resource type.
+    ResourceLRULink typeLink_;
+    /// Link in the least recently used list of all resources.
+    ResourceLRULink globalLink_;
+};
+
+inline const String& GetResourceName(Resource* resource)
+{
+    return resource ? resource->GetName() : String::EMPTY;
+}
+
+inline StringHash GetResourceType(Resource* resource, StringHash defaultType)
+{
+    return resource ? resource->GetType() : defaultType;
+}
+
+inline ResourceRef GetResourceRef(Resource* resource, StringHash defaultType)
+{
+    return ResourceRef(GetResourceType(resource, defaultType), GetResourceName(resource));
+}
+
+template <class T> Vector<String> GetResourceNames(const Vector<SharedPtr<T> >& resources)
+{
+    Vector<String> ret(resources.Size());
+    for (unsigned i = 0; i < resources.Size(); ++i)
+        ret[i] = GetResourceName(resources[i]);
+    
+    return ret;
+}
+
+template <class T> ResourceRefList GetResourceRefList(const Vector<SharedPtr<T> >& resources)
+{
+    return ResourceRefList(T::GetTypeStatic(), GetResourceNames(resources));
+}
+
+}
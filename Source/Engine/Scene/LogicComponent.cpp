@@ -37,12 +37,15 @@ LogicComponent::LogicComponent(Context* context) :
     Component(context),
     updateEventMask_(USE_UPDATE | USE_POSTUPDATE | USE_FIXEDUPDATE | USE_FIXEDPOSTUPDATE),
     currentEventMask_(0),
-    delayedStartCalled_(false)
+    currentThreadedMask_(0),
+    delayedStartCalled_(false),
+    threadedUpdate_(false)
 {
 }
 
 LogicComponent::~LogicComponent()
 {
+    RemoveThreadedUpdates();
 }
 
 void LogicComponent::OnSetEnabled()
@@ -59,6 +62,15 @@ void LogicComponent::SetUpdateEventMask(unsigned char mask)
     }
 }
 
+void LogicComponent::SetThreadedUpdate(bool enable)
+{
+    if (threadedUpdate_ != enable)
+    {
+        threadedUpdate_ = enable;
+        UpdateEventSubscription();
+    }
+}
+
 void LogicComponent::OnNodeSet(Node* node)
 {
     if (node)
@@ -72,6 +84,7 @@ void LogicComponent::OnNodeSet(Node* node)
     {
         // We are being detached from a node: execute user-defined stop function and prepare for destruction
         Stop();
+        RemoveThreadedUpdates();
     }
 }
 
@@ -89,30 +102,60 @@ void LogicComponent::UpdateEventSubscription()
     }
     
     bool enabled = IsEnabledEffective();
+    // Threadsafe updates are called by the scene in worker threads. The delayed start is always called from the update event
+    bool threaded = threadedUpdate_ && delayedStartCalled_;
     
     bool needUpdate = enabled && ((updateEventMask_ & USE_UPDATE) || !delayedStartCalled_);
-    if (needUpdate && !(currentEventMask_ & USE_UPDATE))
+    bool needUpdateEvent = needUpdate && !threaded;
+    if (needUpdateEvent && !(currentEventMask_ & USE_UPDATE))
     {
-        SubscribeToEvent(scene, E_SCENEUPDATE, HANDLER(LogicComponent, HandleSceneUpdate));
+        SubscribeToEvent(scene, E_SCENEUPDATE, TYPED_HANDLER(LogicComponent, HandleSceneUpdate));
         currentEventMask_ |= USE_UPDATE;
     }
-    else if (!needUpdate && (currentEventMask_ & USE_UPDATE))
+    else if (!needUpdateEvent && (currentEventMask_ & USE_UPDATE))
     {
         UnsubscribeFromEvent(scene, E_SCENEUPDATE);
         currentEventMask_ &= ~USE_UPDATE;
     }
     
+    bool needThreadedUpdate = needUpdate && threaded;
+    if (needThreadedUpdate && !(currentThreadedMask_ & USE_UPDATE))
+    {
+        scene->AddThreadedLogic(this, false);
+        threadedScene_ = scene;
+        currentThreadedMask_ |= USE_UPDATE;
+    }
+    else if (!needThreadedUpdate && (currentThreadedMask_ & USE_UPDATE))
+    {
+        scene->RemoveThreadedLogic(this, false);
+        currentThreadedMask_ &= ~USE_UPDATE;
+    }
+    
     bool needPostUpdate = enabled && (updateEventMask_ & USE_POSTUPDATE);
-    if (needPostUpdate && !(currentEventMask_ & USE_POSTUPDATE))
+    bool needPostUpdateEvent = needPostUpdate && !threaded;
+    if (needPostUpdateEvent && !(currentEventMask_ & USE_POSTUPDATE))
     {
-        SubscribeToEvent(scene, E_SCENEPOSTUPDATE, HANDLER(LogicComponent, HandleScenePostUpdate));
+        SubscribeToEvent(scene, E_SCENEPOSTUPDATE, TYPED_HANDLER(LogicComponent, HandleScenePostUpdate));
         currentEventMask_ |= USE_POSTUPDATE;
     }
-    else if (!needUpdate && (currentEventMask_ & USE_POSTUPDATE))
+    else if (!needPostUpdateEvent && (currentEventMask_ & USE_POSTUPDATE))
     {
         UnsubscribeFromEvent(scene, E_SCENEPOSTUPDATE);
         currentEventMask_ &= ~USE_POSTUPDATE;
     }
+    
+    bool needThreadedPostUpdate = needPostUpdate && threaded;
+    if (needThreadedPostUpdate && !(currentThreadedMask_ & USE_POSTUPDATE))
+    {
+        scene->AddThreadedLogic(this, true);
+        threadedScene_ = scene;
+        currentThreadedMask_ |= USE_POSTUPDATE;
+    }
+    else if (!needThreadedPostUpdate && (currentThreadedMask_ & USE_POSTUPDATE))
+    {
+        scene->RemoveThreadedLogic(this, true);
+        currentThreadedMask_ &= ~USE_POSTUPDATE;
+    }
 
 #ifdef URHO3D_PHYSICS
     PhysicsWorld* world = scene->GetComponent<PhysicsWorld>();
@@ -122,7 +165,7 @@ void LogicComponent::UpdateEventSubscription()
     bool needFixedUpdate = enabled && (updateEventMask_ & USE_FIXEDUPDATE);
     if (needFixedUpdate && !(currentEventMask_ & USE_FIXEDUPDATE))
     {
-        SubscribeToEvent(world, E_PHYSICSPRESTEP, HANDLER(LogicComponent, HandlePhysicsPreStep));
+        SubscribeToEvent(world, E_PHYSICSPRESTEP, TYPED_HANDLER(LogicComponent, HandlePhysicsPreStep));
         currentEventMask_ |= USE_FIXEDUPDATE;
     }
     else if (!needFixedUpdate && (currentEventMask_ & USE_FIXEDUPDATE))
@@ -134,7 +177,7 @@ void LogicComponent::UpdateEventSubscription()
     bool needFixedPostUpdate = enabled && (updateEventMask_ & USE_FIXEDPOSTUPDATE);
     if (needFixedPostUpdate && !(currentEventMask_ & USE_FIXEDPOSTUPDATE))
     {
-        SubscribeToEvent(world, E_PHYSICSPOSTSTEP, HANDLER(LogicComponent, HandlePhysicsPostStep));
+        SubscribeToEvent(world, E_PHYSICSPOSTSTEP, TYPED_HANDLER(LogicComponent, HandlePhysicsPostStep));
         currentEventMask_ |= USE_FIXEDPOSTUPDATE;
     }
     else if (!needFixedPostUpdate && (currentEventMask_ & USE_FIXEDPOSTUPDATE))
@@ -145,52 +188,56 @@ void LogicComponent::UpdateEventSubscription()
 #endif 
 }
 
-void LogicComponent::HandleSceneUpdate(StringHash eventType, VariantMap& eventData)
+void LogicComponent::RemoveThreadedUpdates()
 {
-    using namespace SceneUpdate;
+    if (threadedScene_)
+    {
+        if (currentThreadedMask_ & USE_UPDATE)
+            threadedScene_->RemoveThreadedLogic(this, false);
+        if (currentThreadedMask_ & USE_POSTUPDATE)
+            threadedScene_->RemoveThreadedLogic(this, true);
+    }
     
+    threadedScene_.Reset();
+    currentThreadedMask_ = 0;
+}
+
+void LogicComponent::HandleSceneUpdate(StringHash eventType, SceneUpdate::Data& eventData)
+{
     // Execute user-defined delayed start function before first update
     if (!delayedStartCalled_)
     {
         DelayedStart();
         delayedStartCalled_ = true;
         
-        // If did not need actual update events, unsubscribe now
-        if (!(updateEventMask_ & USE_UPDATE))
-        {
-            UnsubscribeFromEvent(GetScene(), E_SCENEUPDATE);
-            currentEventMask_ &= ~USE_UPDATE;
+        // If did not need actual update events, unsubscribe now. If the update is threadsafe, it moves to the scene's
+        // threaded update, which will be executed after this event
+        UpdateEventSubscription();
+        if (!(currentEventMask_ & USE_UPDATE))
             return;
-        }
     }
     
     // Then execute user-defined update function
-    Update(eventData[P_TIMESTEP].GetFloat());
+    Update(eventData.timeStep_);
 }
 
-void LogicComponent::HandleScenePostUpdate(StringHash eventType, VariantMap& eventData)
+void LogicComponent::HandleScenePostUpdate(StringHash eventType, ScenePostUpdate::Data& eventData)
 {
-    using namespace ScenePostUpdate;
-    
     // Execute user-defined post-update function
-    PostUpdate(eventData[P_TIMESTEP].GetFloat());
+    PostUpdate(eventData.timeStep_);
 }
 
 #ifdef URHO3D_PHYSICS
-void LogicComponent::HandlePhysicsPreStep(StringHash eventType, VariantMap& eventData)
+void LogicComponent::HandlePhysicsPreStep(StringHash eventType, PhysicsPreStep::Data& eventData)
 {
-    using namespace PhysicsPreStep;
-    
     // Execute user-defined fixed update function
-    FixedUpdate(eventData[P_TIMESTEP].GetFloat());
+    FixedUpdate(eventData.timeStep_);
 }
 
-void LogicComponent::HandlePhysicsPostStep(StringHash eventType, VariantMap& eventData)
+void LogicComponent::HandlePhysicsPostStep(StringHash eventType, PhysicsPostStep::Data& eventData)
 {
-    using namespace PhysicsPostStep;
-    
     // Execute user-defined fixed post-update function
-    FixedPostUpdate(eventData[P_TIMESTEP].GetFloat());
+    FixedPostUpdate(eventData.timeStep_);
 }
 #endif
 
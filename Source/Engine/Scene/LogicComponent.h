@@ -23,6 +23,9 @@
 #pragma once
 
 #include "Component.h"
+#ifdef URHO3D_PHYSICS
+#include "PhysicsEvents.h"
+#endif
 
 namespace Urho3D
 {
@@ -65,11 +68,15 @@ class URHO3D_API LogicComponent : public Component
     
     /// Set what update events should be subscribed to. Use this for optimization: by default all are in use. Note that this is not an attribute and is not saved or network-serialized, therefore it should always be called eg. in the subclass constructor.
     void SetUpdateEventMask(unsigned char mask);
+    /// Set whether Update() and PostUpdate() are threadsafe and can be called in worker threads. They should then only modify the own scene node and its children, and not send events or create or remove scene objects. DelayedStart() and the physics updates are always called in the main thread. Not an attribute, like the update event mask.
+    void SetThreadedUpdate(bool enable);
     
     /// Return what update events are subscribed to.
     unsigned char GetUpdateEventMask() const { return updateEventMask_; }
     /// Return whether the DelayedStart() function has been called.
     bool IsDelayedStartCalled() const { return delayedStartCalled_; }
+    /// Return whether Update() and PostUpdate() can be called in worker threads.
+    bool GetThreadedUpdate() const { return threadedUpdate_; }
     
 protected:
     /// Handle scene node being assigned at creation.
@@ -78,22 +85,30 @@ protected:
 private:
     /// Subscribe/unsubscribe to update events based on current enabled state and update event mask.
     void UpdateEventSubscription();
+    /// Remove from the scene's threaded updates.
+    void RemoveThreadedUpdates();
     /// Handle scene update event.
-    void HandleSceneUpdate(StringHash eventType, VariantMap& eventData);
+    void HandleSceneUpdate(StringHash eventType, SceneUpdate::Data& eventData);
     /// Handle scene post-update event.
-    void HandleScenePostUpdate(StringHash eventType, VariantMap& eventData);
+    void HandleScenePostUpdate(StringHash eventType, ScenePostUpdate::Data& eventData);
 #ifdef URHO3D_PHYSICS
     /// Handle physics pre-step event.
-    void HandlePhysicsPreStep(StringHash eventType, VariantMap& eventData);
+    void HandlePhysicsPreStep(StringHash eventType, PhysicsPreStep::Data& eventData);
     /// Handle physics post-step event.
-    void HandlePhysicsPostStep(StringHash eventType, VariantMap& eventData);
+    void HandlePhysicsPostStep(StringHash eventType, PhysicsPostStep::Data& eventData);
 #endif
     /// Requested event subscription mask.
     unsigned char updateEventMask_;
     /// Current event subscription mask.
     unsigned char currentEventMask_;
+    /// Current threaded update mask.
+    unsigned char currentThreadedMask_;
+    /// Scene that calls the threaded updates.
+    WeakPtr<Scene> threadedScene_;
     /// Flag for delayed start.
     bool delayedStartCalled_;
+    /// Threaded update flag.
+    bool threadedUpdate_;
 };
 
 }
@@ -1,159 +1,224 @@
-//
-// Copyright (c) 2008-2014 the Urho3D project.
-//
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-//
-// The above copyright notice and this permission notice shall be included in
-// all copies or substantial portions of the Software.
-//
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
-// THE SOFTWARE.
-//
-
-#pragma once
-
-#include "Object.h"
-
-namespace Urho3D
-{
-
-/// Variable timestep scene update.
-EVENT(E_SCENEUPDATE, SceneUpdate)
-{
-    PARAM(P_SCENE, Scene);                  // Scene pointer
-    PARAM(P_TIMESTEP, TimeStep);            // float
-}
-
-/// Scene subsystem update.
-EVENT(E_SCENESUBSYSTEMUPDATE, SceneSubsystemUpdate)
-{
-    PARAM(P_SCENE, Scene);                  // Scene pointer
-    PARAM(P_TIMESTEP, TimeStep);            // float
-}
-
-/// Scene transform smoothing update.
-EVENT(E_UPDATESMOOTHING, UpdateSmoothing)
-{
-    PARAM(P_CONSTANT, Constant);            // float
-    PARAM(P_SQUAREDSNAPTHRESHOLD, SquaredSnapThreshold);  // float
-}
-
-/// Scene drawable update finished. Custom animation (eg. IK) can be done at this point.
-EVENT(E_SCENEDRAWABLEUPDATEFINISHED, SceneDrawableUpdateFinished)
-{
-    PARAM(P_SCENE, Scene);                  // Scene pointer
-    PARAM(P_TIMESTEP, TimeStep);            // float
-}
-
-/// SmoothedTransform target position changed.
-EVENT(E_TARGETPOSITION, TargetPositionChanged)
-{
-}
-
-/// SmoothedTransform target position changed.
-EVENT(E_TARGETROTATION, TargetRotationChanged)
-{
-}
-
-/// Scene attribute animation update.
-EVENT(E_ATTRIBUTEANIMATIONUPDATE, AttributeAnimationUpdate)
-{
-    PARAM(P_SCENE, Scene);                  // Scene pointer
-    PARAM(P_TIMESTEP, TimeStep);            // float
-}
-
-/// Variable timestep scene post-update.
-EVENT(E_SCENEPOSTUPDATE, ScenePostUpdate)
-{
-    PARAM(P_SCENE, Scene);                  // Scene pointer
-    PARAM(P_TIMESTEP, TimeStep);            // float
-}
-
-/// Asynchronous scene loading progress.
-EVENT(E_ASYNCLOADPROGRESS, AsyncLoadProgress)
-{
-    PARAM(P_SCENE, Scene);                  // Scene pointer
-    PARAM(P_PROGRESS, Progress);            // float
-    PARAM(P_LOADEDNODES, LoadedNodes);      // int
-    PARAM(P_TOTALNODES, TotalNodes);        // int
-    PARAM(P_LOADEDRESOURCES, LoadedResources); // int
-    PARAM(P_TOTALRESOURCES, TotalResources);   // int
-};
-
-/// Asynchronous scene loading finished.
-EVENT(E_ASYNCLOADFINISHED, AsyncLoadFinished)
-{
-    PARAM(P_SCENE, Scene);                  // Scene pointer
-};
-
-/// A child node has been added to a parent node.
-EVENT(E_NODEADDED, NodeAdded)
-{
-    PARAM(P_SCENE, Scene);                  // Scene pointer
-    PARAM(P_PARENT, Parent);                // Node pointer
-    PARAM(P_NODE, Node);                    // Node pointer
-}
-
-/// A child node is about to be removed from a parent node.
-EVENT(E_NODEREMOVED, NodeRemoved)
-{
-    PARAM(P_SCENE, Scene);                  // Scene pointer
-    PARAM(P_PARENT, Parent);                // Node pointer
-    PARAM(P_NODE, Node);                    // Node pointer
-}
-
-/// A component has been created to a node.
-EVENT(E_COMPONENTADDED, ComponentAdded)
-{
-    PARAM(P_SCENE, Scene);                  // Scene pointer
-    PARAM(P_NODE, Node);                    // Node pointer
-    PARAM(P_COMPONENT, Component);          // Component pointer
-}
-
-/// A component is about to be removed from a node.
-EVENT(E_COMPONENTREMOVED, ComponentRemoved)
-{
-    PARAM(P_SCENE, Scene);                  // Scene pointer
-    PARAM(P_NODE, Node);                    // Node pointer
-    PARAM(P_COMPONENT, Component);          // Component pointer
-}
-
-/// A node's name has changed.
-EVENT(E_NODENAMECHANGED, NodeNameChanged)
-{
-    PARAM(P_SCENE, Scene);                  // Scene pointer
-    PARAM(P_NODE, Node);                    // Node pointer
-}
-
-/// A node's enabled state has changed.
-EVENT(E_NODEENABLEDCHANGED, NodeEnabledChanged)
-{
-    PARAM(P_SCENE, Scene);                  // Scene pointer
-    PARAM(P_NODE, Node);                    // Node pointer
-}
-
-/// A component's enabled state has changed.
-EVENT(E_COMPONENTENABLEDCHANGED, ComponentEnabledChanged)
-{
-    PARAM(P_SCENE, Scene);                  // Scene pointer
-    PARAM(P_NODE, Node);                    // Node pointer
-    PARAM(P_COMPONENT, Component);          // Component pointer
-}
-
-/// A serializable's temporary state has changed.
-EVENT(E_TEMPORARYCHANGED, TemporaryChanged)
-{
-    PARAM(P_SERIALIZABLE, Serializable);    // Serializable pointer
-}
-
-}
+//
+// Copyright (c) 2008-2014 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#pragma once
+
+#include "Object.h"
+
+namespace Urho3D
+{
+
+class Scene;
+
+/// Variable timestep scene update.
+EVENT(E_SCENEUPDATE, SceneUpdate)
+{
+    PARAM(P_SCENE, Scene);                  // Scene pointer
+    PARAM(P_TIMESTEP, TimeStep);            // float
+    
+    /// Typed payload.
+    struct URHO3D_API Data : public TypedEventData
+    {
+        EVENTDATA(SceneUpdateData);
+        
+        /// Construct.
+        Data() :
+            scene_(0),
+            timeStep_(0.0f)
+        {
+        }
+        
+        /// Write the payload into an event parameter map.
+        virtual void ToVariantMap(VariantMap& dest) const;
+        /// Read the payload from an event parameter map.
+        virtual void FromVariantMap(const VariantMap& source);
+        
+        /// Scene.
+        Scene* scene_;
+        /// Timestep.
+        float timeStep_;
+    };
+}
+
+/// Scene subsystem update.
+EVENT(E_SCENESUBSYSTEMUPDATE, SceneSubsystemUpdate)
+{
+    PARAM(P_SCENE, Scene);                  // Scene pointer
+    PARAM(P_TIMESTEP, TimeStep);            // float
+    
+    typedef SceneUpdate::Data Data;
+}
+
+/// Scene transform smoothing update.
+EVENT(E_UPDATESMOOTHING, UpdateSmoothing)
+{
+    PARAM(P_CONSTANT, Constant);            // float
+    PARAM(P_SQUAREDSNAPTHRESHOLD, SquaredSnapThreshold);  // float
+    
+    /// Typed payload.
+    struct Data : public TypedEventData
+    {
+        EVENTDATA(UpdateSmoothingData);
+        
+        /// Construct.
+        Data() :
+            constant_(0.0f),
+            squaredSnapThreshold_(0.0f)
+        {
+        }
+        
+        /// Write the payload into an event parameter map.
+        virtual void ToVariantMap(VariantMap& dest) const
+        {
+            dest[P_CONSTANT] = constant_;
+            dest[P_SQUAREDSNAPTHRESHOLD] = squaredSnapThreshold_;
+        }
+        
+        /// Read the payload from an event parameter map.
+        virtual void FromVariantMap(const VariantMap& source)
+        {
+            constant_ = GetParameter(source, P_CONSTANT).GetFloat();
+            squaredSnapThreshold_ = GetParameter(source, P_SQUAREDSNAPTHRESHOLD).GetFloat();
+        }
+        
+        /// Smoothing constant.
+        float constant_;
+        /// Squared snap threshold.
+        float squaredSnapThreshold_;
+    };
+}
+
+/// Scene drawable update finished. Custom animation (eg. IK) can be done at this point.
+EVENT(E_SCENEDRAWABLEUPDATEFINISHED, SceneDrawableUpdateFinished)
+{
+    PARAM(P_SCENE, Scene);                  // Scene pointer
+    PARAM(P_TIMESTEP, TimeStep);            // float
+    
+    typedef SceneUpdate::Data Data;
+}
+
+/// SmoothedTransform target position changed.
+EVENT(E_TARGETPOSITION, TargetPositionChanged)
+{
+}
+
+/// SmoothedTransform target position changed.
+EVENT(E_TARGETROTATION, TargetRotationChanged)
+{
+}
+
+/// Scene attribute animation update.
+EVENT(E_ATTRIBUTEANIMATIONUPDATE, AttributeAnimationUpdate)
+{
+    PARAM(P_SCENE, Scene);                  // Scene pointer
+    PARAM(P_TIMESTEP, TimeStep);            // float
+    
+    typedef SceneUpdate::Data Data;
+}
+
+/// Variable timestep scene post-update.
+EVENT(E_SCENEPOSTUPDATE, ScenePostUpdate)
+{
+    PARAM(P_SCENE, Scene);                  // Scene pointer
+    PARAM(P_TIMESTEP, TimeStep);            // float
+    
+    typedef SceneUpdate::Data Data;
+}
+
+/// Asynchronous scene loading progress.
+EVENT(E_ASYNCLOADPROGRESS, AsyncLoadProgress)
+{
+    PARAM(P_SCENE, Scene);                  // Scene pointer
+    PARAM(P_PROGRESS, Progress);            // float
+    PARAM(P_LOADEDNODES, LoadedNodes);      // int
+    PARAM(P_TOTALNODES, TotalNodes);        // int
+    PARAM(P_LOADEDRESOURCES, LoadedResources); // int
+    PARAM(P_TOTALRESOURCES, TotalResources);   // int
+};
+
+/// Asynchronous scene loading finished.
+EVENT(E_ASYNCLOADFINISHED, AsyncLoadFinished)
+{
+    PARAM(P_SCENE, Scene);                  // Scene pointer
+};
+
+/// A child node has been added to a parent node.
+EVENT(E_NODEADDED, NodeAdded)
+{
+    PARAM(P_SCENE, Scene);                  // Scene pointer
+    PARAM(P_PARENT, Parent);                // Node pointer
+    PARAM(P_NODE, Node);                    // Node pointer
+}
+
+/// A child node is about to be removed from a parent node.
+EVENT(E_NODEREMOVED, NodeRemoved)
+{
+    PARAM(P_SCENE, Scene);                  // Scene pointer
+    PARAM(P_PARENT, Parent);                // Node pointer
+    PARAM(P_NODE, Node);                    // Node pointer
+}
+
+/// A component has been created to a node.
+EVENT(E_COMPONENTADDED, ComponentAdded)
+{
+    PARAM(P_SCENE, Scene);                  // Scene pointer
+    PARAM(P_NODE, Node);                    // Node pointer
+    PARAM(P_COMPONENT, Component);          // Component pointer
+}
+
+/// A component is about to be removed from a node.
+EVENT(E_COMPONENTREMOVED, ComponentRemoved)
+{
+    PARAM(P_SCENE, Scene);                  // Scene pointer
+    PARAM(P_NODE, Node);                    // Node pointer
+    PARAM(P_COMPONENT, Component);          // Component pointer
+}
+
+/// A node's name has changed.
+EVENT(E_NODENAMECHANGED, NodeNameChanged)
+{
+    PARAM(P_SCENE, Scene);                  // Scene pointer
+    PARAM(P_NODE, Node);                    // Node pointer
+}
+
+/// A node's enabled state has changed.
+EVENT(E_NODEENABLEDCHANGED, NodeEnabledChanged)
+{
+    PARAM(P_SCENE, Scene);                  // Scene pointer
+    PARAM(P_NODE, Node);                    // Node pointer
+}
+
+/// A component's enabled state has changed.
+EVENT(E_COMPONENTENABLEDCHANGED, ComponentEnabledChanged)
+{
+    PARAM(P_SCENE, Scene);                  // Scene pointer
+    PARAM(P_NODE, Node);                    // Node pointer
+    PARAM(P_COMPONENT, Component);          // Component pointer
+}
+
+/// A serializable's temporary state has changed.
+EVENT(E_TEMPORARYCHANGED, TemporaryChanged)
+{
+    PARAM(P_SERIALIZABLE, Serializable);    // Serializable pointer
+}
+
+}
@@ -0,0 +1,248 @@
+//
+// Copyright (c) 2008-2014 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "Precompiled.h"
+#include "Component.h"
+#include "Context.h"
+#include "Deserializer.h"
+#include "Log.h"
+#include "Node.h"
+#include "SceneSchema.h"
+#include "Serializer.h"
+
+#include "DebugNew.h"
+
+namespace Urho3D
+{
+
+SceneSchema::SceneSchema()
+{
+}
+
+void SceneSchema::Clear()
+{
+    types_.Clear();
+    typeIndices_.Clear();
+}
+
+void SceneSchema::AddNode(const Node* node)
+{
+    if (!node || node->IsTemporary())
+        return;
+
+    AddObject(node);
+
+    const Vector<SharedPtr<Component> >& components = node->GetComponents();
+    for (unsigned i = 0; i < components.Size(); ++i)
+        AddObject(components[i]);
+
+    const Vector<SharedPtr<Node> >& children = node->GetChildren();
+    for (unsigned i = 0; i < children.Size(); ++i)
+        AddNode(children[i]);
+}
+
+bool SceneSchema::Load(Deserializer& source, Context* context)
+{
+    Clear();
+
+    // Each type takes at least 5 bytes and each attribute 2 bytes, which bounds the counts of corrupt data
+    unsigned numTypes = source.ReadVLE();
+    if (numTypes > (source.GetSize() - source.GetPosition()) / 5)
+    {
+        LOGERROR("Could not load scene schema from " + source.GetName() + ", corrupt type table");
+        return false;
+    }
+    types_.Resize(numTypes);
+
+    for (unsigned i = 0; i < numTypes; ++i)
+    {
+        AttributeSchema& schema = types_[i];
+        schema.type_ = source.ReadStringHash();
+        schema.attributes_ = context->GetAttributes(schema.type_);
+        schema.blockSize_ = 0;
+
+        unsigned numAttributes = source.ReadVLE();
+        if (numAttributes > (source.GetSize() - source.GetPosition()) / 2)
+        {
+            LOGERROR("Could not load scene schema from " + source.GetName() + ", corrupt type table");
+            Clear();
+            return false;
+        }
+        schema.schemaAttributes_.Resize(numAttributes);
+
+        for (unsigned j = 0; j < numAttributes; ++j)
+        {
+            SchemaAttribute& attr = schema.schemaAttributes_[j];
+            attr.name_ = source.ReadString();
+            attr.type_ = (VariantType)source.ReadUByte();
+
+            if (source.IsEof() || attr.type_ == VAR_NONE || attr.type_ >= MAX_VAR_TYPES)
+            {
+                LOGERROR("Could not load scene schema from " + source.GetName() + ", corrupt type table");
+                Clear();
+                return false;
+            }
+
+            unsigned fixedSize = GetFixedSize(attr.type_);
+            if (fixedSize)
+            {
+                attr.blockOffset_ = schema.blockSize_;
+                schema.blockSize_ += fixedSize;
+            }
+
+            // Match by name and type, so that attributes added, removed or reordered since saving are tolerated
+            if (schema.attributes_)
+            {
+                for (unsigned k = 0; k < schema.attributes_->Size(); ++k)
+                {
+                    const AttributeInfo& info = schema.attributes_->At(k);
+                    if ((info.mode_ & AM_FILE) && info.type_ == attr.type_ && info.name_ == attr.name_)
+                    {
+                        attr.index_ = k;
+                        break;
+                    }
+                }
+            }
+        }
+
+        typeIndices_[schema.type_] = i + 1;
+    }
+
+    return true;
+}
+
+bool SceneSchema::Save(Serializer& dest) const
+{
+    if (!dest.WriteVLE(types_.Size()))
+        return false;
+
+    for (unsigned i = 0; i < types_.Size(); ++i)
+    {
+        const AttributeSchema& schema = types_[i];
+        dest.WriteStringHash(schema.type_);
+        dest.WriteVLE(schema.schemaAttributes_.Size());
+
+        for (unsigned j = 0; j < schema.schemaAttributes_.Size(); ++j)
+        {
+            const SchemaAttribute& attr = schema.schemaAttributes_[j];
+            dest.WriteString(attr.name_);
+            if (!dest.WriteUByte((unsigned char)attr.type_))
+                return false;
+        }
+    }
+
+    return true;
+}
+
+unsigned SceneSchema::GetTypeIndex(const Serializable* object) const
+{
+    if (!object)
+        return 0;
+
+    HashMap<StringHash, unsigned>::ConstIterator i = typeIndices_.Find(object->GetType());
+    if (i == typeIndices_.End())
+        return 0;
+
+    // Objects with per-instance attribute lists, such as script instances, can not share the type's layout
+    const AttributeSchema& schema = types_[i->second_ - 1];
+    return schema.attributes_ && object->GetAttributes() == schema.attributes_ ? i->second_ : 0;
+}
+
+unsigned SceneSchema::GetFixedSize(VariantType type)
+{
+    switch (type)
+    {
+    case VAR_BOOL:
+        return sizeof(unsigned char);
+
+    case VAR_INT:
+    case VAR_FLOAT:
+        return 4;
+
+    case VAR_VECTOR2:
+    case VAR_INTVECTOR2:
+        return 8;
+
+    case VAR_VECTOR3:
+        return 12;
+
+    case VAR_VECTOR4:
+    case VAR_QUATERNION:
+    case VAR_COLOR:
+    case VAR_INTRECT:
+        return 16;
+
+    case VAR_MATRIX3:
+        return 36;
+
+    case VAR_MATRIX3X4:
+        return 48;
+
+    case VAR_MATRIX4:
+        return 64;
+
+    default:
+        return 0;
+    }
+}
+
+void SceneSchema::AddObject(const Serializable* object)
+{
+    if (!object || object->IsTemporary() || typeIndices_.Contains(object->GetType()))
+        return;
+
+    const Vector<AttributeInfo>* attributes = object->GetAttributes();
+    if (!attributes || attributes != object->GetContext()->GetAttributes(object->GetType()))
+        return;
+
+    types_.Resize(types_.Size() + 1);
+    AttributeSchema& schema = types_.Back();
+    schema.type_ = object->GetType();
+    schema.attributes_ = attributes;
+    schema.blockSize_ = 0;
+
+    for (unsigned i = 0; i < attributes->Size(); ++i)
+    {
+        const AttributeInfo& info = attributes->At(i);
+        if (!(info.mode_ & AM_FILE))
+            continue;
+
+        SchemaAttribute attr;
+        attr.name_ = info.name_;
+        attr.type_ = info.type_;
+        attr.index_ = i;
+
+        unsigned fixedSize = GetFixedSize(info.type_);
+        if (fixedSize)
+        {
+            attr.blockOffset_ = schema.blockSize_;
+            schema.blockSize_ += fixedSize;
+        }
+
+        schema.schemaAttributes_.Push(attr);
+    }
+
+    typeIndices_[schema.type_] = types_.Size();
+}
+
+}
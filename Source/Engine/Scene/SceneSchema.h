@@ -0,0 +1,115 @@
+//
+// Copyright (c) 2008-2014 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#pragma once
+
+#include "Attribute.h"
+#include "HashMap.h"
+
+namespace Urho3D
+{
+
+class Context;
+class Deserializer;
+class Node;
+class Serializable;
+class Serializer;
+
+/// Attribute stored in a schema-indexed binary scene.
+struct SchemaAttribute
+{
+    /// Construct.
+    SchemaAttribute() :
+        type_(VAR_NONE),
+        blockOffset_(M_MAX_UNSIGNED),
+        index_(M_MAX_UNSIGNED)
+    {
+    }
+
+    /// Name.
+    String name_;
+    /// Variant type.
+    VariantType type_;
+    /// Byte offset within the fixed-size block, or M_MAX_UNSIGNED if stored as variable-size data after the block.
+    unsigned blockOffset_;
+    /// Index of the matching attribute in the runtime attribute list, or M_MAX_UNSIGNED if none.
+    unsigned index_;
+};
+
+/// Attribute layout of one object type in a schema-indexed binary scene.
+struct AttributeSchema
+{
+    /// Construct.
+    AttributeSchema() :
+        attributes_(0),
+        blockSize_(0)
+    {
+    }
+
+    /// Object type.
+    StringHash type_;
+    /// Stored attributes in file order.
+    Vector<SchemaAttribute> schemaAttributes_;
+    /// Runtime attribute list the indices refer to, or null if the type has no registered attributes.
+    const Vector<AttributeInfo>* attributes_;
+    /// Size of the fixed-size attribute block.
+    unsigned blockSize_;
+};
+
+/// Attribute schema table of a schema-indexed binary scene. Each object type's attribute names and types are written once; the objects then store their fixed-size attributes as one contiguous block followed by the variable-size attributes.
+class URHO3D_API SceneSchema
+{
+public:
+    /// Construct empty.
+    SceneSchema();
+
+    /// Clear all types.
+    void Clear();
+    /// Add the types of a node, its components and its child nodes recursively for saving.
+    void AddNode(const Node* node);
+    /// Load the schema table and match it against the attributes registered to the context. Return true if successful.
+    bool Load(Deserializer& source, Context* context);
+    /// Save the schema table. Return true if successful.
+    bool Save(Serializer& dest) const;
+
+    /// Return the stored type index of an object, or 0 if it must be stored as plain attribute data.
+    unsigned GetTypeIndex(const Serializable* object) const;
+    /// Return type by stored index. Return null for index 0 or if out of range.
+    const AttributeSchema* GetType(unsigned index) const { return (index && index <= types_.Size()) ? &types_[index - 1] : 0; }
+    /// Return number of types.
+    unsigned GetNumTypes() const { return types_.Size(); }
+
+    /// Return the size of a variant type in the fixed-size block, or 0 if it is stored as variable-size data.
+    static unsigned GetFixedSize(VariantType type);
+
+private:
+    /// Add an object's type if it can be stored schema-indexed.
+    void AddObject(const Serializable* object);
+
+    /// Types.
+    Vector<AttributeSchema> types_;
+    /// Stored type indices by type hash.
+    HashMap<StringHash, unsigned> typeIndices_;
+};
+
+}
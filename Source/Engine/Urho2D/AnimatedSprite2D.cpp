@@ -96,7 +96,7 @@ void AnimatedSprite2D::OnSetEnabled()
     if (scene)
     {
         if (IsEnabledEffective())
-            SubscribeToEvent(scene, E_SCENEPOSTUPDATE, HANDLER(AnimatedSprite2D, HandleScenePostUpdate));
+            SubscribeToEvent(scene, E_SCENEPOSTUPDATE, TYPED_HANDLER(AnimatedSprite2D, HandleScenePostUpdate));
         else
             UnsubscribeFromEvent(scene, E_SCENEPOSTUPDATE);
     }
@@ -263,7 +263,7 @@ void AnimatedSprite2D::OnNodeSet(Node* node)
     {
         Scene* scene = GetScene();
         if (scene && IsEnabledEffective())
-            SubscribeToEvent(scene, E_SCENEPOSTUPDATE, HANDLER(AnimatedSprite2D, HandleScenePostUpdate));
+            SubscribeToEvent(scene, E_SCENEPOSTUPDATE, TYPED_HANDLER(AnimatedSprite2D, HandleScenePostUpdate));
     }
     else
     {
@@ -534,11 +534,9 @@ void AnimatedSprite2D::CalculateTimelineWorldTransform(unsigned index)
     }
 }
 
-void AnimatedSprite2D::HandleScenePostUpdate(StringHash eventType, VariantMap& eventData)
+void AnimatedSprite2D::HandleScenePostUpdate(StringHash eventType, ScenePostUpdate::Data& eventData)
 {
-    using namespace ScenePostUpdate;
-    float timeStep = eventData[P_TIMESTEP].GetFloat();
-    UpdateAnimation(timeStep);
+    UpdateAnimation(eventData.timeStep_);
 }
 
 }
@@ -124,7 +124,7 @@ protected:
     /// Calculate timeline world world transform.
     void CalculateTimelineWorldTransform(unsigned index);
     /// Handle scene post update.
-    void HandleScenePostUpdate(StringHash eventType, VariantMap& eventData);
+    void HandleScenePostUpdate(StringHash eventType, ScenePostUpdate::Data& eventData);
 
     /// Layer.
     int layer_;
@@ -42,6 +42,9 @@
 namespace Urho3D
 {
 
+/// Minimum drawables per work item in threaded visibility checking.
+static const unsigned DRAWABLES_PER_BATCH = 64;
+
 DrawableProxy2D::DrawableProxy2D(Context* context) :
     Drawable(context, DRAWABLE_PROXYGEOMETRY),
     indexBuffer_(new IndexBuffer(context_)),
@@ -200,21 +203,31 @@ void DrawableProxy2D::OnWorldBoundingBoxUpdate()
     worldBoundingBox_ = boundingBox_;
 }
 
-void CheckDrawableVisibility(const WorkItem* item, unsigned threadIndex)
+/// Functor for checking drawable visibility in worker threads.
+struct CheckDrawableVisibility
 {
-    DrawableProxy2D* proxy = reinterpret_cast<DrawableProxy2D*>(item->aux_);
-    Drawable2D** start = reinterpret_cast<Drawable2D**>(item->start_);
-    Drawable2D** end = reinterpret_cast<Drawable2D**>(item->end_);
-
-    while (start != end)
+    /// Construct.
+    CheckDrawableVisibility(DrawableProxy2D* proxy) :
+        proxy_(proxy)
     {
-        Drawable2D* drawable = *start++;
-        if (proxy->CheckVisibility(drawable) && drawable->GetUsedMaterial() && drawable->GetVertices().Size())
-            drawable->SetVisibility(true);
-        else
-            drawable->SetVisibility(false);
     }
-}
+    
+    /// Check a range of drawables.
+    void operator () (Drawable2D** start, Drawable2D** end, unsigned threadIndex) const
+    {
+        while (start != end)
+        {
+            Drawable2D* drawable = *start++;
+            if (proxy_->CheckVisibility(drawable) && drawable->GetUsedMaterial() && drawable->GetVertices().Size())
+                drawable->SetVisibility(true);
+            else
+                drawable->SetVisibility(false);
+        }
+    }
+    
+    /// Drawable proxy.
+    DrawableProxy2D* proxy_;
+};
 
 void DrawableProxy2D::HandleBeginViewUpdate(StringHash eventType, VariantMap& eventData)
 {
@@ -245,29 +258,7 @@ void DrawableProxy2D::HandleBeginViewUpdate(StringHash eventType, VariantMap& ev
         PROFILE(CheckDrawableVisibility);
 
         WorkQueue* queue = GetSubsystem<WorkQueue>();
-        int numWorkItems = queue->GetNumThreads() + 1; // Worker threads + main thread
-        int drawablesPerItem = drawables_.Size() / numWorkItems;
-        
-        PODVector<Drawable2D*>::Iterator start = drawables_.Begin();
-        for (int i = 0; i < numWorkItems; ++i)
-        {
-            SharedPtr<WorkItem> item = queue->GetFreeItem();
-            item->priority_ = M_MAX_UNSIGNED;
-            item->workFunction_ = CheckDrawableVisibility;
-            item->aux_ = this;
-
-            PODVector<Drawable2D*>::Iterator end = drawables_.End();
-            if (i < numWorkItems - 1 && end - start > drawablesPerItem)
-                end = start + drawablesPerItem;
-            
-            item->start_ = &(*start);
-            item->end_ = &(*end);
-            queue->AddWorkItem(item);
-            
-            start = end;
-        }
-
-        queue->Complete(M_MAX_UNSIGNED);
+        queue->ParallelFor(drawables_, DRAWABLES_PER_BATCH, CheckDrawableVisibility(this));
     }
 
     vertexCount_ = 0;
@@ -0,0 +1,129 @@
+//
+// Copyright (c) 2008-2014 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "Benchmark.h"
+#include "Context.h"
+#include "ProcessUtils.h"
+#include "Timer.h"
+#include "WorkQueue.h"
+
+#ifdef WIN32
+#include <windows.h>
+#endif
+
+#include "DebugNew.h"
+
+/// Benchmark registration.
+struct BenchmarkEntry
+{
+    /// Name for selecting the benchmark from the command line.
+    const char* name_;
+    /// Benchmark function.
+    BenchmarkFunction function_;
+};
+
+static const BenchmarkEntry benchmarks[] = {
+    { "Container", RunContainerBenchmark },
+    { "Event", RunEventBenchmark },
+    { "Log", RunLogBenchmark },
+    { "Math", RunMathBenchmark },
+    { "Network", RunNetworkBenchmark },
+    { "Scene", RunSceneBenchmark },
+    { "Transform", RunTransformBenchmark },
+    { 0, 0 }
+};
+
+SharedPtr<Context> context_(new Context());
+
+int main(int argc, char** argv);
+int Run(const Vector<String>& arguments);
+
+int main(int argc, char** argv)
+{
+    Vector<String> arguments;
+    
+    #ifdef WIN32
+    arguments = ParseArguments(GetCommandLineW());
+    #else
+    arguments = ParseArguments(argc, argv);
+    #endif
+    
+    return Run(arguments);
+}
+
+int Run(const Vector<String>& arguments)
+{
+    if (arguments.Size() && arguments[0][0] == '-')
+    {
+        String usage = "Usage: Benchmark [benchmark name] ...\n\nRuns all benchmarks if no names are given. Available benchmarks:\n";
+        for (const BenchmarkEntry* i = benchmarks; i->name_; ++i)
+            usage += String(i->name_) + "\n";
+        ErrorExit(usage);
+    }
+    
+    // Time subsystem initializes the high-resolution timer, work queue is used by the threaded code paths
+    context_->RegisterSubsystem(new Time(context_));
+    context_->RegisterSubsystem(new WorkQueue(context_));
+    unsigned numThreads = GetNumPhysicalCPUs() - 1;
+    if (numThreads)
+        context_->GetSubsystem<WorkQueue>()->CreateThreads(numThreads);
+    
+    unsigned failed = 0;
+    for (const BenchmarkEntry* i = benchmarks; i->name_; ++i)
+    {
+        if (arguments.Size())
+        {
+            bool selected = false;
+            for (unsigned j = 0; j < arguments.Size(); ++j)
+            {
+                if (!arguments[j].Compare(i->name_, false))
+                    selected = true;
+            }
+            if (!selected)
+                continue;
+        }
+        
+        PrintLine(String(i->name_) + ":");
+        if (!i->function_(context_))
+        {
+            PrintLine("FAILED", true);
+            ++failed;
+        }
+        PrintLine("");
+    }
+    
+    return failed ? 1 : 0;
+}
+
+void PrintTiming(const String& name, long long usec, unsigned iterations)
+{
+    PrintLine("  " + name + ": " + String((int)(usec / 1000)) + " ms total, " + String((float)usec * 1000.0f / (float)iterations) +
+        " ns per iteration");
+}
+
+bool Check(bool condition, const String& description)
+{
+    if (!condition)
+        PrintLine("  Check failed: " + description, true);
+    return condition;
+}
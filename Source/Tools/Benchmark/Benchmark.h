@@ -0,0 +1,58 @@
+//
+// Copyright (c) 2008-2014 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#pragma once
+
+#include "Str.h"
+
+namespace Urho3D
+{
+
+class Context;
+
+}
+
+using namespace Urho3D;
+
+/// Benchmark function. Return false if any of its correctness checks failed.
+typedef bool (*BenchmarkFunction)(Context* context);
+
+/// Print the total and per-iteration time of a benchmark case.
+void PrintTiming(const String& name, long long usec, unsigned iterations);
+/// Print an error if a correctness check failed. Return the condition.
+bool Check(bool condition, const String& description);
+
+/// Benchmark strings and hash maps and check the edge cases of the string static buffer and the flat hash containers.
+bool RunContainerBenchmark(Context* context);
+/// Benchmark posting events from worker threads and check posted and typed event delivery.
+bool RunEventBenchmark(Context* context);
+/// Benchmark writing log messages with and without deferred formatting and check the formatting and log message events.
+bool RunLogBenchmark(Context* context);
+/// Benchmark the SIMD code paths of the math classes against scalar reference code.
+bool RunMathBenchmark(Context* context);
+/// Benchmark the CPU time and bandwidth of replicating a scene over a loopback connection and check the replicated state.
+bool RunNetworkBenchmark(Context* context);
+/// Benchmark loading a scene from the plain and schema-indexed binary formats and check that both restore the same attributes.
+bool RunSceneBenchmark(Context* context);
+/// Benchmark batched versus on-demand world transform updates of deep node hierarchies.
+bool RunTransformBenchmark(Context* context);
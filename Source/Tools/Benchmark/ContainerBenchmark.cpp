@@ -0,0 +1,225 @@
+//
+// Copyright (c) 2008-2014 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "Benchmark.h"
+#include "FlatHashMap.h"
+#include "FlatHashSet.h"
+#include "HashMap.h"
+#include "Timer.h"
+
+#include <cstring>
+
+#include "DebugNew.h"
+
+static const unsigned NUM_STRING_ROUNDS = 1000000;
+static const unsigned NUM_HASH_KEYS = 100000;
+
+static const char* testChars = "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+/// Return whether a string stores its characters in its own static buffer.
+static bool IsLocal(const String& str)
+{
+    const char* begin = reinterpret_cast<const char*>(&str);
+    return str.CString() >= begin && str.CString() < begin + sizeof(String);
+}
+
+/// Return whether a string has the expected length and the first characters of the test data.
+static bool HasTestChars(const String& str, unsigned length)
+{
+    return str.Length() == length && !strncmp(str.CString(), testChars, length) && str.CString()[length] == 0;
+}
+
+/// Check string construction, copying, resizing and swapping around the static buffer size.
+static bool CheckStrings()
+{
+    bool success = true;
+    
+    // Lengths 15, 16 and 17 fit the static buffer with the terminator, fill it exactly, and overflow it
+    for (unsigned length = 15; length <= 17; ++length)
+    {
+        String str(testChars, length);
+        String copy(str);
+        copy[0] = 'X';
+        success &= Check(HasTestChars(str, length) && IsLocal(str) == (length < 16), "string of length " + String(length) +
+            " uses the static buffer only if it fits");
+        success &= Check(copy.Length() == length && copy[0] == 'X' && str[0] == '0', "copy of a string of length " +
+            String(length) + " is independent");
+        
+        String appended(testChars, length - 1);
+        appended += testChars[length - 1];
+        success &= Check(HasTestChars(appended, length) && IsLocal(appended) == (length < 16), "appending a character to "
+            "reach length " + String(length));
+    }
+    
+    String resized(testChars, 15);
+    resized.Resize(17);
+    success &= Check(!strncmp(resized.CString(), testChars, 15) && !IsLocal(resized), "resizing over the static buffer");
+    resized.Resize(15);
+    resized.Compact();
+    success &= Check(HasTestChars(resized, 15) && IsLocal(resized), "resizing back and compacting into the static buffer");
+    
+    String doubled(testChars, 15);
+    doubled += doubled;
+    success &= Check(doubled.Length() == 30 && !strncmp(doubled.CString(), testChars, 15) && !strncmp(doubled.CString() + 15,
+        testChars, 15), "appending a string to itself over the static buffer");
+    
+    // Swap all combinations of short and long strings, including the lengths around the static buffer size
+    static const unsigned swapLengths[] = { 3, 15, 16, 40 };
+    for (unsigned i = 0; i < 4; ++i)
+    {
+        for (unsigned j = 0; j < 4; ++j)
+        {
+            String first(testChars, swapLengths[i]);
+            String second(testChars, swapLengths[j]);
+            first.Swap(second);
+            success &= Check(HasTestChars(first, swapLengths[j]) && HasTestChars(second, swapLengths[i]) &&
+                IsLocal(first) == (first.Capacity() <= 16) && IsLocal(second) == (second.Capacity() <= 16),
+                "swapping strings of length " + String(swapLengths[i]) + " and " + String(swapLengths[j]));
+        }
+    }
+    
+    return success;
+}
+
+/// Check flat hash map insertion, lookup, erasure, rehash and erasure while iterating.
+static bool CheckFlatHashMap()
+{
+    FlatHashMap<int, int> map;
+    bool success = true;
+    
+    for (unsigned i = 0; i < NUM_HASH_KEYS; ++i)
+        map[i] = i * 2;
+    
+    // Erase every other key, then insert them back into the erased slots
+    for (unsigned i = 0; i < NUM_HASH_KEYS; i += 2)
+        map.Erase(i);
+    bool erased = map.Size() == NUM_HASH_KEYS / 2;
+    for (unsigned i = 0; i < NUM_HASH_KEYS; ++i)
+        erased &= map.Contains(i) == ((i & 1) != 0);
+    success &= Check(erased, "erased keys are gone and the others are found");
+    
+    for (unsigned i = 0; i < NUM_HASH_KEYS; i += 2)
+        map[i] = i * 3;
+    map.Reserve(NUM_HASH_KEYS * 4);
+    bool rehashed = map.Size() == NUM_HASH_KEYS;
+    for (unsigned i = 0; i < NUM_HASH_KEYS; ++i)
+    {
+        FlatHashMap<int, int>::ConstIterator j = map.Find(i);
+        rehashed &= j != map.End() && j->second_ == (int)(i & 1 ? i * 2 : i * 3);
+    }
+    success &= Check(rehashed, "values survive reinsertion and rehash");
+    
+    unsigned visited = 0;
+    for (FlatHashMap<int, int>::Iterator i = map.Begin(); i != map.End();)
+    {
+        ++visited;
+        if (i->first_ % 3 == 0)
+            i = map.Erase(i);
+        else
+            ++i;
+    }
+    bool iterated = visited == NUM_HASH_KEYS && map.Size() == NUM_HASH_KEYS - (NUM_HASH_KEYS + 2) / 3;
+    for (unsigned i = 0; i < NUM_HASH_KEYS; ++i)
+        iterated &= map.Contains(i) == (i % 3 != 0);
+    success &= Check(iterated, "erasing while iterating visits each key once");
+    
+    map.Clear();
+    success &= Check(map.Empty() && map.Begin() == map.End() && !map.Contains(1), "cleared map is empty");
+    
+    return success;
+}
+
+/// Check flat hash set operation with non-POD keys through erasure and rehash.
+static bool CheckFlatHashSet()
+{
+    FlatHashSet<String> set;
+    for (unsigned i = 0; i < 1000; ++i)
+        set.Insert(String(testChars, i % 40) + String(i));
+    for (unsigned i = 0; i < 1000; i += 3)
+        set.Erase(String(testChars, i % 40) + String(i));
+    
+    bool success = set.Size() == 1000 - 334;
+    for (unsigned i = 0; i < 1000; ++i)
+        success &= set.Contains(String(testChars, i % 40) + String(i)) == (i % 3 != 0);
+    return Check(success, "string set erasure and rehash");
+}
+
+/// Time string construction and appending at a given length. Return false if the results were wrong.
+static bool TimeStrings(unsigned length)
+{
+    HiresTimer timer;
+    unsigned total = 0;
+    for (unsigned i = 0; i < NUM_STRING_ROUNDS; ++i)
+    {
+        String str(testChars, length);
+        str += testChars[i & 31];
+        total += str.Length();
+    }
+    
+    PrintTiming("String of length " + String(length) + " construct and append", timer.GetUSec(false), NUM_STRING_ROUNDS);
+    // Use the result so that the loop is not optimized away
+    return Check(total == NUM_STRING_ROUNDS * (length + 1), "string lengths after appending");
+}
+
+/// Return a hash map key for a key index. Keys are spread over the whole integer range like pointers or string hashes.
+static inline unsigned HashKey(unsigned index)
+{
+    return index * 2654435761u;
+}
+
+/// Time inserting, finding and erasing integer keys in a hash map type. Keys are accessed in a different order than inserted. Return false if the results were wrong.
+template <class T> bool TimeHashMap(const String& name)
+{
+    T map;
+    HiresTimer timer;
+    for (unsigned i = 0; i < NUM_HASH_KEYS; ++i)
+        map[HashKey(i)] = i;
+    PrintTiming(name + " insert", timer.GetUSec(true), NUM_HASH_KEYS);
+    
+    // Look up the keys and as many missing keys
+    unsigned found = 0;
+    for (unsigned i = 0; i < NUM_HASH_KEYS; ++i)
+    {
+        unsigned key = HashKey(i * 7919 % NUM_HASH_KEYS);
+        found += map.Contains(key) ? 1 : 0;
+        found += map.Contains(key + 1) ? 1 : 0;
+    }
+    PrintTiming(name + " find", timer.GetUSec(true), NUM_HASH_KEYS * 2);
+    
+    for (unsigned i = 0; i < NUM_HASH_KEYS; ++i)
+        map.Erase(HashKey(i * 7919 % NUM_HASH_KEYS));
+    PrintTiming(name + " erase", timer.GetUSec(false), NUM_HASH_KEYS);
+    
+    return Check(found == NUM_HASH_KEYS && map.Empty(), name + " contents after insert and erase");
+}
+
+bool RunContainerBenchmark(Context* context)
+{
+    bool success = TimeStrings(11);
+    success &= TimeStrings(40);
+    success &= TimeHashMap<HashMap<int, int> >("HashMap");
+    success &= TimeHashMap<FlatHashMap<int, int> >("FlatHashMap");
+    success &= CheckStrings();
+    success &= CheckFlatHashMap();
+    success &= CheckFlatHashSet();
+    return success;
+}
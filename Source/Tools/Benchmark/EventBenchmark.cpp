@@ -0,0 +1,259 @@
+//
+// Copyright (c) 2008-2014 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "Benchmark.h"
+#include "Context.h"
+#include "CoreEvents.h"
+#include "SceneEvents.h"
+#include "Timer.h"
+#include "WorkQueue.h"
+
+#include "DebugNew.h"
+
+static const unsigned NUM_POSTED_EVENTS = 100000;
+static const unsigned NUM_CANCELLED_EVENTS = 1000;
+static const unsigned POSTS_PER_WORK_ITEM = 256;
+static const unsigned NUM_SUBSCRIBERS = 10000;
+
+EVENT(E_BENCHMARKPOSTED, BenchmarkPosted)
+{
+    PARAM(P_VALUE, Value);                  // int
+}
+
+EVENT(E_BENCHMARKSENT, BenchmarkSent)
+{
+}
+
+/// Object that posts events and counts the events it receives.
+class EventCounter : public Object
+{
+    OBJECT(EventCounter);
+    
+public:
+    /// Construct.
+    EventCounter(Context* context) :
+        Object(context),
+        count_(0),
+        sum_(0),
+        timeStep_(0.0f)
+    {
+    }
+    
+    /// Subscribe to the posted event.
+    void SubscribeToPosted() { SubscribeToEvent(E_BENCHMARKPOSTED, HANDLER(EventCounter, HandlePosted)); }
+    /// Subscribe to the update event with a typed handler.
+    void SubscribeToUpdate() { SubscribeToEvent(E_UPDATE, TYPED_HANDLER(EventCounter, HandleUpdate)); }
+    
+    /// Handle a posted event.
+    void HandlePosted(StringHash eventType, VariantMap& eventData)
+    {
+        ++count_;
+        sum_ += eventData[BenchmarkPosted::P_VALUE].GetInt();
+    }
+    
+    /// Handle the update event with a typed payload.
+    void HandleUpdate(StringHash eventType, Update::Data& eventData)
+    {
+        ++count_;
+        timeStep_ = eventData.timeStep_;
+    }
+    
+    /// Number of events received.
+    unsigned count_;
+    /// Sum of the received values.
+    long long sum_;
+    /// Last received timestep.
+    float timeStep_;
+};
+
+/// Object that counts the sent events it receives and optionally unsubscribes while handling them.
+class EventSubscriber : public Object
+{
+    OBJECT(EventSubscriber);
+    
+public:
+    /// Construct.
+    EventSubscriber(Context* context) :
+        Object(context),
+        count_(0),
+        unsubscribeOnReceive_(false)
+    {
+    }
+    
+    /// Subscribe to the sent event.
+    void Subscribe() { SubscribeToEvent(E_BENCHMARKSENT, HANDLER(EventSubscriber, HandleSent)); }
+    /// Unsubscribe from the sent event.
+    void Unsubscribe() { UnsubscribeFromEvent(E_BENCHMARKSENT); }
+    
+    /// Handle the sent event.
+    void HandleSent(StringHash eventType, VariantMap& eventData)
+    {
+        ++count_;
+        if (unsubscribeOnReceive_)
+            Unsubscribe();
+    }
+    
+    /// Number of events received.
+    unsigned count_;
+    /// Unsubscribe when receiving flag.
+    bool unsubscribeOnReceive_;
+};
+
+/// Subsystem that counts the posted events it receives into an external counter, which outlives it.
+class PostedEventSubsystem : public Object
+{
+    OBJECT(PostedEventSubsystem);
+    
+public:
+    /// Construct.
+    PostedEventSubsystem(Context* context, unsigned* count) :
+        Object(context),
+        count_(count)
+    {
+        SubscribeToEvent(this, E_BENCHMARKPOSTED, HANDLER(PostedEventSubsystem, HandlePosted));
+    }
+    
+    /// Handle a posted event.
+    void HandlePosted(StringHash eventType, VariantMap& eventData) { ++*count_; }
+    
+    /// External counter.
+    unsigned* count_;
+};
+
+/// Return total number of events received by the subscribers.
+static unsigned CountReceived(const Vector<SharedPtr<EventSubscriber> >& subscribers)
+{
+    unsigned count = 0;
+    for (unsigned i = 0; i < subscribers.Size(); ++i)
+        count += subscribers[i]->count_;
+    return count;
+}
+
+/// Functor for posting events in worker threads.
+struct PostEventsWork
+{
+    /// Construct.
+    PostEventsWork(Object* sender) :
+        sender_(sender)
+    {
+    }
+    
+    /// Post an event for each value in the range.
+    void operator () (int* start, int* end, unsigned threadIndex) const
+    {
+        VariantMap eventData;
+        while (start != end)
+        {
+            eventData[BenchmarkPosted::P_VALUE] = *start++;
+            sender_->PostEvent(E_BENCHMARKPOSTED, eventData);
+        }
+    }
+    
+    /// Sender object.
+    Object* sender_;
+};
+
+bool RunEventBenchmark(Context* context)
+{
+    WorkQueue* queue = context->GetSubsystem<WorkQueue>();
+    SharedPtr<EventCounter> receiver(new EventCounter(context));
+    SharedPtr<EventCounter> sender(new EventCounter(context));
+    receiver->SubscribeToPosted();
+    
+    PODVector<int> values(NUM_POSTED_EVENTS);
+    long long expectedSum = 0;
+    for (unsigned i = 0; i < values.Size(); ++i)
+    {
+        values[i] = (int)i;
+        expectedSum += i;
+    }
+    
+    HiresTimer timer;
+    queue->ParallelFor(values, POSTS_PER_WORK_ITEM, PostEventsWork(sender));
+    PrintTiming("Post events from worker threads", timer.GetUSec(true), NUM_POSTED_EVENTS);
+    context->SendPostedEvents();
+    PrintTiming("Send posted events", timer.GetUSec(false), NUM_POSTED_EVENTS);
+    
+    bool success = Check(receiver->count_ == NUM_POSTED_EVENTS && receiver->sum_ == expectedSum,
+        "all posted events are received once");
+    
+    // Events of a sender destroyed before they are sent must be dropped
+    values.Resize(NUM_CANCELLED_EVENTS);
+    queue->ParallelFor(values, POSTS_PER_WORK_ITEM, PostEventsWork(sender));
+    sender.Reset();
+    receiver->count_ = 0;
+    context->SendPostedEvents();
+    success &= Check(receiver->count_ == 0, "events posted by a destroyed sender are not sent");
+    
+    // A typed handler receiving another event's payload must get it through the parameter map
+    receiver->SubscribeToUpdate();
+    SceneUpdate::Data sceneUpdateData;
+    sceneUpdateData.timeStep_ = 0.25f;
+    receiver->SendEvent(E_UPDATE, sceneUpdateData);
+    success &= Check(receiver->count_ == 1 && receiver->timeStep_ == 0.25f,
+        "typed handler receives a mismatched payload converted through the parameter map");
+    
+    // Subscribing and unsubscribing must not scan the existing receivers
+    Vector<SharedPtr<EventSubscriber> > subscribers(NUM_SUBSCRIBERS);
+    for (unsigned i = 0; i < NUM_SUBSCRIBERS; ++i)
+        subscribers[i] = new EventSubscriber(context);
+    
+    timer.Reset();
+    for (unsigned i = 0; i < NUM_SUBSCRIBERS; ++i)
+        subscribers[i]->Subscribe();
+    for (unsigned i = 0; i < NUM_SUBSCRIBERS; i += 2)
+        subscribers[i]->Unsubscribe();
+    for (unsigned i = 0; i < NUM_SUBSCRIBERS; i += 2)
+        subscribers[i]->Subscribe();
+    PrintTiming("Subscribe, unsubscribe and resubscribe", timer.GetUSec(false), NUM_SUBSCRIBERS * 2);
+    
+    receiver->SendEvent(E_BENCHMARKSENT);
+    success &= Check(CountReceived(subscribers) == NUM_SUBSCRIBERS, "resubscribed receivers get the event once each");
+    
+    // Every other receiver unsubscribes itself while the event is being sent; the rest must still get it
+    for (unsigned i = 0; i < NUM_SUBSCRIBERS; ++i)
+    {
+        subscribers[i]->count_ = 0;
+        subscribers[i]->unsubscribeOnReceive_ = (i & 1) != 0;
+    }
+    receiver->SendEvent(E_BENCHMARKSENT);
+    receiver->SendEvent(E_BENCHMARKSENT);
+    bool selfRemoved = true;
+    for (unsigned i = 0; i < NUM_SUBSCRIBERS; ++i)
+    {
+        if (subscribers[i]->count_ != ((i & 1) ? 1u : 2u))
+            selfRemoved = false;
+    }
+    success &= Check(selfRemoved, "receivers unsubscribing during send get the event only until they unsubscribe");
+    
+    // Events posted but not yet sent when the context is destroyed must still be sent to the subsystems
+    unsigned shutdownCount = 0;
+    {
+        SharedPtr<Context> shutdownContext(new Context());
+        PostedEventSubsystem* subsystem = new PostedEventSubsystem(shutdownContext, &shutdownCount);
+        shutdownContext->RegisterSubsystem(subsystem);
+        subsystem->PostEvent(E_BENCHMARKPOSTED);
+    }
+    success &= Check(shutdownCount == 1, "events posted before the context is destroyed are sent");
+    
+    return success;
+}
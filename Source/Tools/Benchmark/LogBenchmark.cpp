@@ -0,0 +1,221 @@
+//
+// Copyright (c) 2008-2014 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "Benchmark.h"
+#include "Context.h"
+#include "CoreEvents.h"
+#include "File.h"
+#include "FileSystem.h"
+#include "IOEvents.h"
+#include "Log.h"
+#include "Timer.h"
+#include "WorkQueue.h"
+
+#include "DebugNew.h"
+
+// Few enough to fit in the ring buffer, so that the timings measure the writing threads rather than the output thread
+static const unsigned NUM_LOG_MESSAGES = 2000;
+static const unsigned NUM_WORKER_MESSAGES = 10000;
+static const unsigned MESSAGES_PER_WORK_ITEM = 256;
+// Enough to wrap the ring buffer dozens of times
+static const unsigned NUM_WRAP_MESSAGES = 40000;
+static const unsigned MAX_WRAP_PADDING = 500;
+
+static char wrapPadding[MAX_WRAP_PADDING + 1];
+
+/// Return the padding length of a ring buffer wrapping test message. Varies so that records end at different offsets.
+static unsigned GetWrapPaddingLength(int value)
+{
+    return (unsigned)(value * 37) % MAX_WRAP_PADDING;
+}
+
+/// Object that counts the log messages it receives.
+class LogCounter : public Object
+{
+    OBJECT(LogCounter);
+    
+public:
+    /// Construct.
+    LogCounter(Context* context) :
+        Object(context),
+        count_(0)
+    {
+    }
+    
+    /// Subscribe to the log message event.
+    void SubscribeToLog() { SubscribeToEvent(E_LOGMESSAGE, HANDLER(LogCounter, HandleLogMessage)); }
+    
+    /// Handle a log message.
+    void HandleLogMessage(StringHash eventType, VariantMap& eventData)
+    {
+        ++count_;
+        lastMessage_ = eventData[LogMessage::P_MESSAGE].GetString();
+    }
+    
+    /// Number of messages received.
+    unsigned count_;
+    /// Last received message.
+    String lastMessage_;
+};
+
+/// Functor for writing log messages in worker threads.
+struct WriteLogWork
+{
+    /// Write a formatted message for each value in the range.
+    void operator () (int* start, int* end, unsigned threadIndex) const
+    {
+        while (start != end)
+            Log::WriteFormat(LOG_DEBUG, "Worker %u message %d", threadIndex, *start++);
+    }
+};
+
+/// Functor for writing variable-length log messages in worker threads, alternating between deferred and preformatted.
+struct WriteWrapWork
+{
+    /// Write a message for each value in the range.
+    void operator () (int* start, int* end, unsigned threadIndex) const
+    {
+        while (start != end)
+        {
+            int value = *start++;
+            const char* padding = wrapPadding + MAX_WRAP_PADDING - GetWrapPaddingLength(value);
+            if (value & 1)
+                Log::WriteFormat(LOG_DEBUG, "Wrap %d %s", value, padding);
+            else
+                Log::Write(LOG_DEBUG, "Wrap " + String(value) + " " + String(padding));
+        }
+    }
+};
+
+/// Read back the messages of the ring buffer wrapping test from the log file. Return true if each was written once and intact.
+static bool CheckWrapMessages(Context* context, const String& fileName)
+{
+    PODVector<unsigned char> seen(NUM_WRAP_MESSAGES);
+    for (unsigned i = 0; i < seen.Size(); ++i)
+        seen[i] = 0;
+    
+    File file(context, fileName);
+    unsigned numValid = 0;
+    while (!file.IsEof())
+    {
+        String line = file.ReadLine();
+        if (!line.StartsWith("DEBUG: Wrap "))
+            continue;
+        
+        unsigned separator = line.Find(' ', 12);
+        if (separator == String::NPOS)
+            return false;
+        int value = ToInt(line.Substring(12, separator - 12));
+        String padding = line.Substring(separator + 1);
+        if (value < 0 || value >= (int)NUM_WRAP_MESSAGES || seen[value] || padding.Length() != GetWrapPaddingLength(value) ||
+            padding != String(wrapPadding + MAX_WRAP_PADDING - padding.Length()))
+            return false;
+        
+        seen[value] = 1;
+        ++numValid;
+    }
+    
+    return numValid == NUM_WRAP_MESSAGES;
+}
+
+bool RunLogBenchmark(Context* context)
+{
+    WorkQueue* queue = context->GetSubsystem<WorkQueue>();
+    context->RegisterSubsystem(new Log(context));
+    Log* log = context->GetSubsystem<Log>();
+    log->SetLevel(LOG_DEBUG);
+    // Only errors go to the console, so the timings measure the queueing rather than the terminal
+    log->SetQuiet(true);
+    
+    // Deferred formatting must produce the same text as ToString()
+    const char* longString = "A string argument that is copied into the ring buffer";
+    Log::WriteFormat(LOG_INFO, "int %d %i unsigned %u float %f char %c string %s hex %x percent %% end", -12, 34, 56u, 0.5,
+        'z', longString, 255);
+    String expected = ToString("int %d %i unsigned %u float %f char %c string %s hex %x percent %% end", -12, 34, 56u, 0.5, 'z',
+        longString, 255);
+    bool success = Check(log->GetLastMessage() == expected, "deferred formatting matches ToString");
+    
+    Log::WriteFormat(LOG_INFO, "%s and %s", (const char*)0, "");
+    success &= Check(log->GetLastMessage() == " and ", "null and empty string arguments are written as empty");
+    
+    // A message too long for the ring buffer is formatted by the caller and truncated
+    String huge(' ', 256 * 1024);
+    Log::WriteFormat(LOG_INFO, "%s%d", huge.CString(), 1);
+    success &= Check(log->GetLastMessage().Length() == 64 * 1024, "an overlong message is truncated");
+    
+    HiresTimer timer;
+    for (unsigned i = 0; i < NUM_LOG_MESSAGES; ++i)
+        Log::Write(LOG_DEBUG, ToString("Message %u of %u, value %f", i, NUM_LOG_MESSAGES, (float)i * 0.5f));
+    PrintTiming("Write preformatted message", timer.GetUSec(true), NUM_LOG_MESSAGES);
+    log->Flush();
+    timer.Reset();
+    for (unsigned i = 0; i < NUM_LOG_MESSAGES; ++i)
+        Log::WriteFormat(LOG_DEBUG, "Message %u of %u, value %f", i, NUM_LOG_MESSAGES, (float)i * 0.5f);
+    PrintTiming("Write message with deferred formatting", timer.GetUSec(true), NUM_LOG_MESSAGES);
+    log->Flush();
+    PrintTiming("Flush deferred messages", timer.GetUSec(false), NUM_LOG_MESSAGES);
+    
+    // Messages written concurrently while the ring buffer wraps around many times must all come out intact
+    context->RegisterSubsystem(new FileSystem(context));
+    String wrapFileName = context->GetSubsystem<FileSystem>()->GetCurrentDir() + "LogBenchmark.log";
+    for (unsigned i = 0; i < MAX_WRAP_PADDING; ++i)
+        wrapPadding[i] = 'a' + i % 26;
+    PODVector<int> wrapValues(NUM_WRAP_MESSAGES);
+    for (unsigned i = 0; i < wrapValues.Size(); ++i)
+        wrapValues[i] = (int)i;
+    log->SetTimeStamp(false);
+    log->Open(wrapFileName);
+    timer.Reset();
+    queue->ParallelFor(wrapValues, MESSAGES_PER_WORK_ITEM, WriteWrapWork());
+    log->Flush();
+    PrintTiming("Write and flush messages from worker threads", timer.GetUSec(false), NUM_WRAP_MESSAGES);
+    log->Close();
+    log->SetTimeStamp(true);
+    success &= Check(CheckWrapMessages(context, wrapFileName), "all messages are intact after the ring buffer wraps");
+    context->GetSubsystem<FileSystem>()->Delete(wrapFileName);
+    context->RemoveSubsystem<FileSystem>();
+    
+    PODVector<int> values(NUM_WORKER_MESSAGES);
+    for (unsigned i = 0; i < values.Size(); ++i)
+        values[i] = (int)i;
+    
+    // Without receivers, messages from worker threads must not post the log message event
+    SharedPtr<LogCounter> counter(new LogCounter(context));
+    queue->ParallelFor(values, MESSAGES_PER_WORK_ITEM, WriteLogWork());
+    context->SendPostedEvents();
+    success &= Check(counter->count_ == 0, "no log message events are posted without receivers");
+    
+    // The receivers are checked by the main thread at the beginning of the frame
+    counter->SubscribeToLog();
+    context->GetSubsystem<Time>()->BeginFrame(0.0f);
+    context->GetSubsystem<Time>()->EndFrame();
+    counter->count_ = 0;
+    queue->ParallelFor(values, MESSAGES_PER_WORK_ITEM, WriteLogWork());
+    context->SendPostedEvents();
+    success &= Check(counter->count_ == NUM_WORKER_MESSAGES, "log message events are posted from worker threads");
+    
+    Log::WriteFormat(LOG_INFO, "Value %d", 42);
+    success &= Check(counter->lastMessage_.EndsWith("INFO: Value 42"), "log message event is sent formatted");
+    
+    context->RemoveSubsystem<Log>();
+    return success;
+}
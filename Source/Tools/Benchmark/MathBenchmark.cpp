@@ -0,0 +1,282 @@
+//
+// Copyright (c) 2008-2014 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "Benchmark.h"
+#include "BoundingBox.h"
+#include "Matrix3x4.h"
+#include "ProcessUtils.h"
+#include "Timer.h"
+
+#include "DebugNew.h"
+
+static const unsigned NUM_VALUES = 1024;
+static const unsigned NUM_ROUNDS = 2000;
+static const float TOLERANCE = 0.0001f;
+
+/// Scalar reference of Matrix3x4 multiplication.
+static Matrix3x4 MultiplyScalar(const Matrix3x4& lhs, const Matrix3x4& rhs)
+{
+    return Matrix3x4(
+        lhs.m00_ * rhs.m00_ + lhs.m01_ * rhs.m10_ + lhs.m02_ * rhs.m20_,
+        lhs.m00_ * rhs.m01_ + lhs.m01_ * rhs.m11_ + lhs.m02_ * rhs.m21_,
+        lhs.m00_ * rhs.m02_ + lhs.m01_ * rhs.m12_ + lhs.m02_ * rhs.m22_,
+        lhs.m00_ * rhs.m03_ + lhs.m01_ * rhs.m13_ + lhs.m02_ * rhs.m23_ + lhs.m03_,
+        lhs.m10_ * rhs.m00_ + lhs.m11_ * rhs.m10_ + lhs.m12_ * rhs.m20_,
+        lhs.m10_ * rhs.m01_ + lhs.m11_ * rhs.m11_ + lhs.m12_ * rhs.m21_,
+        lhs.m10_ * rhs.m02_ + lhs.m11_ * rhs.m12_ + lhs.m12_ * rhs.m22_,
+        lhs.m10_ * rhs.m03_ + lhs.m11_ * rhs.m13_ + lhs.m12_ * rhs.m23_ + lhs.m13_,
+        lhs.m20_ * rhs.m00_ + lhs.m21_ * rhs.m10_ + lhs.m22_ * rhs.m20_,
+        lhs.m20_ * rhs.m01_ + lhs.m21_ * rhs.m11_ + lhs.m22_ * rhs.m21_,
+        lhs.m20_ * rhs.m02_ + lhs.m21_ * rhs.m12_ + lhs.m22_ * rhs.m22_,
+        lhs.m20_ * rhs.m03_ + lhs.m21_ * rhs.m13_ + lhs.m22_ * rhs.m23_ + lhs.m23_
+    );
+}
+
+/// Scalar reference of Matrix4 multiplication.
+static Matrix4 MultiplyScalar(const Matrix4& lhs, const Matrix4& rhs)
+{
+    Matrix4 ret;
+    const float* left = lhs.Data();
+    const float* right = rhs.Data();
+    float* dest = const_cast<float*>(ret.Data());
+    for (unsigned i = 0; i < 4; ++i)
+    {
+        for (unsigned j = 0; j < 4; ++j)
+        {
+            dest[i * 4 + j] = left[i * 4] * right[j] + left[i * 4 + 1] * right[4 + j] + left[i * 4 + 2] * right[8 + j] +
+                left[i * 4 + 3] * right[12 + j];
+        }
+    }
+    return ret;
+}
+
+/// Scalar reference of Quaternion multiplication.
+static Quaternion MultiplyScalar(const Quaternion& lhs, const Quaternion& rhs)
+{
+    return Quaternion(
+        lhs.w_ * rhs.w_ - lhs.x_ * rhs.x_ - lhs.y_ * rhs.y_ - lhs.z_ * rhs.z_,
+        lhs.w_ * rhs.x_ + lhs.x_ * rhs.w_ + lhs.y_ * rhs.z_ - lhs.z_ * rhs.y_,
+        lhs.w_ * rhs.y_ + lhs.y_ * rhs.w_ + lhs.z_ * rhs.x_ - lhs.x_ * rhs.z_,
+        lhs.w_ * rhs.z_ + lhs.z_ * rhs.w_ + lhs.x_ * rhs.y_ - lhs.y_ * rhs.x_
+    );
+}
+
+/// Scalar reference of bounding box transform.
+static BoundingBox TransformScalar(const BoundingBox& box, const Matrix3x4& transform)
+{
+    Vector3 newCenter = transform * box.Center();
+    Vector3 oldEdge = box.Size() * 0.5f;
+    Vector3 newEdge = Vector3(
+        Abs(transform.m00_) * oldEdge.x_ + Abs(transform.m01_) * oldEdge.y_ + Abs(transform.m02_) * oldEdge.z_,
+        Abs(transform.m10_) * oldEdge.x_ + Abs(transform.m11_) * oldEdge.y_ + Abs(transform.m12_) * oldEdge.z_,
+        Abs(transform.m20_) * oldEdge.x_ + Abs(transform.m21_) * oldEdge.y_ + Abs(transform.m22_) * oldEdge.z_
+    );
+    return BoundingBox(newCenter - newEdge, newCenter + newEdge);
+}
+
+/// Scalar reference of Matrix3x4 inverse.
+static Matrix3x4 InverseScalar(const Matrix3x4& m)
+{
+    float invDet = 1.0f / (m.m00_ * m.m11_ * m.m22_ + m.m10_ * m.m21_ * m.m02_ + m.m20_ * m.m01_ * m.m12_ -
+        m.m20_ * m.m11_ * m.m02_ - m.m10_ * m.m01_ * m.m22_ - m.m00_ * m.m21_ * m.m12_);
+    Matrix3x4 ret;
+    ret.m00_ = (m.m11_ * m.m22_ - m.m21_ * m.m12_) * invDet;
+    ret.m01_ = -(m.m01_ * m.m22_ - m.m21_ * m.m02_) * invDet;
+    ret.m02_ = (m.m01_ * m.m12_ - m.m11_ * m.m02_) * invDet;
+    ret.m03_ = -(m.m03_ * ret.m00_ + m.m13_ * ret.m01_ + m.m23_ * ret.m02_);
+    ret.m10_ = -(m.m10_ * m.m22_ - m.m20_ * m.m12_) * invDet;
+    ret.m11_ = (m.m00_ * m.m22_ - m.m20_ * m.m02_) * invDet;
+    ret.m12_ = -(m.m00_ * m.m12_ - m.m10_ * m.m02_) * invDet;
+    ret.m13_ = -(m.m03_ * ret.m10_ + m.m13_ * ret.m11_ + m.m23_ * ret.m12_);
+    ret.m20_ = (m.m10_ * m.m21_ - m.m20_ * m.m11_) * invDet;
+    ret.m21_ = -(m.m00_ * m.m21_ - m.m20_ * m.m01_) * invDet;
+    ret.m22_ = (m.m00_ * m.m11_ - m.m10_ * m.m01_) * invDet;
+    ret.m23_ = -(m.m03_ * ret.m20_ + m.m13_ * ret.m21_ + m.m23_ * ret.m22_);
+    return ret;
+}
+
+/// Return whether two float arrays are equal within a tolerance relative to their magnitude.
+static bool Near(const float* lhs, const float* rhs, unsigned count)
+{
+    for (unsigned i = 0; i < count; ++i)
+    {
+        if (Abs(lhs[i] - rhs[i]) > TOLERANCE * Max(1.0f, Abs(rhs[i])))
+            return false;
+    }
+    return true;
+}
+
+/// Return a random rotation.
+static Quaternion RandomRotation()
+{
+    return Quaternion(Random(-180.0f, 180.0f), Random(-180.0f, 180.0f), Random(-180.0f, 180.0f));
+}
+
+/// Return a random transform with non-uniform scale.
+static Matrix3x4 RandomTransform()
+{
+    return Matrix3x4(Vector3(Random(-100.0f, 100.0f), Random(-100.0f, 100.0f), Random(-100.0f, 100.0f)), RandomRotation(),
+        Vector3(Random(0.5f, 2.0f), Random(0.5f, 2.0f), Random(0.5f, 2.0f)));
+}
+
+bool RunMathBenchmark(Context* context)
+{
+    SetRandomSeed(1);
+    
+    PODVector<Matrix3x4> transforms(NUM_VALUES);
+    PODVector<Matrix3x4> otherTransforms(NUM_VALUES);
+    PODVector<Matrix4> projections(NUM_VALUES);
+    PODVector<Matrix4> otherProjections(NUM_VALUES);
+    PODVector<Quaternion> rotations(NUM_VALUES);
+    PODVector<Quaternion> otherRotations(NUM_VALUES);
+    PODVector<BoundingBox> boxes(NUM_VALUES);
+    for (unsigned i = 0; i < NUM_VALUES; ++i)
+    {
+        transforms[i] = RandomTransform();
+        otherTransforms[i] = RandomTransform();
+        projections[i] = transforms[i].ToMatrix4();
+        projections[i].m30_ = Random(-1.0f, 1.0f);
+        otherProjections[i] = otherTransforms[i].ToMatrix4();
+        rotations[i] = RandomRotation();
+        otherRotations[i] = RandomRotation();
+        Vector3 center(Random(-50.0f, 50.0f), Random(-50.0f, 50.0f), Random(-50.0f, 50.0f));
+        Vector3 halfSize(Random(0.1f, 10.0f), Random(0.1f, 10.0f), Random(0.1f, 10.0f));
+        boxes[i] = BoundingBox(center - halfSize, center + halfSize);
+    }
+    
+    #if defined(URHO3D_MATH_SSE)
+    PrintLine("  Math classes use SSE");
+    #elif defined(URHO3D_MATH_NEON)
+    PrintLine("  Math classes use NEON");
+    #else
+    PrintLine("  Math classes use scalar code");
+    #endif
+    
+    bool success = true;
+    unsigned iterations = NUM_ROUNDS * NUM_VALUES;
+    HiresTimer timer;
+    
+    // Each operation is timed in the math classes and in the scalar reference, then the last results are compared
+    {
+        PODVector<Matrix3x4> results(NUM_VALUES);
+        PODVector<Matrix3x4> reference(NUM_VALUES);
+        timer.Reset();
+        for (unsigned i = 0; i < NUM_ROUNDS; ++i)
+        {
+            for (unsigned j = 0; j < NUM_VALUES; ++j)
+                results[j] = transforms[j] * otherTransforms[j];
+        }
+        PrintTiming("Matrix3x4 multiply", timer.GetUSec(true), iterations);
+        for (unsigned i = 0; i < NUM_ROUNDS; ++i)
+        {
+            for (unsigned j = 0; j < NUM_VALUES; ++j)
+                reference[j] = MultiplyScalar(transforms[j], otherTransforms[j]);
+        }
+        PrintTiming("Matrix3x4 multiply, scalar reference", timer.GetUSec(true), iterations);
+        success &= Check(Near(results[0].Data(), reference[0].Data(), NUM_VALUES * 12), "Matrix3x4 multiply matches the scalar reference");
+    }
+    
+    {
+        PODVector<Matrix4> results(NUM_VALUES);
+        PODVector<Matrix4> reference(NUM_VALUES);
+        timer.Reset();
+        for (unsigned i = 0; i < NUM_ROUNDS; ++i)
+        {
+            for (unsigned j = 0; j < NUM_VALUES; ++j)
+                results[j] = projections[j] * otherProjections[j];
+        }
+        PrintTiming("Matrix4 multiply", timer.GetUSec(true), iterations);
+        for (unsigned i = 0; i < NUM_ROUNDS; ++i)
+        {
+            for (unsigned j = 0; j < NUM_VALUES; ++j)
+                reference[j] = MultiplyScalar(projections[j], otherProjections[j]);
+        }
+        PrintTiming("Matrix4 multiply, scalar reference", timer.GetUSec(true), iterations);
+        success &= Check(Near(results[0].Data(), reference[0].Data(), NUM_VALUES * 16), "Matrix4 multiply matches the scalar reference");
+    }
+    
+    {
+        PODVector<Quaternion> results(NUM_VALUES);
+        PODVector<Quaternion> reference(NUM_VALUES);
+        timer.Reset();
+        for (unsigned i = 0; i < NUM_ROUNDS; ++i)
+        {
+            for (unsigned j = 0; j < NUM_VALUES; ++j)
+                results[j] = rotations[j] * otherRotations[j];
+        }
+        PrintTiming("Quaternion multiply", timer.GetUSec(true), iterations);
+        for (unsigned i = 0; i < NUM_ROUNDS; ++i)
+        {
+            for (unsigned j = 0; j < NUM_VALUES; ++j)
+                reference[j] = MultiplyScalar(rotations[j], otherRotations[j]);
+        }
+        PrintTiming("Quaternion multiply, scalar reference", timer.GetUSec(true), iterations);
+        success &= Check(Near(results[0].Data(), reference[0].Data(), NUM_VALUES * 4), "Quaternion multiply matches the scalar reference");
+    }
+    
+    {
+        PODVector<BoundingBox> results(NUM_VALUES);
+        PODVector<BoundingBox> reference(NUM_VALUES);
+        timer.Reset();
+        for (unsigned i = 0; i < NUM_ROUNDS; ++i)
+        {
+            for (unsigned j = 0; j < NUM_VALUES; ++j)
+                results[j] = boxes[j].Transformed(transforms[j]);
+        }
+        PrintTiming("BoundingBox transform", timer.GetUSec(true), iterations);
+        for (unsigned i = 0; i < NUM_ROUNDS; ++i)
+        {
+            for (unsigned j = 0; j < NUM_VALUES; ++j)
+                reference[j] = TransformScalar(boxes[j], transforms[j]);
+        }
+        PrintTiming("BoundingBox transform, scalar reference", timer.GetUSec(true), iterations);
+        bool match = true;
+        for (unsigned i = 0; i < NUM_VALUES; ++i)
+        {
+            match &= Near(&results[i].min_.x_, &reference[i].min_.x_, 3);
+            match &= Near(&results[i].max_.x_, &reference[i].max_.x_, 3);
+        }
+        success &= Check(match, "BoundingBox transform matches the scalar reference");
+    }
+    
+    {
+        PODVector<Matrix3x4> results(NUM_VALUES);
+        PODVector<Matrix3x4> reference(NUM_VALUES);
+        timer.Reset();
+        for (unsigned i = 0; i < NUM_ROUNDS; ++i)
+        {
+            for (unsigned j = 0; j < NUM_VALUES; ++j)
+                results[j] = transforms[j].Inverse();
+        }
+        PrintTiming("Matrix3x4 inverse", timer.GetUSec(true), iterations);
+        for (unsigned i = 0; i < NUM_ROUNDS; ++i)
+        {
+            for (unsigned j = 0; j < NUM_VALUES; ++j)
+                reference[j] = InverseScalar(transforms[j]);
+        }
+        PrintTiming("Matrix3x4 inverse, scalar reference", timer.GetUSec(true), iterations);
+        success &= Check(Near(results[0].Data(), reference[0].Data(), NUM_VALUES * 12), "Matrix3x4 inverse matches the scalar reference");
+    }
+    
+    return success;
+}
@@ -0,0 +1,288 @@
+//
+// Copyright (c) 2008-2014 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "Benchmark.h"
+#include "Context.h"
+#include "FileSystem.h"
+#include "Network.h"
+#include "NetworkEvents.h"
+#include "NetworkInterestGrid.h"
+#include "NetworkPriority.h"
+#include "ProcessUtils.h"
+#include "Random.h"
+#include "ResourceCache.h"
+#include "Scene.h"
+#include "SmoothedTransform.h"
+#include "Timer.h"
+
+#include <kNet/MessageConnection.h>
+
+#include "DebugNew.h"
+
+static const unsigned short BENCHMARK_PORT = 2346;
+static const unsigned NUM_REPLICATED_NODES = 2000;
+static const unsigned NUM_NETWORK_UPDATES = 100;
+static const float NETWORK_TIMESTEP = 1.0f / 30.0f;
+static const unsigned NETWORK_TIMEOUT_MS = 10000;
+static const float INTEREST_RADIUS = 10.0f;
+
+/// Object that assigns the server scene to connecting clients.
+class SceneServer : public Object
+{
+    OBJECT(SceneServer);
+    
+public:
+    /// Construct.
+    SceneServer(Context* context, Scene* scene) :
+        Object(context),
+        scene_(scene)
+    {
+    }
+    
+    /// Subscribe to client connections.
+    void SubscribeToClients() { SubscribeToEvent(E_CLIENTCONNECTED, HANDLER(SceneServer, HandleClientConnected)); }
+    
+    /// Handle a client connection.
+    void HandleClientConnected(StringHash eventType, VariantMap& eventData)
+    {
+        Connection* connection = static_cast<Connection*>(eventData[ClientConnected::P_CONNECTION].GetPtr());
+        connection->SetScene(scene_);
+    }
+    
+    /// Server scene.
+    Scene* scene_;
+};
+
+/// Return the replicated position of a client node. Replicated nodes are smoothed on the client, so return the smoothing target.
+static const Vector3& GetReplicatedPosition(Node* node)
+{
+    SmoothedTransform* transform = node->GetComponent<SmoothedTransform>();
+    return transform ? transform->GetTargetPosition() : node->GetPosition();
+}
+
+/// Run the network updates of the server and the client once.
+static void UpdateNetworks(Network* server, Network* client)
+{
+    server->Update(NETWORK_TIMESTEP);
+    server->PostUpdate(NETWORK_TIMESTEP);
+    client->Update(NETWORK_TIMESTEP);
+    client->PostUpdate(NETWORK_TIMESTEP);
+}
+
+/// Return the number of nodes outside the area of interest whose client position matches the server.
+static unsigned CountUpdatedOutsideInterest(const PODVector<Node*>& nodes, Scene* clientScene)
+{
+    unsigned updated = 0;
+    for (unsigned i = 0; i < nodes.Size(); ++i)
+    {
+        Node* clientNode = clientScene->GetNode(nodes[i]->GetID());
+        if (nodes[i]->GetWorldPosition().Length() > INTEREST_RADIUS && clientNode &&
+            GetReplicatedPosition(clientNode) == nodes[i]->GetPosition())
+            ++updated;
+    }
+    return updated;
+}
+
+/// Return the number of server nodes whose position differs on the client.
+static unsigned CountMismatched(const PODVector<Node*>& nodes, Scene* clientScene)
+{
+    unsigned mismatched = 0;
+    for (unsigned i = 0; i < nodes.Size(); ++i)
+    {
+        Node* clientNode = clientScene->GetNode(nodes[i]->GetID());
+        if (!clientNode || GetReplicatedPosition(clientNode) != nodes[i]->GetPosition())
+            ++mismatched;
+    }
+    return mismatched;
+}
+
+/// Update the networks until the client scene has a node with the given ID and position, or the timeout elapses. Return whether succeeded.
+static bool WaitForNode(Network* server, Network* client, Scene* clientScene, unsigned nodeID, const Vector3& position)
+{
+    Timer timer;
+    while (timer.GetMSec(false) < NETWORK_TIMEOUT_MS)
+    {
+        UpdateNetworks(server, client);
+        Node* node = clientScene->GetNode(nodeID);
+        if (node && GetReplicatedPosition(node) == position)
+            return true;
+        Time::Sleep(1);
+    }
+    return false;
+}
+
+/// Update the networks until the client positions of all the nodes match the server, or the timeout elapses. Return whether succeeded.
+static bool WaitForNodes(Network* server, Network* client, Scene* clientScene, const PODVector<Node*>& nodes)
+{
+    Timer timer;
+    while (timer.GetMSec(false) < NETWORK_TIMEOUT_MS)
+    {
+        UpdateNetworks(server, client);
+        if (!CountMismatched(nodes, clientScene))
+            return true;
+        Time::Sleep(1);
+    }
+    return false;
+}
+
+bool RunNetworkBenchmark(Context* context)
+{
+    RegisterSceneLibrary(context);
+    context->RegisterSubsystem(new Network(context));
+    Network* server = context->GetSubsystem<Network>();
+    
+    // The client runs in its own context, as there is one network subsystem per context
+    SharedPtr<Context> clientContext(new Context());
+    clientContext->RegisterSubsystem(new FileSystem(clientContext));
+    clientContext->RegisterSubsystem(new ResourceCache(clientContext));
+    clientContext->RegisterSubsystem(new Network(clientContext));
+    RegisterSceneLibrary(clientContext);
+    Network* client = clientContext->GetSubsystem<Network>();
+    
+    SharedPtr<Scene> serverScene(new Scene(context));
+    PODVector<Node*> nodes;
+    for (unsigned i = 0; i < NUM_REPLICATED_NODES; ++i)
+    {
+        Node* node = serverScene->CreateChild();
+        node->SetPosition(Vector3(Random(100.0f), 0.0f, Random(100.0f)));
+        nodes.Push(node);
+    }
+    
+    SharedPtr<SceneServer> sceneServer(new SceneServer(context, serverScene));
+    sceneServer->SubscribeToClients();
+    SharedPtr<Scene> clientScene(new Scene(clientContext));
+    
+    if (!Check(server->StartServer(BENCHMARK_PORT) && client->Connect("127.0.0.1", BENCHMARK_PORT, clientScene),
+        "server starts and client connects"))
+        return false;
+    
+    bool success = Check(WaitForNodes(server, client, clientScene, nodes), "client receives the initial scene");
+    
+    Vector<SharedPtr<Connection> > connections = server->GetClientConnections();
+    if (success && Check(connections.Size() == 1, "server has one client connection"))
+    {
+        kNet::MessageConnection* messageConnection = connections[0]->GetMessageConnection();
+        
+        // Move every node on each update, so that each update sends latest data for all of them
+        long long serverUSec = 0;
+        long long clientUSec = 0;
+        unsigned long long bytesBefore = messageConnection->BytesOutTotal();
+        HiresTimer timer;
+        for (unsigned i = 0; i < NUM_NETWORK_UPDATES; ++i)
+        {
+            for (unsigned j = 0; j < nodes.Size(); ++j)
+                nodes[j]->Translate(Vector3(0.0f, 0.1f, 0.0f));
+            
+            timer.Reset();
+            server->Update(NETWORK_TIMESTEP);
+            server->PostUpdate(NETWORK_TIMESTEP);
+            serverUSec += timer.GetUSec(true);
+            client->Update(NETWORK_TIMESTEP);
+            client->PostUpdate(NETWORK_TIMESTEP);
+            clientUSec += timer.GetUSec(false);
+            
+            // Let the kNet worker threads send and receive
+            Time::Sleep(1);
+        }
+        
+        // The last update's latest data is not replaced by anything, so it must arrive
+        success &= Check(WaitForNodes(server, client, clientScene, nodes), "client receives the latest positions of all nodes");
+        
+        unsigned long long bytes = messageConnection->BytesOutTotal() - bytesBefore;
+        PrintTiming("Server update of " + String(NUM_REPLICATED_NODES) + " moving nodes", serverUSec, NUM_NETWORK_UPDATES);
+        PrintTiming("Client update of " + String(NUM_REPLICATED_NODES) + " moving nodes", clientUSec, NUM_NETWORK_UPDATES);
+        PrintLine("  Bytes sent per update: " + String((unsigned)(bytes / NUM_NETWORK_UPDATES)) + " (" +
+            String((float)bytes / (float)(NUM_NETWORK_UPDATES * NUM_REPLICATED_NODES)) + " per node)");
+        
+        // Delta updates must arrive in order after the latest data
+        nodes[0]->SetVar("Benchmark", 42);
+        nodes[0]->Translate(Vector3(0.0f, 1.0f, 0.0f));
+        success &= Check(WaitForNode(server, client, clientScene, nodes[0]->GetID(), nodes[0]->GetPosition()),
+            "client receives a latest data update");
+        Timer varTimer;
+        Node* clientNode = clientScene->GetNode(nodes[0]->GetID());
+        while (clientNode->GetVar("Benchmark").GetInt() != 42 && varTimer.GetMSec(false) < NETWORK_TIMEOUT_MS)
+        {
+            UpdateNetworks(server, client);
+            Time::Sleep(1);
+        }
+        success &= Check(clientNode->GetVar("Benchmark").GetInt() == 42, "client receives a delta update");
+        
+        // A network priority on a detached node takes effect once the node is added to the scene
+        SharedPtr<Node> detachedNode(new Node(context));
+        detachedNode->CreateComponent<NetworkPriority>();
+        serverScene->AddChild(detachedNode);
+        unsigned detachedID = detachedNode->GetID();
+        NetworkInterestGrid* grid = serverScene->GetComponent<NetworkInterestGrid>();
+        success &= Check(grid && grid->GetEntry(detachedID), "network priority registers when its node is added to the scene");
+        detachedNode->Remove();
+        detachedNode.Reset();
+        success &= Check(grid && !grid->GetEntry(detachedID), "network priority unregisters when its node is removed");
+        success &= Check(grid && grid->IsTemporary(), "server creates the interest grid as temporary");
+        
+        // Network priorities created without a grid must be collected when the server creates the grid again
+        if (grid)
+            grid->Remove();
+        for (unsigned i = 0; i < nodes.Size(); ++i)
+            nodes[i]->CreateComponent<NetworkPriority>();
+        UpdateNetworks(server, client);
+        grid = serverScene->GetComponent<NetworkInterestGrid>();
+        success &= Check(grid && grid->GetNumNodes() == nodes.Size(), "interest grid collects the existing network priorities");
+        
+        // Limit the area of interest around the observer at the origin, so that almost all nodes are outside it. Their
+        // changes must wait until they enter it, and the server must not process them on each update meanwhile
+        connections[0]->SetInterestRadius(INTEREST_RADIUS);
+        UpdateNetworks(server, client);
+        
+        serverUSec = 0;
+        for (unsigned i = 0; i < NUM_NETWORK_UPDATES; ++i)
+        {
+            for (unsigned j = 0; j < nodes.Size(); ++j)
+                nodes[j]->Translate(Vector3(0.0f, 0.1f, 0.0f));
+            
+            timer.Reset();
+            server->Update(NETWORK_TIMESTEP);
+            server->PostUpdate(NETWORK_TIMESTEP);
+            serverUSec += timer.GetUSec(false);
+            client->Update(NETWORK_TIMESTEP);
+            client->PostUpdate(NETWORK_TIMESTEP);
+            Time::Sleep(1);
+        }
+        
+        PrintTiming("Server update of " + String(NUM_REPLICATED_NODES) + " moving nodes outside the area of interest",
+            serverUSec, NUM_NETWORK_UPDATES);
+        success &= Check(CountUpdatedOutsideInterest(nodes, clientScene) == 0, "nodes outside the area of interest are not updated");
+        
+        // Removing the limit must send the pending changes
+        connections[0]->SetInterestRadius(0.0f);
+        success &= Check(WaitForNodes(server, client, clientScene, nodes),
+            "nodes outside the area of interest are updated once it is no longer limited");
+    }
+    
+    client->Disconnect(100);
+    server->StopServer();
+    clientScene.Reset();
+    serverScene.Reset();
+    clientContext->RemoveSubsystem<Network>();
+    context->RemoveSubsystem<Network>();
+    return success;
+}
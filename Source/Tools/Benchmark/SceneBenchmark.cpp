@@ -0,0 +1,256 @@
+//
+// Copyright (c) 2008-2014 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "Benchmark.h"
+#include "Component.h"
+#include "Context.h"
+#include "ProcessUtils.h"
+#include "Scene.h"
+#include "Timer.h"
+#include "VectorBuffer.h"
+
+#include "DebugNew.h"
+
+static const unsigned NUM_SCENE_NODES = 2000;
+static const unsigned NUM_SCENE_LOADS = 10;
+
+static const char* benchmarkModeNames[] = {
+    "First",
+    "Second",
+    "Third",
+    0
+};
+
+/// Component with offset attributes that allows schema-indexed loading to copy them directly.
+class DirectComponent : public Component
+{
+    OBJECT(DirectComponent);
+
+public:
+    /// Construct.
+    DirectComponent(Context* context) :
+        Component(context),
+        value_(0),
+        weight_(0.0f),
+        mode_(0),
+        active_(false)
+    {
+    }
+    
+    /// Register object factory.
+    static void RegisterObject(Context* context)
+    {
+        context->RegisterFactory<DirectComponent>();
+    
+        ATTRIBUTE(DirectComponent, VAR_INT, "Value", value_, 0, AM_DEFAULT);
+        ATTRIBUTE(DirectComponent, VAR_FLOAT, "Weight", weight_, 0.0f, AM_DEFAULT);
+        ENUM_ATTRIBUTE(DirectComponent, "Mode", mode_, benchmarkModeNames, 0, AM_DEFAULT);
+        ATTRIBUTE(DirectComponent, VAR_BOOL, "Is Active", active_, false, AM_DEFAULT);
+    }
+    
+    /// Return whether schema-indexed loading may bypass OnSetAttribute().
+    virtual bool LoadAttributesDirect() const { return true; }
+    
+    /// Integer value.
+    int value_;
+    /// Float value.
+    float weight_;
+    /// Enum value. Only the low 8 bits are used.
+    unsigned char mode_;
+    /// Bool value.
+    bool active_;
+};
+
+/// Component with accessor attributes that derives state in OnSetAttribute(), so schema-indexed loading must go through it.
+class DerivedStateComponent : public Component
+{
+    OBJECT(DerivedStateComponent);
+
+public:
+    /// Construct.
+    DerivedStateComponent(Context* context) :
+        Component(context),
+        count_(0),
+        scale_(Vector3::ONE),
+        derivedCount_(0)
+    {
+    }
+    
+    /// Register object factory.
+    static void RegisterObject(Context* context)
+    {
+        context->RegisterFactory<DerivedStateComponent>();
+    
+        ATTRIBUTE(DerivedStateComponent, VAR_INT, "Count", count_, 0, AM_DEFAULT);
+        REF_ACCESSOR_ATTRIBUTE(DerivedStateComponent, VAR_STRING, "Label", GetLabel, SetLabel, String, String::EMPTY, AM_DEFAULT);
+        REF_ACCESSOR_ATTRIBUTE(DerivedStateComponent, VAR_VECTOR3, "Scale", GetScale, SetScale, Vector3, Vector3::ONE, AM_DEFAULT);
+    }
+    
+    /// Handle attribute write access.
+    virtual void OnSetAttribute(const AttributeInfo& attr, const Variant& src)
+    {
+        Serializable::OnSetAttribute(attr, src);
+        if (attr.offset_ == offsetof(DerivedStateComponent, count_))
+            derivedCount_ = count_ * 2;
+    }
+    
+    /// Set label.
+    void SetLabel(const String& label) { label_ = label; }
+    /// Set scale.
+    void SetScale(const Vector3& scale) { scale_ = scale; }
+    /// Return label.
+    const String& GetLabel() const { return label_; }
+    /// Return scale.
+    const Vector3& GetScale() const { return scale_; }
+    
+    /// Count, copied to the derived count when set as an attribute.
+    int count_;
+    /// Label.
+    String label_;
+    /// Scale.
+    Vector3 scale_;
+    /// Count derived in OnSetAttribute().
+    int derivedCount_;
+};
+
+/// Return whether all attributes of two objects are equal.
+static bool CompareAttributes(Serializable* lhs, Serializable* rhs)
+{
+    unsigned numAttributes = lhs->GetNumAttributes();
+    if (rhs->GetNumAttributes() != numAttributes)
+        return false;
+    
+    for (unsigned i = 0; i < numAttributes; ++i)
+    {
+        if (lhs->GetAttribute(i) != rhs->GetAttribute(i))
+            return false;
+    }
+    
+    return true;
+}
+
+/// Return the number of child nodes whose attributes, components or derived state differ between two loaded scenes.
+static unsigned CountMismatched(Scene* lhs, Scene* rhs)
+{
+    unsigned mismatched = 0;
+    unsigned numChildren = lhs->GetNumChildren();
+    if (rhs->GetNumChildren() != numChildren)
+        return Max((int)numChildren, (int)rhs->GetNumChildren());
+    
+    for (unsigned i = 0; i < numChildren; ++i)
+    {
+        Node* lhsNode = lhs->GetChild(i);
+        Node* rhsNode = rhs->GetChild(i);
+        if (!CompareAttributes(lhsNode, rhsNode) || lhsNode->GetNumComponents() !=
+            rhsNode->GetNumComponents())
+        {
+            ++mismatched;
+            continue;
+        }
+    
+        const Vector<SharedPtr<Component> >& lhsComponents = lhsNode->GetComponents();
+        const Vector<SharedPtr<Component> >& rhsComponents = rhsNode->GetComponents();
+        bool equal = true;
+        for (unsigned j = 0; j < lhsComponents.Size(); ++j)
+        {
+            if (lhsComponents[j]->GetType() != rhsComponents[j]->GetType() || !CompareAttributes(lhsComponents[j],
+                rhsComponents[j]))
+                equal = false;
+        }
+    
+        DerivedStateComponent* lhsDerived = lhsNode->GetComponent<DerivedStateComponent>();
+        DerivedStateComponent* rhsDerived = rhsNode->GetComponent<DerivedStateComponent>();
+        if (!lhsDerived || !rhsDerived || lhsDerived->derivedCount_ != lhsDerived->count_ * 2 || rhsDerived->derivedCount_ !=
+            rhsDerived->count_ * 2)
+            equal = false;
+    
+        if (!equal)
+            ++mismatched;
+    }
+    
+    return mismatched;
+}
+
+bool RunSceneBenchmark(Context* context)
+{
+    // Other benchmarks may have registered the scene library already
+    if (!context->GetAttributes(Node::GetTypeStatic()))
+        RegisterSceneLibrary(context);
+    DirectComponent::RegisterObject(context);
+    DerivedStateComponent::RegisterObject(context);
+    
+    SharedPtr<Scene> scene(new Scene(context));
+    for (unsigned i = 0; i < NUM_SCENE_NODES; ++i)
+    {
+        Node* node = scene->CreateChild("Node" + String(i));
+        node->SetPosition(Vector3((float)i, (float)(i % 7), -(float)i));
+        node->SetRotation(Quaternion((float)i, Vector3::UP));
+        node->SetScale(Vector3(1.0f + (float)(i % 3), 2.0f, 3.0f));
+        node->SetEnabled(i % 5 != 0);
+        node->SetVar("Index", (int)i);
+    
+        DirectComponent* direct = node->CreateComponent<DirectComponent>();
+        direct->value_ = (int)i;
+        direct->weight_ = (float)i * 0.5f;
+        direct->mode_ = (unsigned char)(i % 3);
+        direct->active_ = (i & 1) != 0;
+    
+        DerivedStateComponent* derived = node->CreateComponent<DerivedStateComponent>();
+        derived->SetAttribute("Count", (int)i + 1);
+        derived->SetLabel("Label" + String(i));
+        derived->SetScale(Vector3((float)i, 1.0f, 0.5f));
+    }
+    
+    // The plain format is the node hierarchy saved without a schema
+    VectorBuffer plainData;
+    plainData.WriteFileID("USCN");
+    scene->Node::Save(plainData);
+    VectorBuffer schemaData;
+    scene->Save(schemaData);
+    
+    SharedPtr<Scene> plainScene(new Scene(context));
+    SharedPtr<Scene> schemaScene(new Scene(context));
+    bool loaded = true;
+    
+    HiresTimer timer;
+    for (unsigned i = 0; i < NUM_SCENE_LOADS; ++i)
+    {
+        plainData.Seek(0);
+        loaded &= plainScene->Load(plainData);
+    }
+    PrintTiming("Load plain scene of " + String(NUM_SCENE_NODES) + " nodes", timer.GetUSec(true), NUM_SCENE_LOADS);
+    for (unsigned i = 0; i < NUM_SCENE_LOADS; ++i)
+    {
+        schemaData.Seek(0);
+        loaded &= schemaScene->Load(schemaData);
+    }
+    PrintTiming("Load schema-indexed scene of " + String(NUM_SCENE_NODES) + " nodes", timer.GetUSec(false), NUM_SCENE_LOADS);
+    PrintLine("  Plain size: " + String(plainData.GetSize()) + " bytes, schema-indexed size: " + String(schemaData.GetSize()) +
+        " bytes");
+    
+    bool success = Check(loaded, "scene loads from both formats");
+    success &= Check(plainScene->GetNumChildren() == NUM_SCENE_NODES && !CountMismatched(plainScene, schemaScene),
+        "schema-indexed load restores the same attributes and derived state as the plain format");
+    success &= Check(!CountMismatched(scene, schemaScene), "schema-indexed load restores the saved attributes");
+    
+    return success;
+}
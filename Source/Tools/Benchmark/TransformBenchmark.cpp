@@ -0,0 +1,137 @@
+//
+// Copyright (c) 2008-2014 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "Benchmark.h"
+#include "Component.h"
+#include "Context.h"
+#include "Scene.h"
+#include "Timer.h"
+
+#include "DebugNew.h"
+
+static const unsigned NUM_CHAINS = 2000;
+static const unsigned CHAIN_DEPTH = 16;
+static const unsigned NUM_FRAMES = 100;
+
+/// Listener component that counts its dirty notifications.
+class DirtyCounter : public Component
+{
+    OBJECT(DirtyCounter);
+    
+public:
+    /// Construct.
+    DirtyCounter(Context* context) :
+        Component(context),
+        count_(0)
+    {
+    }
+    
+    /// Number of dirty notifications received.
+    unsigned count_;
+    
+protected:
+    /// Handle scene node transform dirtied.
+    virtual void OnMarkedDirty(Node* node) { ++count_; }
+};
+
+/// Create node chains resembling ragdolls or attached props. Return all nodes parents first.
+static void CreateChains(Scene* scene, PODVector<Node*>& roots, PODVector<Node*>& nodes)
+{
+    for (unsigned i = 0; i < NUM_CHAINS; ++i)
+    {
+        Node* parent = scene->CreateChild(String::EMPTY, LOCAL);
+        parent->SetPosition(Vector3((float)i, 0.0f, 0.0f));
+        roots.Push(parent);
+        nodes.Push(parent);
+        
+        for (unsigned j = 1; j < CHAIN_DEPTH; ++j)
+        {
+            Node* child = parent->CreateChild(String::EMPTY, LOCAL);
+            child->SetPosition(Vector3(0.0f, 1.0f, 0.0f));
+            child->SetRotation(Quaternion(10.0f, Vector3::FORWARD));
+            nodes.Push(child);
+            parent = child;
+        }
+    }
+}
+
+/// Move the chains each frame and read all world positions children first. Return microseconds spent on the world transforms.
+static long long RunFrames(Scene* scene, const PODVector<Node*>& roots, const PODVector<Node*>& nodes, bool batched,
+    PODVector<Vector3>& positions)
+{
+    scene->SetBatchedTransforms(batched);
+    positions.Resize(nodes.Size());
+    
+    HiresTimer timer;
+    long long usec = 0;
+    for (unsigned i = 0; i < NUM_FRAMES; ++i)
+    {
+        Quaternion rotation((float)i, Vector3::UP);
+        for (unsigned j = 0; j < roots.Size(); ++j)
+            roots[j]->SetRotation(rotation);
+        
+        // Time only the world transform calculation, as marking dirty costs the same in both modes
+        timer.Reset();
+        if (batched)
+            scene->UpdateTransforms();
+        
+        for (unsigned j = nodes.Size() - 1; j < nodes.Size(); --j)
+            positions[j] = nodes[j]->GetWorldPosition();
+        usec += timer.GetUSec(false);
+    }
+    
+    return usec;
+}
+
+bool RunTransformBenchmark(Context* context)
+{
+    RegisterSceneLibrary(context);
+    
+    SharedPtr<Scene> scene(new Scene(context));
+    PODVector<Node*> roots;
+    PODVector<Node*> nodes;
+    CreateChains(scene, roots, nodes);
+    
+    PODVector<Vector3> lazyPositions;
+    PODVector<Vector3> batchedPositions;
+    PrintTiming("On-demand world transforms", RunFrames(scene, roots, nodes, false, lazyPositions), NUM_FRAMES);
+    PrintTiming("Batched world transforms", RunFrames(scene, roots, nodes, true, batchedPositions), NUM_FRAMES);
+    
+    bool success = Check(lazyPositions == batchedPositions, "batched world positions equal on-demand positions");
+    
+    // A listener must be notified of every change, even if the world transform was not read in between
+    Node* leaf = nodes[CHAIN_DEPTH - 1];
+    SharedPtr<DirtyCounter> counter(new DirtyCounter(context));
+    leaf->AddComponent(counter, 0, LOCAL);
+    leaf->AddListener(counter);
+    counter->count_ = 0;
+    roots[0]->Translate(Vector3::UP);
+    roots[0]->Translate(Vector3::UP);
+    success &= Check(counter->count_ == 2, "listener notified on each change of a dirty parent");
+    
+    scene->UpdateTransforms();
+    success &= Check(!leaf->IsDirty() && leaf->GetWorldPosition().Equals(leaf->GetParent()->GetWorldTransform() * leaf->GetPosition()),
+        "batched update cleans and positions the leaf node");
+    
+    return success;
+}
@@ -52,9 +52,9 @@ private:
 
     /// Script file name.
     String scriptFileName_;
-    
-#ifdef URHO3D_ANGELSCRIPT
+    
+#ifdef URHO3D_ANGELSCRIPT
     /// Script file.
     SharedPtr<ScriptFile> scriptFile_;
-#endif
+#endif
 };